@@ -0,0 +1,399 @@
+//==============================================================================
+///
+/// @file flow-benchmark.cpp
+///
+/// @brief Maximum flow engine benchmark.
+///
+/// Builds a square grid network (4-neighbour arcs, source feeding the first
+/// column, last column feeding sink) and a bipartite network (source to
+/// left side, random left to right arcs, right side to sink), both with
+/// random capacities, and times every flow engine on the same graphs:
+/// edmonds_karp (shortest path and capacity scaling), dinic, push_relabel
+/// and boykov_kolmogorov sequentially, then parallel_push_relabel with 1,
+/// 2, ... up to the given number of threads.
+/// Flow values are printed next to times, so engines disagreeing on the
+/// maximum show up at once.
+///
+/// Usage: flow-benchmark [grid side] [bipartite side] [degree] [threads] [repeats]
+///
+/// The documentation is available on the following website:
+/// <website>
+///
+/// Support email: <email>
+///
+//==============================================================================
+
+
+//------------------------------------------------------------------------------
+// Include files
+//------------------------------------------------------------------------------
+// System
+// e.g.: #include <iostream>        // stdout
+#include <iostream>
+#include <string>
+#include <vector>
+#include <random>               // std::mt19937
+#include <chrono>               // std::chrono::steady_clock
+#include <algorithm>            // std::sort
+#include <thread>               // std::thread::hardware_concurrency
+
+// Project
+// e.g.: #include "IncludeFile.h"   // MyType_t
+#include "graph-lib/graph.hpp"                                  // graph::Graph, component::Vertex
+#include "graph-lib/algorithm/flow/edmonds.hpp"                 // algorithm::edmonds_karp
+#include "graph-lib/algorithm/flow/dinic.hpp"                   // algorithm::dinic
+#include "graph-lib/algorithm/flow/push-relabel.hpp"            // algorithm::push_relabel
+#include "graph-lib/algorithm/flow/boykov-kolmogorov.hpp"       // algorithm::boykov_kolmogorov
+#include "graph-lib/algorithm/flow/parallel-push-relabel.hpp"   // algorithm::parallel_push_relabel
+
+
+//------------------------------------------------------------------------------
+// Global references
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Constants
+//------------------------------------------------------------------------------
+
+/// @brief Largest network timed with edmonds_karp, one BFS per augmentation.
+static constexpr int edmonds_limit = 20000;
+
+
+//------------------------------------------------------------------------------
+// Macros
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Local data types
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+/// @brief Flow network with designated terminals.
+///
+//------------------------------------------------------------------------------
+struct network
+{
+    /// @brief Graph, capacities on edges.
+    graph::Graph<int> graph;
+
+    /// @brief Source vertex id.
+    int source;
+
+    /// @brief Sink vertex id.
+    int sink;
+};
+
+
+//------------------------------------------------------------------------------
+// Forward function declarations
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+/// @brief Build grid network.
+///
+/// @param[in] side Grid rows and columns.
+///
+/// @param[out] result Network to fill.
+///
+//------------------------------------------------------------------------------
+void
+build_grid(int side,
+           network& result);
+
+//------------------------------------------------------------------------------
+/// @brief Build bipartite network.
+///
+/// @param[in] side Vertices on each side.
+///
+/// @param[in] degree Arcs from every left vertex.
+///
+/// @param[out] result Network to fill.
+///
+//------------------------------------------------------------------------------
+void
+build_bipartite(int side,
+                int degree,
+                network& result);
+
+//------------------------------------------------------------------------------
+/// @brief Median wall time of repeated runs.
+///
+/// @param[in] repeats Timed runs, after one untimed warm-up run.
+///
+/// @param[in] runOnce Callable running the engine, returns flow value.
+///
+/// @param[out] flow Flow value of the last run.
+///
+/// @return Median milliseconds.
+///
+//------------------------------------------------------------------------------
+template<class run_type>
+double
+median_ms(int repeats,
+          run_type runOnce,
+          int& flow);
+
+//------------------------------------------------------------------------------
+/// @brief Time every engine on a network.
+///
+/// @param[in] name Network name.
+///
+/// @param[in] instance Network.
+///
+/// @param[in] threads Highest thread count of parallel runs.
+///
+/// @param[in] repeats Timed runs per engine.
+///
+//------------------------------------------------------------------------------
+void
+compare_engines(const char* name,
+                const network& instance,
+                int threads,
+                int repeats);
+
+
+//------------------------------------------------------------------------------
+// Variable definitions
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Function definitions
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+//
+//  Vertex r * side + c, source side * side, sink side * side + 1.
+//
+//------------------------------------------------------------------------------
+void
+build_grid(int side,
+           network& result)
+{
+    const auto direction = component::traits::edge_direction::one_two;
+    std::mt19937 generator(2024);
+    std::uniform_int_distribution<int> capacity(1, 100);
+
+    result.source = side * side;
+    result.sink = side * side + 1;
+    for (int id = 0; id < side * side + 2; ++id)
+    {
+        result.graph.AddVertex(id);
+    }
+
+    for (int row = 0; row < side; ++row)
+    {
+        for (int column = 0; column < side; ++column)
+        {
+            int id = row * side + column;
+            if (column + 1 < side)
+            {
+                result.graph.AddEdge(id, id + 1, direction, 1, capacity(generator));
+                result.graph.AddEdge(id + 1, id, direction, 1, capacity(generator));
+            }
+            if (row + 1 < side)
+            {
+                result.graph.AddEdge(id, id + side, direction, 1, capacity(generator));
+                result.graph.AddEdge(id + side, id, direction, 1, capacity(generator));
+            }
+        }
+        result.graph.AddEdge(result.source, row * side, direction, 1, 100);
+        result.graph.AddEdge(row * side + side - 1, result.sink, direction, 1, 100);
+    }
+}
+
+//------------------------------------------------------------------------------
+//
+//  Left vertices 0..side-1, right side..2*side-1, source 2*side, sink
+//  2*side+1.
+//
+//------------------------------------------------------------------------------
+void
+build_bipartite(int side,
+                int degree,
+                network& result)
+{
+    const auto direction = component::traits::edge_direction::one_two;
+    std::mt19937 generator(7);
+    std::uniform_int_distribution<int> pick(side, 2 * side - 1);
+    std::uniform_int_distribution<int> capacity(1, 100);
+    std::vector<int> targets;
+
+    result.source = 2 * side;
+    result.sink = 2 * side + 1;
+    for (int id = 0; id < 2 * side + 2; ++id)
+    {
+        result.graph.AddVertex(id);
+    }
+
+    for (int left = 0; left < side; ++left)
+    {
+        result.graph.AddEdge(result.source, left, direction, 1, capacity(generator));
+
+        // distinct targets, no parallel arcs
+        targets.clear();
+        while (static_cast<int>(targets.size()) < std::min(degree, side))
+        {
+            int target = pick(generator);
+            if (std::find(targets.begin(), targets.end(), target) == targets.end())
+            {
+                targets.push_back(target);
+                result.graph.AddEdge(left, target, direction, 1, capacity(generator));
+            }
+        }
+    }
+    for (int right = side; right < 2 * side; ++right)
+    {
+        result.graph.AddEdge(right, result.sink, direction, 1, capacity(generator));
+    }
+}
+
+//------------------------------------------------------------------------------
+//
+//  <Design related information>
+//
+//------------------------------------------------------------------------------
+template<class run_type>
+double
+median_ms(int repeats,
+          run_type runOnce,
+          int& flow)
+{
+    flow = runOnce();
+
+    std::vector<double> times;
+    for (int repeat = 0; repeat < repeats; ++repeat)
+    {
+        auto start = std::chrono::steady_clock::now();
+        flow = runOnce();
+        auto stop = std::chrono::steady_clock::now();
+
+        times.push_back(std::chrono::duration<double, std::milli>(stop - start).count());
+    }
+
+    std::sort(times.begin(), times.end());
+    return times[times.size() / 2];
+}
+
+//------------------------------------------------------------------------------
+//
+//  Engines are constructed once, outside timed runs, so snapshots and
+//  residual networks are not part of the measurement. Flow overlay and
+//  residual network resets are, as every run does them.
+//
+//------------------------------------------------------------------------------
+void
+compare_engines(const char* name,
+                const network& instance,
+                int threads,
+                int repeats)
+{
+    using vertex_type = component::Vertex<int>;
+
+    const vertex_type source(instance.source);
+    const vertex_type sink(instance.sink);
+    int flow = 0;
+
+    std::cout << name << '\n';
+    auto report = [&flow](const std::string& engine, double time)
+    {
+        std::cout << "  " << engine << ": " << time << " ms, flow " << flow << '\n';
+    };
+
+    if (instance.sink >= edmonds_limit)
+    {
+        std::cout << "  edmonds_karp: skipped, network too large\n";
+        std::cout << "  edmonds_karp scaling: skipped, network too large\n";
+    }
+    else
+    {
+        algorithm::edmonds_karp<int> engine(&instance.graph);
+        double time = median_ms(repeats, [&]()
+            {
+                engine.run(source, sink);
+                return engine.get();
+            }, flow);
+        report("edmonds_karp", time);
+
+        time = median_ms(repeats, [&]()
+            {
+                engine.run(source, sink, algorithm::traits::augment_mode::capacity_scaling);
+                return engine.get();
+            }, flow);
+        report("edmonds_karp scaling", time);
+    }
+    {
+        algorithm::dinic<int> engine(&instance.graph);
+        double time = median_ms(repeats, [&]()
+            {
+                engine.run(source, sink);
+                return engine.get();
+            }, flow);
+        report("dinic", time);
+    }
+    {
+        algorithm::push_relabel<int> engine(&instance.graph);
+        double time = median_ms(repeats, [&]()
+            {
+                engine.run(source, sink);
+                return engine.get();
+            }, flow);
+        report("push_relabel", time);
+    }
+    {
+        algorithm::boykov_kolmogorov<int> engine(&instance.graph);
+        double time = median_ms(repeats, [&]()
+            {
+                engine.run(source, sink);
+                return engine.get();
+            }, flow);
+        report("boykov_kolmogorov", time);
+    }
+
+    algorithm::parallel_push_relabel<int> engine(&instance.graph);
+    for (int count = 1; count <= threads; count *= 2)
+    {
+        engine.set_threads(count);
+        double time = median_ms(repeats, [&]()
+            {
+                engine.run(source, sink);
+                return engine.get();
+            }, flow);
+        report("parallel_push_relabel x" + std::to_string(count), time);
+    }
+}
+
+//------------------------------------------------------------------------------
+//
+//  <Design related information>
+//
+//------------------------------------------------------------------------------
+int
+main(int argc, char* argv[])
+{
+    int side = (argc > 1) ? std::stoi(argv[1]) : 256;
+    int bipartite = (argc > 2) ? std::stoi(argv[2]) : 50000;
+    int degree = (argc > 3) ? std::stoi(argv[3]) : 8;
+    int threads = (argc > 4) ? std::stoi(argv[4]) :
+        std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+    int repeats = (argc > 5) ? std::stoi(argv[5]) : 3;
+
+    std::cout << "Building networks: " << side << 'x' << side << " grid, "
+              << bipartite << '+' << bipartite << " bipartite with "
+              << degree << " arcs per left vertex\n";
+
+    network grid;
+    build_grid(side, grid);
+    compare_engines("grid", grid, threads, repeats);
+
+    network matching;
+    build_bipartite(bipartite, degree, matching);
+    compare_engines("bipartite", matching, threads, repeats);
+
+    return 0;
+}
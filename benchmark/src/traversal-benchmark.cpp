@@ -0,0 +1,324 @@
+//==============================================================================
+///
+/// @file traversal-benchmark.cpp
+///
+/// @brief Prefetch pipeline benchmark of traversals.
+///
+/// Builds a random graph, uniform targets and fixed out degree, large enough
+/// for traversal arrays to exceed last level cache, and times queue BFS,
+/// direction optimizing BFS and DFS from the same roots with prefetching
+/// disabled (distance 0) and enabled. Uniform targets defeat locality, so
+/// every arc costs a cache miss without prefetching.
+///
+/// Usage: traversal-benchmark [vertices] [degree] [repeats] [distance]
+///
+/// The documentation is available on the following website:
+/// <website>
+///
+/// Support email: <email>
+///
+//==============================================================================
+
+
+//------------------------------------------------------------------------------
+// Include files
+//------------------------------------------------------------------------------
+// System
+// e.g.: #include <iostream>        // stdout
+#include <iostream>
+#include <string>
+#include <vector>
+#include <utility>              // std::pair
+#include <random>               // std::mt19937
+#include <chrono>               // std::chrono::steady_clock
+#include <algorithm>            // std::sort
+
+// Project
+// e.g.: #include "IncludeFile.h"   // MyType_t
+#include "graph-lib/graph.hpp"                       // graph::Graph, component::Vertex
+#include "graph-lib/component/edge.hpp"             // component::Edge
+#include "graph-lib/algorithm/traversal/bfs.hpp"    // algorithm::bfs
+#include "graph-lib/algorithm/traversal/dfs.hpp"    // algorithm::dfs
+
+
+//------------------------------------------------------------------------------
+// Global references
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Constants
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Macros
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Local data types
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+/// @brief Generated graph exposing cbegin()/cend()/GetNeighbours().
+///
+/// Keeps arcs in flat arrays and creates edge objects on request, so graphs
+/// with millions of vertices fit in memory next to traversal snapshots.
+/// Edges refer to their endpoints, so vertex objects are owned here.
+///
+//------------------------------------------------------------------------------
+class random_graph
+{
+    using vertex_type   = component::Vertex<int>;
+    using edge_type     = component::Edge<int>;
+
+public:
+
+    //------------------------------------------------------------------------------
+    /// @brief Vertex iterator, dereferences to (vertex, id) pair.
+    ///
+    //------------------------------------------------------------------------------
+    class const_iterator
+    {
+    public:
+
+        explicit const_iterator(int id) : id_(id)
+        {   }
+
+        std::pair<vertex_type, int>
+        operator*() const
+        {
+            return std::pair<vertex_type, int>(vertex_type(id_), id_);
+        }
+
+        const_iterator&
+        operator++()
+        {
+            ++id_;
+            return *this;
+        }
+
+        bool
+        operator!=(const const_iterator& other) const
+        {
+            return id_ != other.id_;
+        }
+
+    private:
+
+        /// @brief Current vertex id.
+        int id_;
+    };
+
+    //------------------------------------------------------------------------------
+    /// @brief Value constructor.
+    ///
+    /// @param[in] vertices Number of vertices.
+    ///
+    /// @param[in] degree Out degree of every vertex.
+    ///
+    /// @param[in] seed Generator seed.
+    ///
+    //------------------------------------------------------------------------------
+    random_graph(int vertices,
+                 int degree,
+                 unsigned seed) : degree_(degree)
+    {
+        vertices_.reserve(vertices);
+        for (int id = 0; id < vertices; ++id)
+        {
+            vertices_.emplace_back(id);
+        }
+
+        std::mt19937 generator(seed);
+        std::uniform_int_distribution<int> pick(0, vertices - 1);
+
+        targets_.resize(static_cast<std::size_t>(vertices) * degree);
+        for (auto& target : targets_)
+        {
+            target = pick(generator);
+        }
+    }
+
+    const_iterator
+    cbegin() const
+    {
+        return const_iterator(0);
+    }
+
+    const_iterator
+    cend() const
+    {
+        return const_iterator(static_cast<int>(vertices_.size()));
+    }
+
+    std::vector<edge_type>
+    GetNeighbours(const vertex_type& vertex) const
+    {
+        std::vector<edge_type> result;
+        result.reserve(degree_);
+
+        std::size_t begin = static_cast<std::size_t>(vertex.Id()) * degree_;
+        for (int i = 0; i < degree_; ++i)
+        {
+            result.emplace_back(vertices_[vertex.Id()], vertices_[targets_[begin + i]],
+                                component::traits::edge_direction::one_two, 1, 1);
+        }
+        return result;
+    }
+
+private:
+
+    /// @brief Vertex with id i at index i.
+    std::vector<vertex_type> vertices_;
+
+    /// @brief Out degree.
+    int degree_;
+
+    /// @brief Arc targets, degree_ per vertex.
+    std::vector<int> targets_;
+};
+
+
+//------------------------------------------------------------------------------
+// Forward function declarations
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+/// @brief Median wall times with prefetching disabled and enabled.
+///
+/// @param[in] roots Root vertices, one timed run per root and setting.
+///
+/// @param[in] distance Prefetch distance of enabled runs.
+///
+/// @param[in] setDistance Callable setting prefetch distance.
+///
+/// @param[in] runOnce Callable running traversal from a root.
+///
+/// @return Median milliseconds: disabled, enabled.
+///
+//------------------------------------------------------------------------------
+template<class set_type,
+         class run_type>
+std::pair<double, double>
+compare_ms(const std::vector<int>& roots,
+           int distance,
+           set_type setDistance,
+           run_type runOnce);
+
+
+//------------------------------------------------------------------------------
+// Variable definitions
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Function definitions
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+//
+//  Settings alternate root by root, so machine noise drifting over time hits
+//  both alike. One untimed warm-up run keeps first touch page faults out.
+//
+//------------------------------------------------------------------------------
+template<class set_type,
+         class run_type>
+std::pair<double, double>
+compare_ms(const std::vector<int>& roots,
+           int distance,
+           set_type setDistance,
+           run_type runOnce)
+{
+    runOnce(roots.front());
+
+    std::vector<double> times[2];
+    for (int root : roots)
+    {
+        for (int enabled = 0; enabled < 2; ++enabled)
+        {
+            setDistance(enabled ? distance : 0);
+
+            auto start = std::chrono::steady_clock::now();
+            runOnce(root);
+            auto stop = std::chrono::steady_clock::now();
+
+            times[enabled].push_back(std::chrono::duration<double, std::milli>(stop - start).count());
+        }
+    }
+
+    for (auto& entry : times)
+    {
+        std::sort(entry.begin(), entry.end());
+    }
+    return std::make_pair(times[0][roots.size() / 2], times[1][roots.size() / 2]);
+}
+
+//------------------------------------------------------------------------------
+//
+//  <Design related information>
+//
+//------------------------------------------------------------------------------
+int
+main(int argc, char* argv[])
+{
+    using vertex_type = component::Vertex<int>;
+
+    int vertices = (argc > 1) ? std::stoi(argv[1]) : (1 << 22);
+    int degree = (argc > 2) ? std::stoi(argv[2]) : 8;
+    int repeats = (argc > 3) ? std::stoi(argv[3]) : 9;
+    int distance = (argc > 4) ? std::stoi(argv[4]) : 8;
+
+    std::cout << "Building graph: " << vertices << " vertices, "
+              << degree << " arcs per vertex\n";
+    random_graph graph(vertices, degree, 2024);
+
+    std::mt19937 generator(7);
+    std::uniform_int_distribution<int> pick(0, vertices - 1);
+    std::vector<int> roots(repeats);
+    for (auto& root : roots)
+    {
+        root = pick(generator);
+    }
+
+    algorithm::bfs<int, random_graph> bfsObj(&graph);
+    algorithm::dfs<int, random_graph> dfsObj(&graph);
+    std::cout << "BFS working set: "
+              << bfsObj.MemoryUsage().total() / (1024 * 1024) << " MiB, "
+              << "prefetch distance " << distance << '\n';
+
+    auto report = [](const char* name, std::pair<double, double> times)
+    {
+        std::cout << name << ": off " << times.first << " ms, on " << times.second
+                  << " ms, speedup " << times.first / times.second << '\n';
+    };
+
+    auto setBfs = [&](int value)
+    {
+        bfsObj.set_prefetch_distance(value);
+    };
+    auto setDfs = [&](int value)
+    {
+        dfsObj.set_prefetch_distance(value);
+    };
+
+    report("queue BFS", compare_ms(roots, distance, setBfs, [&](int root)
+        {
+            bfsObj.run(vertex_type(root));
+        }));
+    report("direction optimizing BFS", compare_ms(roots, distance, setBfs, [&](int root)
+        {
+            bfsObj.run(vertex_type(root), algorithm::traits::bfs_mode::direction_optimizing);
+        }));
+    report("DFS", compare_ms(roots, distance, setDfs, [&](int root)
+        {
+            dfsObj.run(vertex_type(root));
+        }));
+
+    return 0;
+}
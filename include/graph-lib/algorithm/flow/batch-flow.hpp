@@ -0,0 +1,507 @@
+//==============================================================================
+///
+/// @file batch-flow.hpp
+///
+/// @brief Maximum flow of many source-sink pairs in parallel.
+///
+/// One snapshot and one residual network topology are shared read-only by
+/// all threads. Each thread owns an overlay: its own residual capacities
+/// indexed by residual arc, read through overlay_network, plus a level
+/// graph sized once. Pairs are taken from an atomic cursor and solved by
+/// Dinic phases (see level-graph.hpp) on the taking thread's overlay, so no
+/// flow state is ever shared and no thread waits for another until the
+/// batch ends. Overlays survive across runs and only their residuals are
+/// refilled per pair.
+/// Last level BFS of a pair marks the source side of its minimum cut, which
+/// is turned into a cut on request without another search.
+///
+/// The documentation is available on the following website:
+/// <website>
+///
+/// Support email: <email>
+///
+//==============================================================================
+
+//==============================================================================
+// Include only once
+//
+#ifndef GRAPH_LIB_ALGORITHM_FLOW_BATCH_FLOW_HPP
+#define GRAPH_LIB_ALGORITHM_FLOW_BATCH_FLOW_HPP
+
+
+//------------------------------------------------------------------------------
+// Include files
+//------------------------------------------------------------------------------
+// System
+// e.g.: #include <iostream>        // stdout
+#include <vector>
+#include <utility>                  // std::pair, std::move
+#include <atomic>
+#include <thread>
+#include <algorithm>                // std::min, std::max
+#include <stdexcept>                // std::invalid_argument
+
+// Project
+// e.g.: #include "IncludeFile.h"   // MyType_t
+#include "graph-lib/component/vertex.hpp"                   // component::Vertex
+#include "graph-lib/implementation/compressed-list.hpp"     // implementation::CompressedList
+#include "graph-lib/utility/memory.hpp"                     // utility::memory_usage
+#include "graph-lib/algorithm/flow/residual-network.hpp"    // algorithm::residual_network
+#include "graph-lib/algorithm/flow/level-graph.hpp"         // algorithm::level_graph
+#include "graph-lib/algorithm/flow/min-cut.hpp"             // algorithm::min_cut
+
+
+//------------------------------------------------------------------------------
+// Global references
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Constants
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Macros
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Forward declarations
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Data types
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+/// @brief Common graph algorithms.
+///
+//------------------------------------------------------------------------------
+namespace algorithm
+{
+    //------------------------------------------------------------------------------
+    /// @brief Batch maximum flow implementation.
+    ///
+    //------------------------------------------------------------------------------
+    template<class id_type,
+             class graph_type = graph::Graph<id_type>>
+    class batch_flow
+    {
+        using vertex_type           = component::Vertex<id_type>;
+        using list_type             = implementation::CompressedList<id_type>;
+        using network_type          = residual_network<id_type>;
+
+        //------------------------------------------------------------------------------
+        /// @brief Flow state private to one thread.
+        //------------------------------------------------------------------------------
+        struct overlay
+        {
+            std::vector<int> residuals;
+            level_graph levels;
+        };
+
+    public:
+
+        using pair_type             = std::pair<vertex_type, vertex_type>;
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Value constructor.
+        ///
+        /// Snapshot of the graph is taken here.
+        ///
+        /// @param[in] pGraph Input graph pointer.
+        ///
+        /// @param[in] threads Thread count, 0 - hardware concurrency.
+        ///
+        //------------------------------------------------------------------------------
+        batch_flow(const graph_type* pGraph,
+                   int threads = 0);
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Snapshot constructor.
+        ///
+        /// Results refer to snapshot handles (see reordering.hpp).
+        ///
+        /// @param[in] snapshot Graph snapshot, get_graph() returns nullptr.
+        ///
+        /// @param[in] threads Thread count, 0 - hardware concurrency.
+        ///
+        //------------------------------------------------------------------------------
+        explicit batch_flow(list_type snapshot,
+                            int threads = 0);
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Set thread count.
+        ///
+        /// @param[in] threads Thread count, 0 - hardware concurrency.
+        ///
+        //------------------------------------------------------------------------------
+        void
+        set_threads(int threads);
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Solve every pair.
+        ///
+        /// All pairs are resolved before any thread starts, so an unknown
+        /// vertex throws std::out_of_range with no work done.
+        ///
+        /// @param[in] pairs Source-sink pairs.
+        ///
+        /// @param[in] cuts Build minimum cut of every pair.
+        ///
+        //------------------------------------------------------------------------------
+        void
+        run(const std::vector<pair_type>& pairs,
+            bool cuts = false);
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Get algorithm execution results.
+        ///
+        /// @return Maximum flow value of every pair, in pair order.
+        ///
+        //------------------------------------------------------------------------------
+        const std::vector<int>&
+        get() const;
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Get minimum cut of a pair.
+        ///
+        /// @param[in] index Pair index in last run, which must have requested cuts.
+        ///
+        /// @return Cut, capacity equal to pair flow.
+        ///
+        //------------------------------------------------------------------------------
+        const min_cut<id_type>&
+        get_min_cut(std::size_t index) const;
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Get algorithm's graph.
+        ///
+        /// @return Pointer to graph object.
+        ///
+        //------------------------------------------------------------------------------
+        const graph_type*
+        get_graph() const;
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Heap memory used by algorithm state.
+        ///
+        /// @return Memory usage report, snapshot, network and overlays are auxiliary.
+        ///
+        //------------------------------------------------------------------------------
+        utility::memory_usage
+        MemoryUsage() const;
+
+    private:
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Solve one pair on an overlay.
+        ///
+        /// @param[in,out] state Overlay of calling thread.
+        ///
+        /// @param[in] source Source handle.
+        ///
+        /// @param[in] sink Sink handle.
+        ///
+        /// @return Maximum flow value; source side stays leveled in state.levels.
+        ///
+        //------------------------------------------------------------------------------
+        int
+        solve(overlay& state,
+              int source,
+              int sink) const;
+
+    private:
+
+        /// @brief Pairs taken by a thread at once.
+        static constexpr std::size_t chunk_ = 4;
+
+        /// @brief Thread count.
+        int threads_;
+
+        /// @brief Graph snapshot.
+        list_type snapshot_;
+
+        /// @brief Shared arc topology and capacities, never pushed on.
+        network_type network_;
+
+        /// @brief Flow of every pair of last run.
+        std::vector<int> flows_;
+
+        /// @brief Cut of every pair of last run, empty if not requested.
+        std::vector<min_cut<id_type>> cuts_;
+
+        /// @brief Per-thread flow state.
+        std::vector<overlay> overlays_;
+
+        /// @brief Graph.
+        const graph_type* pGraph_;
+    };
+
+} // namespace algorithm
+
+
+//------------------------------------------------------------------------------
+// Function declarations
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Variable definitions
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Function definitions
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+//
+// Algorithms namespace
+//
+//------------------------------------------------------------------------------
+namespace algorithm
+{
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type, class graph_type>
+    batch_flow<id_type, graph_type>::batch_flow(const graph_type* pGraph,
+                                                int threads) :
+            batch_flow(list_type(*pGraph), threads)
+    {
+        pGraph_ = pGraph;
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type, class graph_type>
+    batch_flow<id_type, graph_type>::batch_flow(
+            typename batch_flow<id_type, graph_type>::list_type snapshot,
+            int threads) : threads_(0),
+                           snapshot_(std::move(snapshot)),
+                           network_(snapshot_),
+                           pGraph_(nullptr)
+    {
+        set_threads(threads);
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type, class graph_type>
+    void
+    batch_flow<id_type, graph_type>::set_threads(int threads)
+    {
+        if (threads < 0)
+        {
+            throw std::invalid_argument("Thread count must not be negative");
+        }
+
+        threads_ = (threads == 0) ?
+            std::max(1, static_cast<int>(std::thread::hardware_concurrency())) : threads;
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  Overlays are created lazily, one per thread actually used. Calling
+    //  thread is thread 0 of the team.
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type, class graph_type>
+    void
+    batch_flow<id_type, graph_type>::run(
+            const std::vector<typename batch_flow<id_type, graph_type>::pair_type>& pairs,
+            bool cuts)
+    {
+        std::vector<std::pair<int, int>> handles;
+        handles.reserve(pairs.size());
+        for (const auto& pair : pairs)
+        {
+            handles.emplace_back(snapshot_.GetHandle(pair.first), snapshot_.GetHandle(pair.second));
+        }
+
+        flows_.assign(pairs.size(), 0);
+        cuts_.clear();
+        if (cuts)
+        {
+            cuts_.resize(pairs.size());
+        }
+
+        // no point in more threads than pairs
+        const std::size_t chunks = (pairs.size() + chunk_ - 1) / chunk_;
+        const int threads = static_cast<int>(std::max<std::size_t>(1, std::min<std::size_t>(threads_, chunks)));
+        while (static_cast<int>(overlays_.size()) < threads)
+        {
+            overlay state;
+            state.residuals.resize(network_.arc_count());
+            state.levels.resize(network_.size());
+            overlays_.push_back(std::move(state));
+        }
+
+        std::atomic<std::size_t> cursor(0);
+
+        auto worker = [&](int thread)
+        {
+            overlay& state = overlays_[thread];
+
+            for (;;)
+            {
+                std::size_t begin = cursor.fetch_add(chunk_, std::memory_order_relaxed);
+                if (begin >= handles.size())
+                {
+                    break;
+                }
+                std::size_t end = std::min(begin + chunk_, handles.size());
+
+                for (std::size_t index = begin; index < end; ++index)
+                {
+                    flows_[index] = solve(state, handles[index].first, handles[index].second);
+                    if (cuts)
+                    {
+                        to_min_cut(snapshot_,
+                                   [&state](int handle) { return state.levels.is_leveled(handle); },
+                                   cuts_[index]);
+                    }
+                }
+            }
+        };
+
+        std::vector<std::thread> team;
+        for (int thread = 1; thread < threads; ++thread)
+        {
+            team.emplace_back(worker, thread);
+        }
+        worker(0);
+        for (auto& member : team)
+        {
+            member.join();
+        }
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type, class graph_type>
+    const std::vector<int>&
+    batch_flow<id_type, graph_type>::get() const
+    {
+        return flows_;
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  Bounds checked: cuts_ is empty unless the last run requested cuts.
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type, class graph_type>
+    const min_cut<id_type>&
+    batch_flow<id_type, graph_type>::get_min_cut(std::size_t index) const
+    {
+        return cuts_.at(index);
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type, class graph_type>
+    const graph_type*
+    batch_flow<id_type, graph_type>::get_graph() const
+    {
+        return pGraph_;
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type, class graph_type>
+    utility::memory_usage
+    batch_flow<id_type, graph_type>::MemoryUsage() const
+    {
+        utility::memory_usage usage;
+        usage.auxiliary = snapshot_.MemoryUsage().total() +
+                          network_.memory() +
+                          utility::vector_bytes(flows_) +
+                          utility::vector_bytes(cuts_) +
+                          utility::vector_bytes(overlays_);
+
+        for (const auto& cut : cuts_)
+        {
+            usage.auxiliary += utility::vector_bytes(cut.source_side) +
+                               utility::vector_bytes(cut.edges);
+        }
+        for (const auto& state : overlays_)
+        {
+            usage.auxiliary += utility::vector_bytes(state.residuals) +
+                               state.levels.memory();
+        }
+
+        return usage;
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type, class graph_type>
+    int
+    batch_flow<id_type, graph_type>::solve(overlay& state,
+                                           int source,
+                                           int sink) const
+    {
+        // nothing to send, nothing to cut
+        if (source == sink)
+        {
+            state.levels.clear();
+            return 0;
+        }
+
+        for (int arc = 0; arc < network_.arc_count(); ++arc)
+        {
+            state.residuals[arc] = network_.capacity(arc);
+        }
+
+        overlay_network<id_type> network(&network_, &state.residuals);
+        return state.levels.run(network, source, sink);
+    }
+
+} // namespace algorithm
+
+
+
+#endif // GRAPH_LIB_ALGORITHM_FLOW_BATCH_FLOW_HPP
+//==============================================================================
+// End of batch-flow.hpp
+// (note: the newline at the end of the file is intentional)
+//==============================================================================
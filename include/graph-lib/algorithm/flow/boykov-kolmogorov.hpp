@@ -0,0 +1,803 @@
+//==============================================================================
+///
+/// @file boykov-kolmogorov.hpp
+///
+/// @brief Boykov-Kolmogorov maximum flow.
+///
+/// Two search trees over the residual network, one rooted at source and one
+/// at sink, grow towards each other from a FIFO of active vertices until an
+/// arc joins them; the joined path is augmented. Saturated tree arcs cut
+/// their child subtrees loose as orphans, and instead of searching again
+/// from scratch each orphan looks for a new parent in its tree among its
+/// neighbours. A candidate parent counts only if its path to the root is
+/// intact; the check walks up and caches distance to root with a per
+/// augmentation timestamp, so each vertex is walked once per augmentation.
+/// The closest valid parent wins. An orphan finding none becomes free, its
+/// children turn orphans and its tree neighbours become active again.
+/// Paths found need not be shortest, but on grids with terminal arcs, the
+/// segmentation workload, trees stay shallow and are mostly reused, which
+/// beats the level graph rebuilds of dinic in practice.
+/// Flow lives in the residual network shared with the other flow engines.
+/// Once no path is left, source tree vertices are the source side of a
+/// minimum cut. The engine is built from a graph or from a snapshot, such
+/// as one made by make_grid_network() (see grid-network.hpp).
+///
+/// The documentation is available on the following website:
+/// <website>
+///
+/// Support email: <email>
+///
+//==============================================================================
+
+//==============================================================================
+// Include only once
+//
+#ifndef GRAPH_LIB_ALGORITHM_FLOW_BOYKOV_KOLMOGOROV_HPP
+#define GRAPH_LIB_ALGORITHM_FLOW_BOYKOV_KOLMOGOROV_HPP
+
+
+//------------------------------------------------------------------------------
+// Include files
+//------------------------------------------------------------------------------
+// System
+// e.g.: #include <iostream>        // stdout
+#include <vector>
+#include <deque>
+#include <limits>                   // std::numeric_limits
+#include <algorithm>                // std::min, std::fill
+#include <utility>                  // std::move
+
+// Project
+// e.g.: #include "IncludeFile.h"   // MyType_t
+#include "graph-lib/component/vertex.hpp"                   // component::Vertex
+#include "graph-lib/implementation/compressed-list.hpp"     // implementation::CompressedList
+#include "graph-lib/utility/memory.hpp"                     // utility::memory_usage
+#include "graph-lib/algorithm/flow/residual-network.hpp"    // algorithm::residual_network
+#include "graph-lib/algorithm/flow/min-cut.hpp"             // algorithm::min_cut
+
+
+//------------------------------------------------------------------------------
+// Global references
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Constants
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Macros
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Forward declarations
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Data types
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+/// @brief Common graph algorithms.
+///
+//------------------------------------------------------------------------------
+namespace algorithm
+{
+    //------------------------------------------------------------------------------
+    /// @brief Boykov-Kolmogorov algorithm implementation.
+    ///
+    //------------------------------------------------------------------------------
+    template<class id_type,
+             class graph_type = graph::Graph<id_type>>
+    class boykov_kolmogorov
+    {
+        using vertex_type           = component::Vertex<id_type>;
+        using list_type             = implementation::CompressedList<id_type>;
+        using network_type          = residual_network<id_type>;
+
+    public:
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Value constructor.
+        ///
+        /// Snapshot of the graph is taken here.
+        ///
+        /// @param[in] pGraph Input graph pointer.
+        ///
+        //------------------------------------------------------------------------------
+        boykov_kolmogorov(const graph_type* pGraph);
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Snapshot constructor.
+        ///
+        /// @param[in] snapshot Network snapshot, get_graph() returns nullptr.
+        ///
+        //------------------------------------------------------------------------------
+        explicit boykov_kolmogorov(list_type snapshot);
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Execute Boykov-Kolmogorov algorithm.
+        ///
+        /// @param[in] source Flow start vertex.
+        ///
+        /// @param[in] sink Flow end vertex.
+        ///
+        //------------------------------------------------------------------------------
+        void
+        run(const vertex_type& source,
+            const vertex_type& sink);
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Get algorithm execution results.
+        ///
+        /// @return Maximum flow value.
+        ///
+        //------------------------------------------------------------------------------
+        int
+        get() const;
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Get cut separating source tree from the rest.
+        ///
+        /// @return Minimum cut of last run, empty when source and sink coincide.
+        ///
+        //------------------------------------------------------------------------------
+        min_cut<id_type>
+        get_min_cut() const;
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Get flow between two vertices.
+        ///
+        /// @param[in] from Edge start vertex.
+        ///
+        /// @param[in] to Edge end vertex.
+        ///
+        /// @return Flow summed over all arcs from -> to.
+        ///
+        //------------------------------------------------------------------------------
+        int
+        get_flow(const vertex_type& from,
+                 const vertex_type& to) const;
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Get snapshot defining handles and arcs.
+        ///
+        /// @return Graph snapshot.
+        ///
+        //------------------------------------------------------------------------------
+        const list_type&
+        get_snapshot() const;
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Get algorithm's graph.
+        ///
+        /// @return Pointer to graph object, nullptr if built from a snapshot.
+        ///
+        //------------------------------------------------------------------------------
+        const graph_type*
+        get_graph() const;
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Heap memory used by algorithm state.
+        ///
+        /// @return Memory usage report, snapshot and residual network are auxiliary.
+        ///
+        //------------------------------------------------------------------------------
+        utility::memory_usage
+        MemoryUsage() const;
+
+    private:
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Tree parent of a vertex.
+        ///
+        /// @param[in] vertex Vertex handle with a parent arc.
+        ///
+        /// @return Parent handle.
+        ///
+        //------------------------------------------------------------------------------
+        int
+        parent(int vertex) const;
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Mark vertex active unless it already is.
+        ///
+        /// @param[in] vertex Vertex handle.
+        ///
+        //------------------------------------------------------------------------------
+        void
+        activate(int vertex);
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Cut vertex loose from its parent.
+        ///
+        /// @param[in] vertex Vertex handle.
+        ///
+        //------------------------------------------------------------------------------
+        void
+        make_orphan(int vertex);
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Grow trees from active vertices until they touch.
+        ///
+        /// @return Residual arc from source tree to sink tree, -1 if none.
+        ///
+        //------------------------------------------------------------------------------
+        int
+        grow();
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Augment along path through joining arc, collect orphans.
+        ///
+        /// @param[in] middle Residual arc from source tree to sink tree.
+        ///
+        /// @return Flow sent.
+        ///
+        //------------------------------------------------------------------------------
+        int
+        augment(int middle);
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Distance from vertex to its tree root.
+        ///
+        /// @param[in] vertex Vertex handle in a tree.
+        ///
+        /// @return Distance, -1 if path to root passes an orphan.
+        ///
+        //------------------------------------------------------------------------------
+        int
+        root_distance(int vertex);
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Find new parents for all orphans or free them.
+        ///
+        //------------------------------------------------------------------------------
+        void
+        adopt();
+
+    private:
+
+        /// @brief Vertex in no tree.
+        static constexpr char free_ = 0;
+
+        /// @brief Vertex in source tree.
+        static constexpr char source_tree_ = 1;
+
+        /// @brief Vertex in sink tree.
+        static constexpr char sink_tree_ = 2;
+
+        /// @brief Parent arc of tree roots.
+        static constexpr int terminal_ = -1;
+
+        /// @brief Parent arc of orphans.
+        static constexpr int orphan_ = -2;
+
+        /// @brief Max flow possible to send over the network.
+        int flow_;
+
+        /// @brief Augmentation count, stamps cached root distances.
+        int time_;
+
+        /// @brief Graph snapshot.
+        list_type snapshot_;
+
+        /// @brief Residual arcs and flow.
+        network_type network_;
+
+        /// @brief Tree of every vertex.
+        std::vector<char> trees_;
+
+        /// @brief Residual arc between vertex and parent, directed away from root.
+        std::vector<int> parentArcs_;
+
+        /// @brief Cached root distances.
+        std::vector<int> distances_;
+
+        /// @brief Augmentation in which root distance was cached.
+        std::vector<int> timestamps_;
+
+        /// @brief Active flag of every vertex.
+        std::vector<char> active_;
+
+        /// @brief Active vertices; freed ones are dropped when reached.
+        std::deque<int> actives_;
+
+        /// @brief Orphans waiting for adoption.
+        std::deque<int> orphans_;
+
+        /// @brief Graph.
+        const graph_type* pGraph_;
+    };
+
+} // namespace algorithm
+
+
+//------------------------------------------------------------------------------
+// Function declarations
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Variable definitions
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Function definitions
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+//
+// Algorithms namespace
+//
+//------------------------------------------------------------------------------
+namespace algorithm
+{
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type, class graph_type>
+    boykov_kolmogorov<id_type, graph_type>::boykov_kolmogorov(const graph_type* pGraph) :
+            boykov_kolmogorov(list_type(*pGraph))
+    {
+        pGraph_ = pGraph;
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type, class graph_type>
+    boykov_kolmogorov<id_type, graph_type>::boykov_kolmogorov(
+            typename boykov_kolmogorov<id_type, graph_type>::list_type snapshot) : flow_(0),
+                                                                                   time_(0),
+                                                                                   snapshot_(std::move(snapshot)),
+                                                                                   network_(snapshot_),
+                                                                                   trees_(snapshot_.Size(), free_),
+                                                                                   parentArcs_(snapshot_.Size(), orphan_),
+                                                                                   distances_(snapshot_.Size(), 0),
+                                                                                   timestamps_(snapshot_.Size(), 0),
+                                                                                   active_(snapshot_.Size(), 0),
+                                                                                   pGraph_(nullptr)
+    {   }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type, class graph_type>
+    void
+    boykov_kolmogorov<id_type, graph_type>::run(
+            const typename boykov_kolmogorov<id_type, graph_type>::vertex_type& source,
+            const typename boykov_kolmogorov<id_type, graph_type>::vertex_type& sink)
+    {
+        const int sourceHandle = snapshot_.GetHandle(source);
+        const int sinkHandle = snapshot_.GetHandle(sink);
+
+        network_.reset();
+        flow_ = 0;
+        time_ = 0;
+        std::fill(trees_.begin(), trees_.end(), free_);
+        std::fill(parentArcs_.begin(), parentArcs_.end(), orphan_);
+        std::fill(timestamps_.begin(), timestamps_.end(), 0);
+        std::fill(active_.begin(), active_.end(), 0);
+        actives_.clear();
+        orphans_.clear();
+
+        // nothing to send, nothing to cut
+        if (sourceHandle == sinkHandle)
+        {
+            return;
+        }
+
+        trees_[sourceHandle] = source_tree_;
+        trees_[sinkHandle] = sink_tree_;
+        parentArcs_[sourceHandle] = terminal_;
+        parentArcs_[sinkHandle] = terminal_;
+        distances_[sourceHandle] = 0;
+        distances_[sinkHandle] = 0;
+        activate(sourceHandle);
+        activate(sinkHandle);
+
+        for (int middle = grow(); middle >= 0; middle = grow())
+        {
+            flow_ += augment(middle);
+            adopt();
+        }
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type, class graph_type>
+    int
+    boykov_kolmogorov<id_type, graph_type>::get() const
+    {
+        return flow_;
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  Vertices reachable from source over residual arcs are exactly the
+    //  source tree once growth stops: every one of them would be active.
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type, class graph_type>
+    min_cut<id_type>
+    boykov_kolmogorov<id_type, graph_type>::get_min_cut() const
+    {
+        min_cut<id_type> cut;
+        to_min_cut(snapshot_, [this](int handle) { return trees_[handle] == source_tree_; }, cut);
+
+        return cut;
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type, class graph_type>
+    int
+    boykov_kolmogorov<id_type, graph_type>::get_flow(
+            const typename boykov_kolmogorov<id_type, graph_type>::vertex_type& from,
+            const typename boykov_kolmogorov<id_type, graph_type>::vertex_type& to) const
+    {
+        const int fromHandle = snapshot_.GetHandle(from);
+        const int toHandle = snapshot_.GetHandle(to);
+
+        int flow = 0;
+        for (int arc = snapshot_.Begin(fromHandle); arc < snapshot_.End(fromHandle); ++arc)
+        {
+            if (snapshot_.Target(arc) == toHandle)
+            {
+                flow += network_.flow(network_.forward_arc(arc));
+            }
+        }
+
+        return flow;
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type, class graph_type>
+    const typename boykov_kolmogorov<id_type, graph_type>::list_type&
+    boykov_kolmogorov<id_type, graph_type>::get_snapshot() const
+    {
+        return snapshot_;
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type, class graph_type>
+    const graph_type*
+    boykov_kolmogorov<id_type, graph_type>::get_graph() const
+    {
+        return pGraph_;
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type, class graph_type>
+    utility::memory_usage
+    boykov_kolmogorov<id_type, graph_type>::MemoryUsage() const
+    {
+        utility::memory_usage usage;
+        usage.auxiliary = snapshot_.MemoryUsage().total() +
+                          network_.memory() +
+                          utility::vector_bytes(trees_) +
+                          utility::vector_bytes(parentArcs_) +
+                          utility::vector_bytes(distances_) +
+                          utility::vector_bytes(timestamps_) +
+                          utility::vector_bytes(active_) +
+                          actives_.size() * sizeof(int) +
+                          orphans_.size() * sizeof(int);
+
+        return usage;
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  Source tree parent arcs run parent -> vertex, sink tree parent arcs
+    //  vertex -> parent: both carry flow from source towards sink.
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type, class graph_type>
+    int
+    boykov_kolmogorov<id_type, graph_type>::parent(int vertex) const
+    {
+        int arc = parentArcs_[vertex];
+        return (trees_[vertex] == source_tree_) ? network_.head(network_.reverse(arc)) : network_.head(arc);
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type, class graph_type>
+    void
+    boykov_kolmogorov<id_type, graph_type>::activate(int vertex)
+    {
+        if (!active_[vertex])
+        {
+            active_[vertex] = 1;
+            actives_.push_back(vertex);
+        }
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type, class graph_type>
+    void
+    boykov_kolmogorov<id_type, graph_type>::make_orphan(int vertex)
+    {
+        parentArcs_[vertex] = orphan_;
+        orphans_.push_back(vertex);
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  Front vertex stays active while it joins the trees, so growth resumes
+    //  from it after augmentation.
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type, class graph_type>
+    int
+    boykov_kolmogorov<id_type, graph_type>::grow()
+    {
+        while (!actives_.empty())
+        {
+            int current = actives_.front();
+            char tree = trees_[current];
+
+            if (tree != free_)
+            {
+                for (int arc = network_.begin(current); arc < network_.end(current); ++arc)
+                {
+                    // arc in flow direction: away from source, towards sink
+                    int forward = (tree == source_tree_) ? arc : network_.reverse(arc);
+                    if (network_.residual(forward) == 0)
+                    {
+                        continue;
+                    }
+
+                    int target = network_.head(arc);
+                    if (trees_[target] == free_)
+                    {
+                        trees_[target] = tree;
+                        parentArcs_[target] = forward;
+                        distances_[target] = distances_[current] + 1;
+                        timestamps_[target] = timestamps_[current];
+                        activate(target);
+                    }
+                    else if (trees_[target] != tree)
+                    {
+                        return forward;
+                    }
+                }
+            }
+
+            actives_.pop_front();
+            active_[current] = 0;
+        }
+
+        return -1;
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type, class graph_type>
+    int
+    boykov_kolmogorov<id_type, graph_type>::augment(int middle)
+    {
+        ++time_;
+
+        const int first = network_.head(network_.reverse(middle));
+        const int last = network_.head(middle);
+
+        int bottleneck = network_.residual(middle);
+        for (int vertex = first; parentArcs_[vertex] != terminal_; vertex = parent(vertex))
+        {
+            bottleneck = std::min(bottleneck, network_.residual(parentArcs_[vertex]));
+        }
+        for (int vertex = last; parentArcs_[vertex] != terminal_; vertex = parent(vertex))
+        {
+            bottleneck = std::min(bottleneck, network_.residual(parentArcs_[vertex]));
+        }
+
+        network_.push(middle, bottleneck);
+        for (int vertex = first; parentArcs_[vertex] != terminal_; )
+        {
+            int arc = parentArcs_[vertex];
+            int next = parent(vertex);
+            network_.push(arc, bottleneck);
+            if (network_.residual(arc) == 0)
+            {
+                make_orphan(vertex);
+            }
+            vertex = next;
+        }
+        for (int vertex = last; parentArcs_[vertex] != terminal_; )
+        {
+            int arc = parentArcs_[vertex];
+            int next = parent(vertex);
+            network_.push(arc, bottleneck);
+            if (network_.residual(arc) == 0)
+            {
+                make_orphan(vertex);
+            }
+            vertex = next;
+        }
+
+        return bottleneck;
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  First pass walks up to a root or to a vertex checked during this
+    //  augmentation, second pass caches distances along the walked path.
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type, class graph_type>
+    int
+    boykov_kolmogorov<id_type, graph_type>::root_distance(int vertex)
+    {
+        int distance = 0;
+        int current = vertex;
+        while (true)
+        {
+            if (timestamps_[current] == time_)
+            {
+                distance += distances_[current];
+                break;
+            }
+            if (parentArcs_[current] == terminal_)
+            {
+                timestamps_[current] = time_;
+                distances_[current] = 0;
+                break;
+            }
+            if (parentArcs_[current] == orphan_)
+            {
+                return -1;
+            }
+
+            ++distance;
+            current = parent(current);
+        }
+
+        int remaining = distance;
+        for (current = vertex; timestamps_[current] != time_; current = parent(current))
+        {
+            timestamps_[current] = time_;
+            distances_[current] = remaining--;
+        }
+
+        return distance;
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type, class graph_type>
+    void
+    boykov_kolmogorov<id_type, graph_type>::adopt()
+    {
+        while (!orphans_.empty())
+        {
+            int orphan = orphans_.front();
+            orphans_.pop_front();
+
+            const char tree = trees_[orphan];
+
+            // closest neighbour still rooted, over an arc in flow direction
+            int bestArc = -1;
+            int bestDistance = std::numeric_limits<int>::max();
+            for (int arc = network_.begin(orphan); arc < network_.end(orphan); ++arc)
+            {
+                int candidate = network_.head(arc);
+                int forward = (tree == source_tree_) ? network_.reverse(arc) : arc;
+                if ((trees_[candidate] != tree) || (network_.residual(forward) == 0))
+                {
+                    continue;
+                }
+
+                int distance = root_distance(candidate);
+                if ((distance >= 0) && (distance < bestDistance))
+                {
+                    bestArc = forward;
+                    bestDistance = distance;
+                }
+            }
+
+            if (bestArc >= 0)
+            {
+                parentArcs_[orphan] = bestArc;
+                timestamps_[orphan] = time_;
+                distances_[orphan] = bestDistance + 1;
+                continue;
+            }
+
+            // no parent: free vertex, release children, reactivate neighbours
+            for (int arc = network_.begin(orphan); arc < network_.end(orphan); ++arc)
+            {
+                int neighbour = network_.head(arc);
+                if (trees_[neighbour] != tree)
+                {
+                    continue;
+                }
+
+                int forward = (tree == source_tree_) ? network_.reverse(arc) : arc;
+                if (network_.residual(forward) > 0)
+                {
+                    activate(neighbour);
+                }
+
+                int childArc = (tree == source_tree_) ? arc : network_.reverse(arc);
+                if (parentArcs_[neighbour] == childArc)
+                {
+                    make_orphan(neighbour);
+                }
+            }
+            trees_[orphan] = free_;
+        }
+    }
+
+} // namespace algorithm
+
+
+
+#endif // GRAPH_LIB_ALGORITHM_FLOW_BOYKOV_KOLMOGOROV_HPP
+//==============================================================================
+// End of boykov-kolmogorov.hpp
+// (note: the newline at the end of the file is intentional)
+//==============================================================================
@@ -6,6 +6,19 @@
 ///
 /// <Detailed description>
 ///
+/// Flow lives in a residual network with paired reverse arcs, built from a
+/// snapshot of the graph taken at construction and owned by the object, so
+/// flow sent earlier in a run can be cancelled by a later path. The graph
+/// is only read, so solvers on one graph may run concurrently and no run
+/// overwrites the result of another. Flow of every snapshot arc is copied
+/// into an overlay indexed by snapshot arc once a run ends.
+/// Phases (level BFS, then blocking flow by an iterative DFS with current
+/// arcs, O(VE) per phase) are those of level_graph, shared with the other
+/// Dinic based engines.
+/// Last level BFS of a run fails to reach sink; vertices it leveled are the
+/// source side of a minimum cut, returned by get_min_cut() at the cost of
+/// one pass over their arcs and no further search.
+///
 /// The documentation is available on the following website:
 /// <website>
 ///
@@ -25,12 +38,18 @@
 //------------------------------------------------------------------------------
 // System
 // e.g.: #include <iostream>        // stdout
-#include <limits>               // std::numeric_limits
+#include <vector>
+#include <utility>              // std::move
 
 // Project
 // e.g.: #include "IncludeFile.h"   // MyType_t
 #include "graph-lib/component/vertex.hpp"   // component::Vertex
 #include "graph-lib/utility/print.hpp"      // Debug printing
+#include "graph-lib/utility/memory.hpp"     // utility::memory_usage
+#include "graph-lib/implementation/compressed-list.hpp"    // implementation::CompressedList
+#include "graph-lib/algorithm/flow/residual-network.hpp"    // algorithm::residual_network
+#include "graph-lib/algorithm/flow/level-graph.hpp"         // algorithm::level_graph
+#include "graph-lib/algorithm/flow/min-cut.hpp"             // algorithm::min_cut
 
 //------------------------------------------------------------------------------
 // Global references
@@ -70,15 +89,13 @@ namespace algorithm
     /// @brief Dinic algorithm implementation.
     ///
     //------------------------------------------------------------------------------
-    template<class id_type>
+    template<class id_type,
+             class graph_type = graph::Graph<id_type>>
     class dinic
     {
         using vertex_type           = component::Vertex<id_type>;
-        using edge_type             = component::Edge<id_type>;
-        using level_structure       = std::map<vertex_type,
-                                               int,
-                                               component::support::vertex_less<id_type>>;
-        using graph_type            = graph::Graph<id_type>;
+        using list_type             = implementation::CompressedList<id_type>;
+        using network_type          = residual_network<id_type>;
 
     public:
 
@@ -86,14 +103,27 @@ namespace algorithm
         ///
         /// @brief Value constructor.
         ///
+        /// Snapshot of the graph is taken here.
+        ///
         /// @param[in] pGraph Input graph pointer.
         ///
         //------------------------------------------------------------------------------
-        dinic(graph_type * const pGraph);
+        dinic(const graph_type* pGraph);
 
         //------------------------------------------------------------------------------
         ///
-        /// @brief Execute Edmonds-Karp algorithm.
+        /// @brief Snapshot constructor.
+        ///
+        /// Results refer to snapshot handles (see reordering.hpp).
+        ///
+        /// @param[in] snapshot Graph snapshot, get_graph() returns nullptr.
+        ///
+        //------------------------------------------------------------------------------
+        explicit dinic(list_type snapshot);
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Execute Dinic algorithm.
         ///
         /// @param[in] source Flow start vertex.
         ///
@@ -108,7 +138,7 @@ namespace algorithm
         ///
         /// @brief Get algorithm execution results.
         ///
-        /// @return Reference to parent structure defining order.
+        /// @return Flow value.
         ///
         //------------------------------------------------------------------------------
         int
@@ -116,52 +146,75 @@ namespace algorithm
 
         //------------------------------------------------------------------------------
         ///
-        /// @brief Get algorithm's graph.
+        /// @brief Get minimum cut of last run.
         ///
-        /// @return Reference to graph object.
+        /// Source side holds vertices reachable from source over residual
+        /// arcs once flow is maximum, so cut edges are saturated, no flow
+        /// returns across the cut and its capacity equals get(). Empty when
+        /// source and sink coincide.
+        ///
+        /// @return Cut of last run.
         ///
         //------------------------------------------------------------------------------
-        graph_type * const
-        get_graph();
-
+        min_cut<id_type>
+        get_min_cut() const;
 
-    private:
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Get flow of every edge.
+        ///
+        /// @return Flow per snapshot arc.
+        ///
+        //------------------------------------------------------------------------------
+        const std::vector<int>&
+        get_edge_flows() const;
 
         //------------------------------------------------------------------------------
         ///
-        /// @brief Reset level structure.
+        /// @brief Get flow between two vertices.
+        ///
+        /// @param[in] from Edge start vertex.
+        ///
+        /// @param[in] to Edge end vertex.
+        ///
+        /// @return Flow summed over all arcs from -> to.
         ///
         //------------------------------------------------------------------------------
-        void
-        flush_structure();
+        int
+        get_flow(const vertex_type& from,
+                 const vertex_type& to) const;
 
         //------------------------------------------------------------------------------
         ///
-        /// @brief Compute level graph.
+        /// @brief Get snapshot defining handles and arcs.
         ///
-        /// @param[in] root Start vertex.
+        /// @return Graph snapshot.
         ///
         //------------------------------------------------------------------------------
-        void
-        compute_level_structure(const vertex_type& root);
+        const list_type&
+        get_snapshot() const;
 
         //------------------------------------------------------------------------------
         ///
-        /// @brief Send max possible flow from source to sink on a path.
+        /// @brief Get algorithm's graph.
         ///
-        /// @param[in] vertex Current vertex.
+        /// @return Pointer to graph object.
         ///
-        /// @param[in] sink End vertex.
+        //------------------------------------------------------------------------------
+        const graph_type*
+        get_graph() const;
+
+        //------------------------------------------------------------------------------
         ///
-        /// @param[in] flow Current flow.
+        /// @brief Heap memory used by algorithm state.
         ///
-        /// @return Improving flow.
+        /// @return Memory usage report, snapshot, network and level graph are auxiliary.
         ///
         //------------------------------------------------------------------------------
-        int
-        send_flow(const vertex_type& vertex,
-                  const vertex_type& sink,
-                  int flow);
+        utility::memory_usage
+        MemoryUsage() const;
+
+    private:
 
         //------------------------------------------------------------------------------
         ///
@@ -183,16 +236,20 @@ namespace algorithm
         /// @brief Max flow possible to send over the network.
         int flow_;
 
-        //------------------------------------------------------------------------------
-        /// @brief Level graph structure.
-        ///
-        /// Contains <vertex, <predecessor, vertex_level>> key-value pairs.
-        ///
-        //------------------------------------------------------------------------------
-        level_structure level_;
+        /// @brief Graph snapshot.
+        list_type snapshot_;
+
+        /// @brief Residual arcs and flow.
+        network_type network_;
+
+        /// @brief Level graph of last phase.
+        level_graph levels_;
+
+        /// @brief Flow of every snapshot arc.
+        std::vector<int> edgeFlows_;
 
         /// @brief Graph.
-        graph_type * const pGraph_;
+        const graph_type* pGraph_;
     };
 
 } // namespace algorithm
@@ -225,21 +282,11 @@ namespace algorithm
     //  <Design related information>
     //
     //------------------------------------------------------------------------------
-    template<class id_type>
-    dinic<id_type>::dinic(
-            typename dinic<id_type>::graph_type * const pGraph) : pGraph_(pGraph),
-                                                                  flow_(0)
+    template<class id_type, class graph_type>
+    dinic<id_type, graph_type>::dinic(const graph_type* pGraph) :
+            dinic(list_type(*pGraph))
     {
-        // initialize edge flow
-        std::for_each(pGraph_->begin(), pGraph_->end(),
-            [](auto& tuple)
-            {
-                std::for_each(tuple.second.begin(), tuple.second.end(),
-                    [](auto& edge)
-                    {
-                        edge.SetFlow(0);
-                    });
-            });
+        pGraph_ = pGraph;
     }
 
     //------------------------------------------------------------------------------
@@ -247,11 +294,26 @@ namespace algorithm
     //  <Design related information>
     //
     //------------------------------------------------------------------------------
-    template<class id_type>
+    template<class id_type, class graph_type>
+    dinic<id_type, graph_type>::dinic(
+            typename dinic<id_type, graph_type>::list_type snapshot) : flow_(0),
+                                                                       snapshot_(std::move(snapshot)),
+                                                                       network_(snapshot_),
+                                                                       levels_(snapshot_.Size()),
+                                                                       edgeFlows_(snapshot_.EdgeCount(), 0),
+                                                                       pGraph_(nullptr)
+    {   }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type, class graph_type>
     void
-    dinic<id_type>::run(
-            const typename dinic<id_type>::vertex_type& source,
-            const typename dinic<id_type>::vertex_type& sink)
+    dinic<id_type, graph_type>::run(
+            const typename dinic<id_type, graph_type>::vertex_type& source,
+            const typename dinic<id_type, graph_type>::vertex_type& sink)
     {
         dinic_inner(source, sink);
         //dfs_stack(root);
@@ -262,9 +324,9 @@ namespace algorithm
     //  <Design related information>
     //
     //------------------------------------------------------------------------------
-    template<class id_type>
+    template<class id_type, class graph_type>
     int
-    dinic<id_type>::get() const
+    dinic<id_type, graph_type>::get() const
     {
         return flow_;
     }
@@ -274,11 +336,14 @@ namespace algorithm
     //  <Design related information>
     //
     //------------------------------------------------------------------------------
-    template<class id_type>
-    typename dinic<id_type>::graph_type * const
-    dinic<id_type>::get_graph()
+    template<class id_type, class graph_type>
+    min_cut<id_type>
+    dinic<id_type, graph_type>::get_min_cut() const
     {
-        return pGraph_;
+        min_cut<id_type> cut;
+        to_min_cut(snapshot_, [this](int handle) { return levels_.is_leveled(handle); }, cut);
+
+        return cut;
     }
 
     //------------------------------------------------------------------------------
@@ -286,17 +351,11 @@ namespace algorithm
     //  <Design related information>
     //
     //------------------------------------------------------------------------------
-    template<class id_type>
-    void
-    dinic<id_type>::flush_structure()
+    template<class id_type, class graph_type>
+    const std::vector<int>&
+    dinic<id_type, graph_type>::get_edge_flows() const
     {
-        // initialize parent structure: insert <vertex, large_const> entries,
-        // where vertex - vertex of the graph
-        std::for_each(pGraph_->cbegin(), pGraph_->cend(),
-            [this](const auto& tuple)
-            {
-                level_[tuple.first] = std::numeric_limits<int>::max();
-            });
+        return edgeFlows_;
     }
 
     //------------------------------------------------------------------------------
@@ -304,55 +363,25 @@ namespace algorithm
     //  <Design related information>
     //
     //------------------------------------------------------------------------------
-    template<class id_type>
-    void
-    dinic<id_type>::compute_level_structure(
-            const typename dinic<id_type>::vertex_type& root)
+    template<class id_type, class graph_type>
+    int
+    dinic<id_type, graph_type>::get_flow(
+            const typename dinic<id_type, graph_type>::vertex_type& from,
+            const typename dinic<id_type, graph_type>::vertex_type& to) const
     {
-        // reset level structure
-        flush_structure();
-
-        // run bfs on vertices
-        int currentLevel = 0;
-        std::queue<typename dinic<id_type>::vertex_type> queue;
-        queue.push(root);
-        level_[root] = currentLevel;
+        const int fromHandle = snapshot_.GetHandle(from);
+        const int toHandle = snapshot_.GetHandle(to);
 
-        while (!queue.empty())
+        int flow = 0;
+        for (int arc = snapshot_.Begin(fromHandle); arc < snapshot_.End(fromHandle); ++arc)
         {
-            auto current = queue.front();
-            queue.pop();
-
-            //DEBUG
-            std::cout << "Current vertex in level BFS is ";
-            print_vertex<id_type>(current);
-            std::cout << '\n';
-            //DEBUG
-
-            for (auto& neighbourEdge : pGraph_->GetNeighbours(current))
+            if (snapshot_.Target(arc) == toHandle)
             {
-                // check if vertex level can be updated
-                if ( (level_.at(current) + 1 < level_.at(neighbourEdge.GetVertex(1))) &&
-                     (neighbourEdge.GetCapacity() - neighbourEdge.GetFlow() > 0) )
-                {
-                    //DEBUG
-                    std::cout << "Current valid neighbour connection is ";
-                    print_edge<id_type>(neighbourEdge);
-                    std::cout << '\n';
-                    //DEBUG
-
-                    // update level
-                    level_[neighbourEdge.GetVertex(1)] = level_.at(current) + 1;
-                    // enqueue
-                    queue.push(neighbourEdge.GetVertex(1));
-                }
+                flow += edgeFlows_[arc];
             }
         }
 
-        //DEBUG
-        std::cout << "Computed level structure is \n";
-        print_level_structure<id_type>(level_);
-        //DEBUG
+        return flow;
     }
 
     //------------------------------------------------------------------------------
@@ -360,119 +389,77 @@ namespace algorithm
     //  <Design related information>
     //
     //------------------------------------------------------------------------------
-    template<class id_type>
-    int
-    dinic<id_type>::send_flow(
-            const typename dinic<id_type>::vertex_type& vertex,
-            const typename dinic<id_type>::vertex_type& sink,
-            int flow)
+    template<class id_type, class graph_type>
+    const typename dinic<id_type, graph_type>::list_type&
+    dinic<id_type, graph_type>::get_snapshot() const
     {
-        // no path exists
-        if (flow == 0)
-        {
-            return 0;
-        }
-        // reached destination
-        if (vertex == sink)
-        {
-            return flow;
-        }
-
-        // proceed with children
-        for (auto& neighbourEdge : pGraph_->GetNeighbours(vertex))
-        {
-            auto& neighbourVertex = neighbourEdge.GetVertex(1);
-            int residualCapacity = neighbourEdge.GetCapacity() - neighbourEdge.GetFlow();
-
-            //DEBUG
-            std::cout << "Current neighbour is ";
-            print_vertex<id_type>(neighbourVertex);
-            std::cout << '\n';
-            //DEBUG
-
-            // neighbour to skip
-            if ( (level_.at(neighbourVertex) != level_.at(vertex) + 1) ||
-                 (residualCapacity < 1) )
-            {
-                //DEBUG
-                std::cout << "  Neighbour is not valid\n";
-                //DEBUG
-
-                continue;
-            }
-
-            // try to send flow to a valid neighbour
-            int tempFlow = send_flow(neighbourVertex, sink,
-                    std::min(flow, residualCapacity));
-
-            //DEBUG
-            std::cout << "  Neighbour flow computed is " << tempFlow << '\n';
-            //DEBUG
-
-            // failed
-            if (tempFlow == 0)
-            {
-                continue;
-            }
-
-            //DEBUG
-            std::cout << "Update edge flow\n";
-            //DEBUG
+        return snapshot_;
+    }
 
-            // update connection edge flow
-            neighbourEdge.SetFlow(neighbourEdge.GetFlow() + tempFlow);
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type, class graph_type>
+    const graph_type*
+    dinic<id_type, graph_type>::get_graph() const
+    {
+        return pGraph_;
+    }
 
-            return tempFlow;
-        }
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type, class graph_type>
+    utility::memory_usage
+    dinic<id_type, graph_type>::MemoryUsage() const
+    {
+        utility::memory_usage usage;
+        usage.auxiliary = snapshot_.MemoryUsage().total() +
+                          network_.memory() +
+                          levels_.memory() +
+                          utility::vector_bytes(edgeFlows_);
 
-        return 0;
+        return usage;
     }
 
-
     //------------------------------------------------------------------------------
     //
     //  <Design related information>
     //
     //------------------------------------------------------------------------------
-    template<class id_type>
+    template<class id_type, class graph_type>
     void
-    dinic<id_type>::dinic_inner(
-            const typename dinic<id_type>::vertex_type& source,
-            const typename dinic<id_type>::vertex_type& sink)
+    dinic<id_type, graph_type>::dinic_inner(
+            const typename dinic<id_type, graph_type>::vertex_type& source,
+            const typename dinic<id_type, graph_type>::vertex_type& sink)
     {
-        int flow = 0;
-        int blockingFlow = 0;
+        const int sourceHandle = snapshot_.GetHandle(source);
+        const int sinkHandle = snapshot_.GetHandle(sink);
 
-        while (true)
-        {
-            // construct level graph
-            compute_level_structure(source);
+        // every run starts from zero flow
+        network_.reset();
 
-            // no path to sink exists - exit
-            if (level_.at(sink) == std::numeric_limits<int>::max())
-            {
-                break;
-            }
-
-            //DEBUG
-            std::cout << "Level Structure computed - Find blocking flow\n";
-            //DEBUG
-
-            // find blocking flow f'
-            blockingFlow = std::numeric_limits<int>::max();
-            while ((blockingFlow = send_flow(source, sink, std::numeric_limits<int>::max())) != 0)
-            {
-                //DEBUG
-                std::cout << "Current found blocking flow is " << blockingFlow << '\n';
-                //DEBUG
-
-                // increment total flow f
-                flow += blockingFlow;
-            }
+        // nothing to send, nothing to cut
+        if (sourceHandle == sinkHandle)
+        {
+            levels_.clear();
+            flow_ = 0;
+        }
+        else
+        {
+            flow_ = levels_.run(network_, sourceHandle, sinkHandle);
         }
 
-        flow_ = flow;
+        for (int edgeArc = 0; edgeArc < network_.edge_count(); ++edgeArc)
+        {
+            edgeFlows_[edgeArc] = network_.flow(network_.forward_arc(edgeArc));
+        }
     }
+
 } // namespace algorithm
 
 
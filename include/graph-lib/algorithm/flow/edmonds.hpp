@@ -4,7 +4,20 @@
 ///
 /// @brief Edmonds-Karp max flow in a graph.
 ///
-/// <Detailed description>
+/// Augmenting paths are shortest paths found by BFS over the residual
+/// network shared with the other flow engines, built from a snapshot of
+/// the graph taken at construction, reverse arcs included, so flow sent
+/// earlier in a run can be cancelled by a later path. BFS records the
+/// residual arc reaching every labeled vertex, so parallel edges are told
+/// apart. The graph is only read, so solvers on one graph may run
+/// concurrently. Resulting flow is copied into an overlay owned by this
+/// object and indexed by snapshot arc.
+/// Capacity scaling mode (traits::augment_mode::capacity_scaling) follows
+/// only arcs with residual at least delta; delta starts at the largest
+/// power of two not above the largest capacity and is halved once no path
+/// is left, so large bottlenecks go first and each phase finds O(E) paths
+/// - O(E^2 log U) overall, independent of how far apart capacities are.
+/// Shortest path mode is the single phase of delta 1.
 ///
 /// The documentation is available on the following website:
 /// <website>
@@ -26,11 +39,18 @@
 // System
 // e.g.: #include <iostream>        // stdout
 #include <limits>               // std::numeric_limits
+#include <vector>
+#include <algorithm>            // std::min, std::max
+#include <utility>              // std::move
 
 // Project
 // e.g.: #include "IncludeFile.h"   // MyType_t
-#include "graph-lib/algorithm/traversal/bfs.hpp"    // algorithm::bfs
+#include "graph-lib/component/vertex.hpp"           // component::Vertex
 #include "graph-lib/utility/print.hpp"              // Debug printing
+#include "graph-lib/utility/memory.hpp"             // utility::memory_usage
+#include "graph-lib/utility/epoch.hpp"              // utility::epoch_marks
+#include "graph-lib/implementation/compressed-list.hpp"    // implementation::CompressedList
+#include "graph-lib/algorithm/flow/residual-network.hpp"    // algorithm::residual_network
 
 
 //------------------------------------------------------------------------------
@@ -67,16 +87,35 @@
 //------------------------------------------------------------------------------
 namespace algorithm
 {
+    //------------------------------------------------------------------------------
+    /// @brief Algorithm traits.
+    //------------------------------------------------------------------------------
+    namespace traits
+    {
+        //------------------------------------------------------------------------------
+        /// @brief Encapsulates augmenting path strategies.
+        //------------------------------------------------------------------------------
+        enum class augment_mode
+        {
+            /// @brief Shortest paths over residual arcs.
+            shortest_path,
+            /// @brief Shortest paths over residual arcs of at least delta, delta halved per phase.
+            capacity_scaling
+        };
+
+    } // namespace traits
+
     //------------------------------------------------------------------------------
     /// @brief Edmonds-Karp algorithm implementation.
     ///
     //------------------------------------------------------------------------------
-    template<class id_type>
+    template<class id_type,
+             class graph_type = graph::Graph<id_type>>
     class edmonds_karp
     {
         using vertex_type           = component::Vertex<id_type>;
-        using edge_type             = component::Edge<id_type>;
-        using graph_type            = graph::Graph<id_type>;
+        using list_type             = implementation::CompressedList<id_type>;
+        using network_type          = residual_network<id_type>;
 
     public:
 
@@ -84,10 +123,23 @@ namespace algorithm
         ///
         /// @brief Value constructor.
         ///
+        /// Snapshot of the graph is taken here.
+        ///
         /// @param[in] pGraph Input graph pointer.
         ///
         //------------------------------------------------------------------------------
-        edmonds_karp(graph_type * const pGraph);
+        edmonds_karp(const graph_type* pGraph);
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Snapshot constructor.
+        ///
+        /// Results refer to snapshot handles (see reordering.hpp).
+        ///
+        /// @param[in] snapshot Graph snapshot, get_graph() returns nullptr.
+        ///
+        //------------------------------------------------------------------------------
+        explicit edmonds_karp(list_type snapshot);
 
         //------------------------------------------------------------------------------
         ///
@@ -97,10 +149,13 @@ namespace algorithm
         ///
         /// @param[in] sink Flow end vertex.
         ///
+        /// @param[in] mode Strategy.
+        ///
         //------------------------------------------------------------------------------
         void
         run(const vertex_type& source,
-            const vertex_type& sink);
+            const vertex_type& sink,
+            traits::augment_mode mode = traits::augment_mode::shortest_path);
 
         //------------------------------------------------------------------------------
         ///
@@ -112,39 +167,132 @@ namespace algorithm
         int
         get() const;
 
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Get flow of every edge.
+        ///
+        /// @return Flow per snapshot arc.
+        ///
+        //------------------------------------------------------------------------------
+        const std::vector<int>&
+        get_edge_flows() const;
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Get flow between two vertices.
+        ///
+        /// @param[in] from Edge start vertex.
+        ///
+        /// @param[in] to Edge end vertex.
+        ///
+        /// @return Flow summed over all arcs from -> to.
+        ///
+        //------------------------------------------------------------------------------
+        int
+        get_flow(const vertex_type& from,
+                 const vertex_type& to) const;
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Get snapshot defining handles and arcs.
+        ///
+        /// @return Graph snapshot.
+        ///
+        //------------------------------------------------------------------------------
+        const list_type&
+        get_snapshot() const;
+
         //------------------------------------------------------------------------------
         ///
         /// @brief Get algorithm's graph.
         ///
-        /// @return Reference to graph object.
+        /// @return Pointer to graph object.
         ///
         //------------------------------------------------------------------------------
         const graph_type*
         get_graph() const;
 
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Heap memory used by algorithm state.
+        ///
+        /// One BFS workspace serves all augmenting path searches of a run,
+        /// report contains it, the snapshot, the residual network and the
+        /// flow overlay as auxiliary memory.
+        ///
+        /// @return Memory usage report.
+        ///
+        //------------------------------------------------------------------------------
+        utility::memory_usage
+        MemoryUsage() const;
 
     private:
 
         //------------------------------------------------------------------------------
         ///
-        /// @brief Reset parent structure.
+        /// @brief Search shortest path over residual arcs of at least delta.
+        ///
+        /// @param[in] source Source handle.
+        ///
+        /// @param[in] sink Sink handle.
+        ///
+        /// @param[in] delta Least residual followed.
+        ///
+        /// @return True if sink was reached, path is left in parentArcs_.
         ///
         //------------------------------------------------------------------------------
-        void
-        flush_structure();
+        bool
+        scaling_path(int source,
+                     int sink,
+                     int delta);
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Augment along shortest paths of residual at least delta.
+        ///
+        /// @param[in] source Source handle.
+        ///
+        /// @param[in] sink Sink handle.
+        ///
+        /// @param[in] delta Least residual followed.
+        ///
+        /// @return Flow sent.
+        ///
+        //------------------------------------------------------------------------------
+        int
+        augment(int source,
+                int sink,
+                int delta);
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Capacity scaling implementation.
+        ///
+        /// @param[in] source Source handle.
+        ///
+        /// @param[in] sink Sink handle.
+        ///
+        /// @return Flow sent.
+        ///
+        //------------------------------------------------------------------------------
+        int
+        capacity_scaling(int source,
+                         int sink);
 
         //------------------------------------------------------------------------------
         ///
         /// @brief Edmonds-Karp algorithm implementation.
         ///
-        /// @param[in] source Flow start vertex.
+        /// @param[in] source Source handle.
         ///
-        /// @param[in] sink Flow end vertex.
+        /// @param[in] sink Sink handle.
+        ///
+        /// @return Flow sent.
         ///
         //------------------------------------------------------------------------------
-        void
-        edmonds_karp_inner(const vertex_type& source,
-                           const vertex_type& sink);
+        int
+        edmonds_karp_inner(int source,
+                           int sink);
 
 
 
@@ -153,8 +301,26 @@ namespace algorithm
         /// @brief Max flow possible to send over the network.
         int flow_;
 
+        /// @brief Graph snapshot.
+        list_type snapshot_;
+
+        /// @brief Flow of every snapshot arc.
+        std::vector<int> edgeFlows_;
+
+        /// @brief Residual arcs and flow.
+        network_type network_;
+
+        /// @brief Residual arc reaching every labeled vertex.
+        std::vector<int> parentArcs_;
+
+        /// @brief Vertices labeled by current search.
+        utility::epoch_marks labeled_;
+
+        /// @brief Search queue, consumed by index.
+        std::vector<int> queue_;
+
         /// @brief Graph pointer.
-        graph_type * const pGraph_;
+        const graph_type* pGraph_;
     };
 
 } // namespace algorithm
@@ -189,12 +355,11 @@ namespace algorithm
     //  <Design related information>
     //
     //------------------------------------------------------------------------------
-    template<class id_type>
-    edmonds_karp<id_type>::edmonds_karp(
-            typename edmonds_karp<id_type>::graph_type * const pGraph) : pGraph_(pGraph),
-                                                                         flow_(0)
+    template<class id_type, class graph_type>
+    edmonds_karp<id_type, graph_type>::edmonds_karp(const graph_type* pGraph) :
+            edmonds_karp(list_type(*pGraph))
     {
-        flush_structure();
+        pGraph_ = pGraph;
     }
 
     //------------------------------------------------------------------------------
@@ -202,14 +367,48 @@ namespace algorithm
     //  <Design related information>
     //
     //------------------------------------------------------------------------------
-    template<class id_type>
+    template<class id_type, class graph_type>
+    edmonds_karp<id_type, graph_type>::edmonds_karp(
+            typename edmonds_karp<id_type, graph_type>::list_type snapshot) : flow_(0),
+                                                                              snapshot_(std::move(snapshot)),
+                                                                              edgeFlows_(snapshot_.EdgeCount(), 0),
+                                                                              network_(snapshot_),
+                                                                              parentArcs_(network_.size(), -1),
+                                                                              labeled_(network_.size()),
+                                                                              pGraph_(nullptr)
+    {   }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type, class graph_type>
     void
-    edmonds_karp<id_type>::run(
-            const typename edmonds_karp<id_type>::vertex_type& source,
-            const typename edmonds_karp<id_type>::vertex_type& sink)
+    edmonds_karp<id_type, graph_type>::run(
+            const typename edmonds_karp<id_type, graph_type>::vertex_type& source,
+            const typename edmonds_karp<id_type, graph_type>::vertex_type& sink,
+            traits::augment_mode mode)
     {
-        edmonds_karp_inner(source, sink);
-        //dfs_stack(root);
+        const int sourceHandle = snapshot_.GetHandle(source);
+        const int sinkHandle = snapshot_.GetHandle(sink);
+
+        // every run starts from zero flow
+        network_.reset();
+
+        if (mode == traits::augment_mode::capacity_scaling)
+        {
+            flow_ = capacity_scaling(sourceHandle, sinkHandle);
+        }
+        else
+        {
+            flow_ = edmonds_karp_inner(sourceHandle, sinkHandle);
+        }
+
+        for (int edgeArc = 0; edgeArc < network_.edge_count(); ++edgeArc)
+        {
+            edgeFlows_[edgeArc] = network_.flow(network_.forward_arc(edgeArc));
+        }
     }
 
     //------------------------------------------------------------------------------
@@ -217,9 +416,9 @@ namespace algorithm
     //  <Design related information>
     //
     //------------------------------------------------------------------------------
-    template<class id_type>
+    template<class id_type, class graph_type>
     int
-    edmonds_karp<id_type>::get() const
+    edmonds_karp<id_type, graph_type>::get() const
     {
         return flow_;
     }
@@ -229,11 +428,11 @@ namespace algorithm
     //  <Design related information>
     //
     //------------------------------------------------------------------------------
-    template<class id_type>
-    const typename edmonds_karp<id_type>::graph_type*
-    edmonds_karp<id_type>::get_graph() const
+    template<class id_type, class graph_type>
+    const std::vector<int>&
+    edmonds_karp<id_type, graph_type>::get_edge_flows() const
     {
-        return pGraph_;
+        return edgeFlows_;
     }
 
     //------------------------------------------------------------------------------
@@ -241,108 +440,198 @@ namespace algorithm
     //  <Design related information>
     //
     //------------------------------------------------------------------------------
-    template<class id_type>
-    void
-    edmonds_karp<id_type>::flush_structure()
+    template<class id_type, class graph_type>
+    int
+    edmonds_karp<id_type, graph_type>::get_flow(
+            const typename edmonds_karp<id_type, graph_type>::vertex_type& from,
+            const typename edmonds_karp<id_type, graph_type>::vertex_type& to) const
     {
-        // initialize edge flow
-        std::for_each(pGraph_->begin(), pGraph_->end(),
-            [](auto& tuple)
+        const int fromHandle = snapshot_.GetHandle(from);
+        const int toHandle = snapshot_.GetHandle(to);
+
+        int flow = 0;
+        for (int arc = snapshot_.Begin(fromHandle); arc < snapshot_.End(fromHandle); ++arc)
+        {
+            if (snapshot_.Target(arc) == toHandle)
             {
-                std::for_each(tuple.second.begin(), tuple.second.end(),
-                    [](auto& edge)
-                    {
-                        edge.SetFlow(0);
-                    });
-            });
+                flow += edgeFlows_[arc];
+            }
+        }
+
+        return flow;
     }
 
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type, class graph_type>
+    const typename edmonds_karp<id_type, graph_type>::list_type&
+    edmonds_karp<id_type, graph_type>::get_snapshot() const
+    {
+        return snapshot_;
+    }
 
     //------------------------------------------------------------------------------
     //
     //  <Design related information>
     //
     //------------------------------------------------------------------------------
-    template<class id_type>
-    void
-    edmonds_karp<id_type>::edmonds_karp_inner(
-            const typename edmonds_karp<id_type>::vertex_type& source,
-            const typename edmonds_karp<id_type>::vertex_type& sink)
+    template<class id_type, class graph_type>
+    const graph_type*
+    edmonds_karp<id_type, graph_type>::get_graph() const
     {
-        int flow = 0;
-        int incrementingFlow = 0;
+        return pGraph_;
+    }
 
-        while (true)
-        {
-            //DEBUG
-            std::cout << "Run BFS\n";
-            //DEBUG
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type, class graph_type>
+    utility::memory_usage
+    edmonds_karp<id_type, graph_type>::MemoryUsage() const
+    {
+        utility::memory_usage usage;
+        usage.auxiliary = snapshot_.MemoryUsage().total() +
+                          utility::vector_bytes(edgeFlows_) +
+                          network_.memory() +
+                          utility::vector_bytes(parentArcs_) +
+                          labeled_.memory() +
+                          utility::vector_bytes(queue_);
+
+        return usage;
+    }
 
-            // run bfs_flow()
-            bfs<id_type> bfsObj(pGraph_);
-            bfsObj.run(source, "flow");
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type, class graph_type>
+    bool
+    edmonds_karp<id_type, graph_type>::scaling_path(int source,
+                                                    int sink,
+                                                    int delta)
+    {
+        labeled_.reset();
+        queue_.clear();
 
-            //DEBUG
-            print_traversal_result<id_type>(bfsObj.get());
-            //DEBUG
+        queue_.push_back(source);
+        labeled_.set(source);
 
-            // augmenting path found
-            if (bfsObj.get().at(sink) != component::Vertex<id_type>::invalidInstance_)
+        for (std::size_t head = 0; head < queue_.size(); ++head)
+        {
+            int current = queue_[head];
+
+            for (int arc = network_.begin(current); arc < network_.end(current); ++arc)
             {
-                //DEBUG
-                std::cout << "Compute network flow increase\n";
-                //DEBUG
-
-                incrementingFlow = std::numeric_limits<int>::max();
-                // determine max possible increase to send via augmenting path edges found by BFS
-                auto current = sink;
-                while (current != source)
+                int target = network_.head(arc);
+                if (!labeled_.test(target) && (network_.residual(arc) >= delta))
                 {
-                    // fetch connection edge
-                    auto& edge = pGraph_->GetEdge(
-                        bfsObj.get().at(current), current);
+                    labeled_.set(target);
+                    parentArcs_[target] = arc;
+                    if (target == sink)
+                    {
+                        return true;
+                    }
+                    queue_.push_back(target);
+                }
+            }
+        }
 
-                    // check if incrementing flow can be updated
-                    incrementingFlow = std::min(
-                                incrementingFlow,
-                                edge.GetCapacity() - edge.GetFlow());
+        return false;
+    }
 
-                    // update current
-                    current = edge.GetVertex(0);
-                }
+    //------------------------------------------------------------------------------
+    //
+    //  Path is walked back from sink over recorded arcs twice: once for its
+    //  bottleneck, once to push it.
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type, class graph_type>
+    int
+    edmonds_karp<id_type, graph_type>::augment(int source,
+                                               int sink,
+                                               int delta)
+    {
+        int flow = 0;
+        while (scaling_path(source, sink, delta))
+        {
+            int bottleneck = std::numeric_limits<int>::max();
+            for (int current = sink; current != source; )
+            {
+                int arc = parentArcs_[current];
+                bottleneck = std::min(bottleneck, network_.residual(arc));
+                current = network_.head(network_.reverse(arc));
+            }
 
-                //DEBUG
-                std::cout << "Improving flow has value: " << incrementingFlow << '\n';
-                //DEBUG
+            for (int current = sink; current != source; )
+            {
+                int arc = parentArcs_[current];
+                network_.push(arc, bottleneck);
+                current = network_.head(network_.reverse(arc));
+            }
 
-                // increment flow in all edges of augmenting path found by BFS
-                current = sink;
-                while (current != source)
-                {
-                    auto& edge = pGraph_->GetEdge(bfsObj.get().at(current), current);
-                    // increment flow
-                    edge.SetFlow(edge.GetFlow() + incrementingFlow);
+            flow += bottleneck;
+        }
 
-                    // update current
-                    current = edge.GetVertex(0);
-                }
+        return flow;
+    }
 
-                // update
-                flow += incrementingFlow;
+    //------------------------------------------------------------------------------
+    //
+    //  Once no path of residual delta is left, flow is within E * delta of
+    //  maximum, which bounds augmentations of the next phase by O(E).
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type, class graph_type>
+    int
+    edmonds_karp<id_type, graph_type>::capacity_scaling(int source,
+                                                        int sink)
+    {
+        int largest = 0;
+        for (int edgeArc = 0; edgeArc < network_.edge_count(); ++edgeArc)
+        {
+            largest = std::max(largest, network_.capacity(network_.forward_arc(edgeArc)));
+        }
 
-                //DEBUG
-                print_graph<id_type>(*pGraph_);
-                //DEBUG
-            }
-            else
-            {
-                // algorithm finish
-                break;
-            }
+        int delta = 1;
+        while (delta <= largest / 2)
+        {
+            delta *= 2;
+        }
+
+        int flow = 0;
+        for (; (source != sink) && (largest > 0) && (delta > 0); delta /= 2)
+        {
+            flow += augment(source, sink, delta);
+        }
+
+        return flow;
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type, class graph_type>
+    int
+    edmonds_karp<id_type, graph_type>::edmonds_karp_inner(int source,
+                                                          int sink)
+    {
+        // nothing to send
+        if (source == sink)
+        {
+            return 0;
         }
 
-        flow_ = flow;
+        return augment(source, sink, 1);
     }
+
 } // namespace algorithm
 
 
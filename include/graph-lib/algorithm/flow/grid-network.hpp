@@ -0,0 +1,261 @@
+//==============================================================================
+///
+/// @file grid-network.hpp
+///
+/// @brief Direct construction of grid flow networks.
+///
+/// Segmentation style networks are grids of pixels with 4 or 8 neighbour
+/// arcs plus terminal arcs from source and to sink. Building them through
+/// graph AddEdge calls costs a tree lookup and a node allocation per arc,
+/// and the snapshot is then copied out of the graph again. The grid shape
+/// is known in advance, so make_grid_network() reserves the CSR arrays of
+/// the snapshot from it and fills them in one pass over the pixels. The
+/// result is accepted by flow engines taking a snapshot.
+///
+/// Vertex ids: pixel (row, column) is row * columns + column, source is
+/// rows * columns, sink is rows * columns + 1.
+///
+/// The documentation is available on the following website:
+/// <website>
+///
+/// Support email: <email>
+///
+//==============================================================================
+
+//==============================================================================
+// Include only once
+//
+#ifndef GRAPH_LIB_ALGORITHM_FLOW_GRID_NETWORK_HPP
+#define GRAPH_LIB_ALGORITHM_FLOW_GRID_NETWORK_HPP
+
+
+//------------------------------------------------------------------------------
+// Include files
+//------------------------------------------------------------------------------
+// System
+// e.g.: #include <iostream>        // stdout
+#include <cstddef>                  // std::size_t
+#include <vector>
+#include <utility>                  // std::move
+#include <stdexcept>                // std::invalid_argument
+
+// Project
+// e.g.: #include "IncludeFile.h"   // MyType_t
+#include "graph-lib/component/vertex.hpp"                   // component::Vertex
+#include "graph-lib/implementation/compressed-list.hpp"     // implementation::CompressedList
+
+
+//------------------------------------------------------------------------------
+// Global references
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Constants
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Macros
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Forward declarations
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Data types
+//------------------------------------------------------------------------------
+namespace algorithm
+{
+    //------------------------------------------------------------------------------
+    /// @brief Algorithm traits.
+    //------------------------------------------------------------------------------
+    namespace traits
+    {
+        //------------------------------------------------------------------------------
+        /// @brief Encapsulates grid neighbourhoods.
+        //------------------------------------------------------------------------------
+        enum class grid_connectivity
+        {
+            /// @brief Horizontal and vertical neighbours.
+            four,
+            /// @brief Horizontal, vertical and diagonal neighbours.
+            eight
+        };
+
+    } // namespace traits
+
+} // namespace algorithm
+
+
+//------------------------------------------------------------------------------
+// Function declarations
+//------------------------------------------------------------------------------
+namespace algorithm
+{
+    //------------------------------------------------------------------------------
+    /// @brief Build snapshot of a grid network.
+    ///
+    /// Arcs of zero capacity are left out. Every arc has weight 1.
+    ///
+    /// @param[in] rows Grid rows.
+    ///
+    /// @param[in] columns Grid columns.
+    ///
+    /// @param[in] connectivity Neighbourhood.
+    ///
+    /// @param[in] sourceCapacities Source -> pixel capacity, per pixel id.
+    ///
+    /// @param[in] sinkCapacities Pixel -> sink capacity, per pixel id.
+    ///
+    /// @param[in] neighbourCapacity Callable, capacity of arc between two pixel ids.
+    ///
+    /// @return Snapshot with int vertex ids.
+    ///
+    /// @throw std::invalid_argument Negative size or terminal capacities not
+    ///        given for every pixel.
+    ///
+    //------------------------------------------------------------------------------
+    template<class capacity_type>
+    implementation::CompressedList<int>
+    make_grid_network(int rows,
+                      int columns,
+                      traits::grid_connectivity connectivity,
+                      const std::vector<int>& sourceCapacities,
+                      const std::vector<int>& sinkCapacities,
+                      capacity_type neighbourCapacity);
+
+} // namespace algorithm
+
+
+//------------------------------------------------------------------------------
+// Variable definitions
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Function definitions
+//------------------------------------------------------------------------------
+namespace algorithm
+{
+    //------------------------------------------------------------------------------
+    //
+    //  Neighbour arcs of a pixel are in fixed offset order, terminal arc to
+    //  sink comes last. Source arcs follow pixel order.
+    //
+    //------------------------------------------------------------------------------
+    template<class capacity_type>
+    implementation::CompressedList<int>
+    make_grid_network(int rows,
+                      int columns,
+                      traits::grid_connectivity connectivity,
+                      const std::vector<int>& sourceCapacities,
+                      const std::vector<int>& sinkCapacities,
+                      capacity_type neighbourCapacity)
+    {
+        if ((rows < 0) || (columns < 0))
+        {
+            throw std::invalid_argument("Grid size must not be negative");
+        }
+
+        const int pixels = rows * columns;
+        if ((static_cast<int>(sourceCapacities.size()) != pixels) ||
+            (static_cast<int>(sinkCapacities.size()) != pixels))
+        {
+            throw std::invalid_argument("Terminal capacities must be given for every pixel");
+        }
+
+        static const int rowSteps[] = {-1, 0, 0, 1, -1, -1, 1, 1};
+        static const int columnSteps[] = {0, -1, 1, 0, -1, 1, -1, 1};
+        const int steps = (connectivity == traits::grid_connectivity::four) ? 4 : 8;
+
+        const int sink = pixels + 1;
+
+        std::vector<component::Vertex<int>> vertices;
+        vertices.reserve(pixels + 2);
+        for (int id = 0; id < pixels + 2; ++id)
+        {
+            vertices.emplace_back(id);
+        }
+
+        std::vector<int> offsets;
+        std::vector<int> targets;
+        std::vector<int> capacities;
+        offsets.reserve(pixels + 3);
+        targets.reserve(static_cast<std::size_t>(pixels) * (steps + 2));
+        capacities.reserve(static_cast<std::size_t>(pixels) * (steps + 2));
+
+        offsets.push_back(0);
+        for (int row = 0; row < rows; ++row)
+        {
+            for (int column = 0; column < columns; ++column)
+            {
+                const int pixel = row * columns + column;
+
+                for (int step = 0; step < steps; ++step)
+                {
+                    int nextRow = row + rowSteps[step];
+                    int nextColumn = column + columnSteps[step];
+                    if ((nextRow < 0) || (nextRow >= rows) || (nextColumn < 0) || (nextColumn >= columns))
+                    {
+                        continue;
+                    }
+
+                    int next = nextRow * columns + nextColumn;
+                    int capacity = neighbourCapacity(pixel, next);
+                    if (capacity > 0)
+                    {
+                        targets.push_back(next);
+                        capacities.push_back(capacity);
+                    }
+                }
+
+                if (sinkCapacities[pixel] > 0)
+                {
+                    targets.push_back(sink);
+                    capacities.push_back(sinkCapacities[pixel]);
+                }
+
+                offsets.push_back(static_cast<int>(targets.size()));
+            }
+        }
+
+        for (int pixel = 0; pixel < pixels; ++pixel)
+        {
+            if (sourceCapacities[pixel] > 0)
+            {
+                targets.push_back(pixel);
+                capacities.push_back(sourceCapacities[pixel]);
+            }
+        }
+        offsets.push_back(static_cast<int>(targets.size()));
+
+        // sink has no outgoing arcs
+        offsets.push_back(static_cast<int>(targets.size()));
+
+        std::vector<int> weights(targets.size(), 1);
+
+        return implementation::CompressedList<int>(std::move(vertices),
+                                                   std::move(offsets),
+                                                   std::move(targets),
+                                                   std::move(weights),
+                                                   std::move(capacities));
+    }
+
+} // namespace algorithm
+
+
+
+#endif // GRAPH_LIB_ALGORITHM_FLOW_GRID_NETWORK_HPP
+//==============================================================================
+// End of grid-network.hpp
+// (note: the newline at the end of the file is intentional)
+//==============================================================================
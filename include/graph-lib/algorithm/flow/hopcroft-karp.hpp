@@ -0,0 +1,577 @@
+//==============================================================================
+///
+/// @file hopcroft-karp.hpp
+///
+/// @brief Hopcroft-Karp maximum bipartite matching.
+///
+/// Matching runs directly on a bipartite graph given its left side: arcs
+/// leaving left vertices are the candidate pairs, arcs leaving right
+/// vertices (e.g. the reverse halves of undirected edges) are ignored. No
+/// super source, super sink or flow values are built, as a unit capacity
+/// flow encoding would need; state is a few dense int arrays indexed by
+/// left position or snapshot handle.
+/// A greedy pass matches what it can at once. Every phase then runs a BFS
+/// from free left vertices over alternating paths, layering left vertices
+/// up to the first layer that sees a free right vertex, and an iterative
+/// DFS with current arcs collecting a maximal set of vertex disjoint
+/// shortest augmenting paths in that layering. Dead ends leave the layering
+/// for the rest of the phase. O(sqrt(V)) phases of O(E) each - O(E sqrt(V)).
+///
+/// The documentation is available on the following website:
+/// <website>
+///
+/// Support email: <email>
+///
+//==============================================================================
+
+//==============================================================================
+// Include only once
+//
+#ifndef GRAPH_LIB_ALGORITHM_FLOW_HOPCROFT_KARP_HPP
+#define GRAPH_LIB_ALGORITHM_FLOW_HOPCROFT_KARP_HPP
+
+
+//------------------------------------------------------------------------------
+// Include files
+//------------------------------------------------------------------------------
+// System
+// e.g.: #include <iostream>        // stdout
+#include <cstddef>                  // std::size_t
+#include <vector>
+#include <utility>                  // std::pair, std::move
+#include <limits>                   // std::numeric_limits
+#include <algorithm>                // std::fill
+#include <stdexcept>                // std::invalid_argument
+
+// Project
+// e.g.: #include "IncludeFile.h"   // MyType_t
+#include "graph-lib/component/vertex.hpp"                   // component::Vertex
+#include "graph-lib/implementation/compressed-list.hpp"     // implementation::CompressedList
+#include "graph-lib/utility/memory.hpp"                     // utility::memory_usage
+
+
+//------------------------------------------------------------------------------
+// Global references
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Constants
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Macros
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Forward declarations
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Data types
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+/// @brief Common graph algorithms.
+///
+//------------------------------------------------------------------------------
+namespace algorithm
+{
+    //------------------------------------------------------------------------------
+    /// @brief Hopcroft-Karp algorithm implementation.
+    ///
+    //------------------------------------------------------------------------------
+    template<class id_type,
+             class graph_type = graph::Graph<id_type>>
+    class hopcroft_karp
+    {
+        using vertex_type           = component::Vertex<id_type>;
+        using list_type             = implementation::CompressedList<id_type>;
+
+    public:
+
+        using pair_type             = std::pair<vertex_type, vertex_type>;
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Value constructor.
+        ///
+        /// Snapshot of the graph is taken here.
+        ///
+        /// @param[in] pGraph Input graph pointer.
+        ///
+        //------------------------------------------------------------------------------
+        hopcroft_karp(const graph_type* pGraph);
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Snapshot constructor.
+        ///
+        /// Results refer to snapshot handles (see reordering.hpp).
+        ///
+        /// @param[in] snapshot Graph snapshot, get_graph() returns nullptr.
+        ///
+        //------------------------------------------------------------------------------
+        explicit hopcroft_karp(list_type snapshot);
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Execute Hopcroft-Karp algorithm.
+        ///
+        /// @param[in] left Left side vertices, every other vertex is right side.
+        ///
+        /// @throw std::invalid_argument Left vertex listed twice or an arc
+        ///        joins two left vertices.
+        ///
+        //------------------------------------------------------------------------------
+        void
+        run(const std::vector<vertex_type>& left);
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Get algorithm execution results.
+        ///
+        /// @return Matching size.
+        ///
+        //------------------------------------------------------------------------------
+        int
+        get() const;
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Get matched pairs.
+        ///
+        /// @return (left, right) pairs in left side order.
+        ///
+        //------------------------------------------------------------------------------
+        std::vector<pair_type>
+        get_matching() const;
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Get algorithm's graph.
+        ///
+        /// @return Pointer to graph object.
+        ///
+        //------------------------------------------------------------------------------
+        const graph_type*
+        get_graph() const;
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Heap memory used by algorithm state.
+        ///
+        /// @return Memory usage report, snapshot and matching arrays are auxiliary.
+        ///
+        //------------------------------------------------------------------------------
+        utility::memory_usage
+        MemoryUsage() const;
+
+    private:
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Layer left vertices by alternating path length from free ones.
+        ///
+        /// @return True if a free right vertex was reached.
+        ///
+        //------------------------------------------------------------------------------
+        bool
+        compute_layers();
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Search shortest augmenting path from a free left vertex and flip it.
+        ///
+        /// @param[in] root Free left position.
+        ///
+        /// @return True if matching grew.
+        ///
+        //------------------------------------------------------------------------------
+        bool
+        augment(int root);
+
+    private:
+
+        /// @brief Distance of left vertices outside the layering.
+        static constexpr int unlayered_ = std::numeric_limits<int>::max();
+
+        /// @brief Matching size.
+        int size_;
+
+        /// @brief Layer of free right vertices found by last BFS.
+        int limit_;
+
+        /// @brief Graph snapshot.
+        list_type snapshot_;
+
+        /// @brief Handle of every left position.
+        std::vector<int> leftHandles_;
+
+        /// @brief Left position of every handle, -1 for right side.
+        std::vector<int> leftPositions_;
+
+        /// @brief Right handle matched to every left position, -1 if free.
+        std::vector<int> leftMates_;
+
+        /// @brief Left position matched to every handle, -1 if free.
+        std::vector<int> rightMates_;
+
+        /// @brief Layer of every left position.
+        std::vector<int> layers_;
+
+        /// @brief Next arc to try of every left position.
+        std::vector<int> currentArcs_;
+
+        /// @brief BFS queue of left positions, consumed by index.
+        std::vector<int> queue_;
+
+        /// @brief Left positions of partial augmenting path.
+        std::vector<int> path_;
+
+        /// @brief Graph.
+        const graph_type* pGraph_;
+    };
+
+} // namespace algorithm
+
+
+//------------------------------------------------------------------------------
+// Function declarations
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Variable definitions
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Function definitions
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+//
+// Algorithms namespace
+//
+//------------------------------------------------------------------------------
+namespace algorithm
+{
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type, class graph_type>
+    hopcroft_karp<id_type, graph_type>::hopcroft_karp(const graph_type* pGraph) :
+            hopcroft_karp(list_type(*pGraph))
+    {
+        pGraph_ = pGraph;
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type, class graph_type>
+    hopcroft_karp<id_type, graph_type>::hopcroft_karp(
+            typename hopcroft_karp<id_type, graph_type>::list_type snapshot) : size_(0),
+                                                                               limit_(0),
+                                                                               snapshot_(std::move(snapshot)),
+                                                                               leftPositions_(snapshot_.Size(), -1),
+                                                                               rightMates_(snapshot_.Size(), -1),
+                                                                               pGraph_(nullptr)
+    {   }
+
+    //------------------------------------------------------------------------------
+    //
+    //  Partition is validated before any matching state changes.
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type, class graph_type>
+    void
+    hopcroft_karp<id_type, graph_type>::run(
+            const std::vector<typename hopcroft_karp<id_type, graph_type>::vertex_type>& left)
+    {
+        std::vector<int> handles;
+        handles.reserve(left.size());
+        for (const auto& vertex : left)
+        {
+            handles.push_back(snapshot_.GetHandle(vertex));
+        }
+
+        std::fill(leftPositions_.begin(), leftPositions_.end(), -1);
+        for (std::size_t position = 0; position < handles.size(); ++position)
+        {
+            if (leftPositions_[handles[position]] != -1)
+            {
+                std::fill(leftPositions_.begin(), leftPositions_.end(), -1);
+                throw std::invalid_argument("Left vertex is listed twice");
+            }
+            leftPositions_[handles[position]] = static_cast<int>(position);
+        }
+        for (int handle : handles)
+        {
+            for (int arc = snapshot_.Begin(handle); arc < snapshot_.End(handle); ++arc)
+            {
+                if (leftPositions_[snapshot_.Target(arc)] != -1)
+                {
+                    std::fill(leftPositions_.begin(), leftPositions_.end(), -1);
+                    throw std::invalid_argument("Arc joins two left vertices");
+                }
+            }
+        }
+
+        const int count = static_cast<int>(handles.size());
+        leftHandles_.swap(handles);
+        leftMates_.assign(count, -1);
+        layers_.assign(count, unlayered_);
+        currentArcs_.assign(count, 0);
+        std::fill(rightMates_.begin(), rightMates_.end(), -1);
+        size_ = 0;
+
+        // greedy start: first free right neighbour
+        for (int position = 0; position < count; ++position)
+        {
+            int handle = leftHandles_[position];
+            for (int arc = snapshot_.Begin(handle); arc < snapshot_.End(handle); ++arc)
+            {
+                int right = snapshot_.Target(arc);
+                if (rightMates_[right] == -1)
+                {
+                    leftMates_[position] = right;
+                    rightMates_[right] = position;
+                    ++size_;
+                    break;
+                }
+            }
+        }
+
+        while (compute_layers())
+        {
+            for (int position = 0; position < count; ++position)
+            {
+                if ((leftMates_[position] == -1) && augment(position))
+                {
+                    ++size_;
+                }
+            }
+        }
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type, class graph_type>
+    int
+    hopcroft_karp<id_type, graph_type>::get() const
+    {
+        return size_;
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type, class graph_type>
+    std::vector<typename hopcroft_karp<id_type, graph_type>::pair_type>
+    hopcroft_karp<id_type, graph_type>::get_matching() const
+    {
+        std::vector<pair_type> matching;
+        matching.reserve(size_);
+        for (std::size_t position = 0; position < leftMates_.size(); ++position)
+        {
+            if (leftMates_[position] != -1)
+            {
+                matching.emplace_back(snapshot_.GetVertex(leftHandles_[position]),
+                                      snapshot_.GetVertex(leftMates_[position]));
+            }
+        }
+
+        return matching;
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type, class graph_type>
+    const graph_type*
+    hopcroft_karp<id_type, graph_type>::get_graph() const
+    {
+        return pGraph_;
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type, class graph_type>
+    utility::memory_usage
+    hopcroft_karp<id_type, graph_type>::MemoryUsage() const
+    {
+        utility::memory_usage usage;
+        usage.auxiliary = snapshot_.MemoryUsage().total() +
+                          utility::vector_bytes(leftHandles_) +
+                          utility::vector_bytes(leftPositions_) +
+                          utility::vector_bytes(leftMates_) +
+                          utility::vector_bytes(rightMates_) +
+                          utility::vector_bytes(layers_) +
+                          utility::vector_bytes(currentArcs_) +
+                          utility::vector_bytes(queue_) +
+                          utility::vector_bytes(path_);
+
+        return usage;
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  Right vertices are not layered themselves: a matched right vertex
+    //  leads straight to its mate one layer further.
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type, class graph_type>
+    bool
+    hopcroft_karp<id_type, graph_type>::compute_layers()
+    {
+        queue_.clear();
+        for (std::size_t position = 0; position < leftMates_.size(); ++position)
+        {
+            if (leftMates_[position] == -1)
+            {
+                layers_[position] = 0;
+                queue_.push_back(static_cast<int>(position));
+            }
+            else
+            {
+                layers_[position] = unlayered_;
+            }
+        }
+
+        limit_ = unlayered_;
+        for (std::size_t head = 0; head < queue_.size(); ++head)
+        {
+            int position = queue_[head];
+            if (layers_[position] > limit_)
+            {
+                break;
+            }
+
+            int handle = leftHandles_[position];
+            currentArcs_[position] = snapshot_.Begin(handle);
+            for (int arc = snapshot_.Begin(handle); arc < snapshot_.End(handle); ++arc)
+            {
+                int mate = rightMates_[snapshot_.Target(arc)];
+                if (mate == -1)
+                {
+                    limit_ = layers_[position];
+                }
+                else if (layers_[mate] == unlayered_)
+                {
+                    layers_[mate] = layers_[position] + 1;
+                    queue_.push_back(mate);
+                }
+            }
+        }
+
+        return limit_ != unlayered_;
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  Path grows along current arcs into the next layer, as in dinic. A
+    //  free right vertex is accepted at limit_ layer only, so paths stay
+    //  shortest; reaching one flips every pair along the path.
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type, class graph_type>
+    bool
+    hopcroft_karp<id_type, graph_type>::augment(int root)
+    {
+        if (layers_[root] != 0)
+        {
+            return false;
+        }
+
+        path_.clear();
+        path_.push_back(root);
+
+        while (!path_.empty())
+        {
+            int position = path_.back();
+            int handle = leftHandles_[position];
+
+            int& arc = currentArcs_[position];
+            for (; arc < snapshot_.End(handle); ++arc)
+            {
+                int mate = rightMates_[snapshot_.Target(arc)];
+                if (mate == -1)
+                {
+                    if (layers_[position] == limit_)
+                    {
+                        break;
+                    }
+                }
+                else if ((layers_[mate] != unlayered_) && (layers_[mate] == layers_[position] + 1))
+                {
+                    break;
+                }
+            }
+
+            if (arc == snapshot_.End(handle))
+            {
+                // dead end: leave layering, retreat
+                layers_[position] = unlayered_;
+                path_.pop_back();
+                if (!path_.empty())
+                {
+                    ++currentArcs_[path_.back()];
+                }
+                continue;
+            }
+
+            int right = snapshot_.Target(arc);
+            if (rightMates_[right] != -1)
+            {
+                path_.push_back(rightMates_[right]);
+                continue;
+            }
+
+            // free right vertex: flip path, its vertices leave the layering
+            for (int step : path_)
+            {
+                int next = snapshot_.Target(currentArcs_[step]);
+                leftMates_[step] = next;
+                rightMates_[next] = step;
+                layers_[step] = unlayered_;
+            }
+            return true;
+        }
+
+        return false;
+    }
+
+} // namespace algorithm
+
+
+
+#endif // GRAPH_LIB_ALGORITHM_FLOW_HOPCROFT_KARP_HPP
+//==============================================================================
+// End of hopcroft-karp.hpp
+// (note: the newline at the end of the file is intentional)
+//==============================================================================
@@ -0,0 +1,555 @@
+//==============================================================================
+///
+/// @file incremental-flow.hpp
+///
+/// @brief Maximum flow kept up to date across capacity edits.
+///
+/// Flow lives in a residual network built from a snapshot of the graph
+/// taken at construction and kept between calls, so edits never restart
+/// from zero flow the way edmonds_karp and dinic runs do. Once run() has
+/// solved a source/sink pair, every edit repairs the current flow instead
+/// of solving again:
+///     - capacity increase or edge insertion - new augmenting paths are
+///       searched from the current flow;
+///     - capacity decrease below arc flow - the overflow is taken off the
+///       arc, leaving excess at its tail and deficit at its head. Excess is
+///       rerouted to the head where possible, the rest is returned to
+///       source while the same amount is pulled back from sink, then new
+///       augmenting paths are searched.
+/// Repairs are Dinic phases (see level-graph.hpp) limited to the flow the
+/// edit can change: an increase or insertion adds at most its capacity to
+/// the maximum, a decrease loses at most what was returned to terminals.
+/// Repairs thus stop as soon as that much is sent, and edits that cannot
+/// change the maximum search nothing. Every phase is still a level BFS
+/// over the part of the network reachable from its start, so an edit
+/// costs O(V + E) per phase it runs, only fewer phases than solving from
+/// zero flow. Inserted arcs are appended to the residual network in
+/// amortized O(1) (see residual-network.hpp).
+/// Edits apply to the flow network only; the graph itself is not changed.
+///
+/// The documentation is available on the following website:
+/// <website>
+///
+/// Support email: <email>
+///
+//==============================================================================
+
+//==============================================================================
+// Include only once
+//
+#ifndef GRAPH_LIB_ALGORITHM_FLOW_INCREMENTAL_FLOW_HPP
+#define GRAPH_LIB_ALGORITHM_FLOW_INCREMENTAL_FLOW_HPP
+
+
+//------------------------------------------------------------------------------
+// Include files
+//------------------------------------------------------------------------------
+// System
+// e.g.: #include <iostream>        // stdout
+#include <vector>
+#include <limits>                   // std::numeric_limits
+#include <algorithm>                // std::max
+#include <utility>                  // std::move
+#include <stdexcept>                // std::invalid_argument, std::out_of_range
+
+// Project
+// e.g.: #include "IncludeFile.h"   // MyType_t
+#include "graph-lib/component/vertex.hpp"                   // component::Vertex
+#include "graph-lib/implementation/compressed-list.hpp"     // implementation::CompressedList
+#include "graph-lib/utility/memory.hpp"                     // utility::memory_usage
+#include "graph-lib/algorithm/flow/residual-network.hpp"    // algorithm::residual_network
+#include "graph-lib/algorithm/flow/level-graph.hpp"         // algorithm::level_graph
+
+
+//------------------------------------------------------------------------------
+// Global references
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Constants
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Macros
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Forward declarations
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Data types
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+/// @brief Common graph algorithms.
+///
+//------------------------------------------------------------------------------
+namespace algorithm
+{
+    //------------------------------------------------------------------------------
+    /// @brief Incremental maximum flow implementation.
+    ///
+    //------------------------------------------------------------------------------
+    template<class id_type,
+             class graph_type = graph::Graph<id_type>>
+    class incremental_flow
+    {
+        using vertex_type           = component::Vertex<id_type>;
+        using list_type             = implementation::CompressedList<id_type>;
+        using network_type          = residual_network<id_type>;
+
+    public:
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Value constructor.
+        ///
+        /// Snapshot of the graph is taken here.
+        ///
+        /// @param[in] pGraph Input graph pointer.
+        ///
+        //------------------------------------------------------------------------------
+        incremental_flow(const graph_type* pGraph);
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Snapshot constructor.
+        ///
+        /// Results refer to snapshot handles (see reordering.hpp).
+        ///
+        /// @param[in] snapshot Graph snapshot, get_graph() returns nullptr.
+        ///
+        //------------------------------------------------------------------------------
+        explicit incremental_flow(list_type snapshot);
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Solve from zero flow, edits keep this pair solved.
+        ///
+        /// @param[in] source Flow start vertex.
+        ///
+        /// @param[in] sink Flow end vertex.
+        ///
+        //------------------------------------------------------------------------------
+        void
+        run(const vertex_type& source,
+            const vertex_type& sink);
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Change capacity of edge, repair flow.
+        ///
+        /// First edge from -> to is changed when there are several.
+        ///
+        /// @param[in] from Edge start vertex.
+        ///
+        /// @param[in] to Edge end vertex.
+        ///
+        /// @param[in] capacity New capacity.
+        ///
+        /// @throw std::out_of_range No edge from -> to.
+        ///
+        /// @throw std::invalid_argument Negative capacity.
+        ///
+        //------------------------------------------------------------------------------
+        void
+        set_capacity(const vertex_type& from,
+                     const vertex_type& to,
+                     int capacity);
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Insert edge, repair flow.
+        ///
+        /// @param[in] from Edge start vertex.
+        ///
+        /// @param[in] to Edge end vertex.
+        ///
+        /// @param[in] capacity Edge capacity.
+        ///
+        /// @throw std::invalid_argument Negative capacity.
+        ///
+        //------------------------------------------------------------------------------
+        void
+        add_edge(const vertex_type& from,
+                 const vertex_type& to,
+                 int capacity);
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Get algorithm execution results.
+        ///
+        /// @return Maximum flow value of current network.
+        ///
+        //------------------------------------------------------------------------------
+        int
+        get() const;
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Get flow between two vertices.
+        ///
+        /// @param[in] from Edge start vertex.
+        ///
+        /// @param[in] to Edge end vertex.
+        ///
+        /// @return Flow summed over all edges from -> to.
+        ///
+        //------------------------------------------------------------------------------
+        int
+        get_flow(const vertex_type& from,
+                 const vertex_type& to) const;
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Get algorithm's graph.
+        ///
+        /// @return Pointer to graph object.
+        ///
+        //------------------------------------------------------------------------------
+        const graph_type*
+        get_graph() const;
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Heap memory used by algorithm state.
+        ///
+        /// @return Memory usage report, snapshot and residual network are auxiliary.
+        ///
+        //------------------------------------------------------------------------------
+        utility::memory_usage
+        MemoryUsage() const;
+
+    private:
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Forward residual arc of first edge between vertices.
+        ///
+        /// @param[in] from Start vertex handle.
+        ///
+        /// @param[in] to End vertex handle.
+        ///
+        /// @return Arc, -1 if there is none.
+        ///
+        //------------------------------------------------------------------------------
+        int
+        find_arc(int from,
+                 int to) const;
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Send flow between two vertices over residual paths.
+        ///
+        /// @param[in] from Start vertex handle.
+        ///
+        /// @param[in] to Target vertex handle.
+        ///
+        /// @param[in] limit Most flow to send.
+        ///
+        /// @return Flow sent, limit when from and to coincide.
+        ///
+        //------------------------------------------------------------------------------
+        int
+        augment(int from,
+                int to,
+                int limit);
+
+    private:
+
+        /// @brief Current flow value.
+        int flow_;
+
+        /// @brief Solved source handle, -1 before first run.
+        int source_;
+
+        /// @brief Solved sink handle, -1 before first run.
+        int sink_;
+
+        /// @brief Graph snapshot.
+        list_type snapshot_;
+
+        /// @brief Residual arcs and flow.
+        network_type network_;
+
+        /// @brief Dinic phases of repairs.
+        level_graph levels_;
+
+        /// @brief Graph.
+        const graph_type* pGraph_;
+    };
+
+} // namespace algorithm
+
+
+//------------------------------------------------------------------------------
+// Function declarations
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Variable definitions
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Function definitions
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+//
+// Algorithms namespace
+//
+//------------------------------------------------------------------------------
+namespace algorithm
+{
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type, class graph_type>
+    incremental_flow<id_type, graph_type>::incremental_flow(const graph_type* pGraph) :
+            incremental_flow(list_type(*pGraph))
+    {
+        pGraph_ = pGraph;
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type, class graph_type>
+    incremental_flow<id_type, graph_type>::incremental_flow(
+            typename incremental_flow<id_type, graph_type>::list_type snapshot) : flow_(0),
+                                                                                  source_(-1),
+                                                                                  sink_(-1),
+                                                                                  snapshot_(std::move(snapshot)),
+                                                                                  network_(snapshot_),
+                                                                                  levels_(snapshot_.Size()),
+                                                                                  pGraph_(nullptr)
+    {   }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type, class graph_type>
+    void
+    incremental_flow<id_type, graph_type>::run(
+            const typename incremental_flow<id_type, graph_type>::vertex_type& source,
+            const typename incremental_flow<id_type, graph_type>::vertex_type& sink)
+    {
+        source_ = snapshot_.GetHandle(source);
+        sink_ = snapshot_.GetHandle(sink);
+
+        network_.reset();
+        flow_ = (source_ == sink_) ? 0 : augment(source_, sink_, std::numeric_limits<int>::max());
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  Excess left at arc tail came from source or from arc head. Once no
+    //  residual path to head is left, all of it can be returned to source,
+    //  and the deficit at head can be covered from sink the same way.
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type, class graph_type>
+    void
+    incremental_flow<id_type, graph_type>::set_capacity(
+            const typename incremental_flow<id_type, graph_type>::vertex_type& from,
+            const typename incremental_flow<id_type, graph_type>::vertex_type& to,
+            int capacity)
+    {
+        if (capacity < 0)
+        {
+            throw std::invalid_argument("Capacity must not be negative");
+        }
+
+        const int tail = snapshot_.GetHandle(from);
+        const int head = snapshot_.GetHandle(to);
+        const int arc = find_arc(tail, head);
+        if (arc == -1)
+        {
+            throw std::out_of_range("No edge between given vertices");
+        }
+
+        const int flow = network_.flow(arc);
+        const int increase = std::max(0, capacity - network_.capacity(arc));
+        const bool solved = (source_ != -1) && (source_ != sink_);
+
+        // take overflow off the arc
+        const int overflow = std::max(0, flow - capacity);
+        network_.push(network_.reverse(arc), overflow);
+        network_.set_capacity(arc, capacity);
+
+        int rest = 0;
+        if (overflow > 0)
+        {
+            // reroute, return the rest to terminals
+            rest = overflow - augment(tail, head, overflow);
+            if (rest > 0)
+            {
+                augment(tail, source_, rest);
+                augment(sink_, head, rest);
+                flow_ -= rest;
+            }
+        }
+
+        // maximum grows by at most the increase, or back by what was returned
+        if (solved && (increase + rest > 0))
+        {
+            flow_ += augment(source_, sink_, increase + rest);
+        }
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type, class graph_type>
+    void
+    incremental_flow<id_type, graph_type>::add_edge(
+            const typename incremental_flow<id_type, graph_type>::vertex_type& from,
+            const typename incremental_flow<id_type, graph_type>::vertex_type& to,
+            int capacity)
+    {
+        if (capacity < 0)
+        {
+            throw std::invalid_argument("Capacity must not be negative");
+        }
+
+        network_.add_arc(snapshot_.GetHandle(from), snapshot_.GetHandle(to), capacity);
+
+        // maximum grows by at most the new capacity
+        if ((source_ != -1) && (source_ != sink_) && (capacity > 0))
+        {
+            flow_ += augment(source_, sink_, capacity);
+        }
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type, class graph_type>
+    int
+    incremental_flow<id_type, graph_type>::get() const
+    {
+        return flow_;
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type, class graph_type>
+    int
+    incremental_flow<id_type, graph_type>::get_flow(
+            const typename incremental_flow<id_type, graph_type>::vertex_type& from,
+            const typename incremental_flow<id_type, graph_type>::vertex_type& to) const
+    {
+        const int tail = snapshot_.GetHandle(from);
+        const int head = snapshot_.GetHandle(to);
+
+        int flow = 0;
+        for (int arc = network_.begin(tail); arc < network_.end(tail); ++arc)
+        {
+            if ((network_.edge_arc(arc) != -1) && (network_.head(arc) == head))
+            {
+                flow += network_.flow(arc);
+            }
+        }
+
+        return flow;
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type, class graph_type>
+    const graph_type*
+    incremental_flow<id_type, graph_type>::get_graph() const
+    {
+        return pGraph_;
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type, class graph_type>
+    utility::memory_usage
+    incremental_flow<id_type, graph_type>::MemoryUsage() const
+    {
+        utility::memory_usage usage;
+        usage.auxiliary = snapshot_.MemoryUsage().total() +
+                          network_.memory() +
+                          levels_.memory();
+
+        return usage;
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type, class graph_type>
+    int
+    incremental_flow<id_type, graph_type>::find_arc(int from,
+                                                    int to) const
+    {
+        for (int arc = network_.begin(from); arc < network_.end(from); ++arc)
+        {
+            if ((network_.edge_arc(arc) != -1) && (network_.head(arc) == to))
+            {
+                return arc;
+            }
+        }
+
+        return -1;
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type, class graph_type>
+    int
+    incremental_flow<id_type, graph_type>::augment(int from,
+                                                   int to,
+                                                   int limit)
+    {
+        return levels_.run(network_, from, to, limit);
+    }
+
+} // namespace algorithm
+
+
+
+#endif // GRAPH_LIB_ALGORITHM_FLOW_INCREMENTAL_FLOW_HPP
+//==============================================================================
+// End of incremental-flow.hpp
+// (note: the newline at the end of the file is intentional)
+//==============================================================================
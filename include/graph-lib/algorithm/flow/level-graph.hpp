@@ -0,0 +1,464 @@
+//==============================================================================
+///
+/// @file level-graph.hpp
+///
+/// @brief Dinic phases over a residual network.
+///
+/// One level graph implementation serves the Dinic based engines
+/// (dinic, batch_flow, incremental_flow). Networks are passed per call and only
+/// need begin(v), end(v), head(a), residual(a) and push(a, amount), so
+/// residual_network and overlay_network both qualify; flow is never kept
+/// here.
+/// Levels live in a dense per-handle array valid for vertices marked in
+/// the current epoch, so each phase starts without clearing. Level BFS
+/// stops once the sink level is complete: vertices beyond it cannot be on
+/// a shortest path. Blocking flow of a phase is found by one iterative DFS
+/// over an explicit path of arcs. Every vertex keeps a current arc: arcs
+/// before it are saturated or lead outside of the level graph, so they are
+/// never scanned again within the phase. A vertex whose arcs are exhausted
+/// is a dead end and is pruned. Each arc is thus advanced past once and
+/// each augmentation retreats at most V arcs - O(VE) per phase.
+/// Last level BFS of a run that stops below its limit fails to reach sink;
+/// vertices it leveled are the source side of a minimum cut.
+///
+/// The documentation is available on the following website:
+/// <website>
+///
+/// Support email: <email>
+///
+//==============================================================================
+
+//==============================================================================
+// Include only once
+//
+#ifndef GRAPH_LIB_ALGORITHM_FLOW_LEVEL_GRAPH_HPP
+#define GRAPH_LIB_ALGORITHM_FLOW_LEVEL_GRAPH_HPP
+
+
+//------------------------------------------------------------------------------
+// Include files
+//------------------------------------------------------------------------------
+// System
+// e.g.: #include <iostream>        // stdout
+#include <cstddef>                  // std::size_t
+#include <vector>
+#include <limits>                   // std::numeric_limits
+#include <algorithm>                // std::min
+
+// Project
+// e.g.: #include "IncludeFile.h"   // MyType_t
+#include "graph-lib/utility/memory.hpp"     // utility::vector_bytes
+#include "graph-lib/utility/epoch.hpp"      // utility::epoch_marks
+
+
+//------------------------------------------------------------------------------
+// Global references
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Constants
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Macros
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Forward declarations
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Data types
+//------------------------------------------------------------------------------
+namespace algorithm
+{
+    //------------------------------------------------------------------------------
+    /// @brief Level graph and blocking flow of Dinic phases.
+    ///
+    //------------------------------------------------------------------------------
+    class level_graph
+    {
+    public:
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Value constructor.
+        ///
+        /// @param[in] size Vertex count.
+        ///
+        //------------------------------------------------------------------------------
+        explicit level_graph(int size = 0);
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Change vertex count, dropping levels.
+        ///
+        /// @param[in] size Vertex count.
+        ///
+        //------------------------------------------------------------------------------
+        void
+        resize(int size);
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Send flow over shortest residual paths, phase by phase.
+        ///
+        /// @param[in,out] network Residual network.
+        ///
+        /// @param[in] source Start vertex handle.
+        ///
+        /// @param[in] sink End vertex handle.
+        ///
+        /// @param[in] limit Most flow to send.
+        ///
+        /// @return Flow sent, limit when source and sink coincide.
+        ///
+        //------------------------------------------------------------------------------
+        template<class network_type>
+        int
+        run(network_type& network,
+            int source,
+            int sink,
+            int limit = std::numeric_limits<int>::max());
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Compute level graph.
+        ///
+        /// @param[in] network Residual network.
+        ///
+        /// @param[in] source Start vertex handle.
+        ///
+        /// @param[in] sink End vertex handle, search stops at its level.
+        ///
+        /// @return True if sink was leveled.
+        ///
+        //------------------------------------------------------------------------------
+        template<class network_type>
+        bool
+        build(const network_type& network,
+              int source,
+              int sink);
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Find blocking flow in level graph, up to a limit.
+        ///
+        /// @param[in,out] network Residual network the level graph was built on.
+        ///
+        /// @param[in] source Start vertex handle.
+        ///
+        /// @param[in] sink End vertex handle.
+        ///
+        /// @param[in] limit Most flow to send.
+        ///
+        /// @return Flow sent.
+        ///
+        //------------------------------------------------------------------------------
+        template<class network_type>
+        int
+        blocking_flow(network_type& network,
+                      int source,
+                      int sink,
+                      int limit = std::numeric_limits<int>::max());
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Check if vertex got a level in last build.
+        ///
+        /// @param[in] vertex Vertex handle.
+        ///
+        //------------------------------------------------------------------------------
+        bool
+        is_leveled(int vertex) const;
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Unlevel every vertex, O(1).
+        ///
+        //------------------------------------------------------------------------------
+        void
+        clear();
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Heap bytes used.
+        ///
+        /// @return Byte count.
+        ///
+        //------------------------------------------------------------------------------
+        std::size_t
+        memory() const;
+
+    private:
+
+        /// @brief Vertex levels, valid for leveled vertices.
+        std::vector<int> levels_;
+
+        /// @brief Vertices leveled in current phase.
+        utility::epoch_marks leveled_;
+
+        /// @brief Level BFS queue, consumed by index.
+        std::vector<int> queue_;
+
+        /// @brief Next arc to try of every leveled vertex.
+        std::vector<int> currentArcs_;
+
+        /// @brief Arcs of partial path from source.
+        std::vector<int> path_;
+    };
+
+} // namespace algorithm
+
+
+//------------------------------------------------------------------------------
+// Function declarations
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Variable definitions
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Function definitions
+//------------------------------------------------------------------------------
+namespace algorithm
+{
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    inline
+    level_graph::level_graph(int size) : levels_(size, 0),
+                                         leveled_(size),
+                                         currentArcs_(size, 0)
+    {
+        queue_.reserve(size);
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    inline void
+    level_graph::resize(int size)
+    {
+        levels_.assign(size, 0);
+        leveled_.resize(size);
+        leveled_.reset();
+        currentArcs_.assign(size, 0);
+        queue_.reserve(size);
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  Phases stop once limit is sent or sink is out of reach; in the latter
+    //  case leveled vertices are those reachable from source.
+    //
+    //------------------------------------------------------------------------------
+    template<class network_type>
+    int
+    level_graph::run(network_type& network,
+                     int source,
+                     int sink,
+                     int limit)
+    {
+        if (source == sink)
+        {
+            clear();
+            return limit;
+        }
+
+        int sent = 0;
+        while ((sent < limit) && build(network, source, sink))
+        {
+            sent += blocking_flow(network, source, sink, limit - sent);
+        }
+
+        return sent;
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  Current arc of a vertex is reset when it is leveled, so scans of a
+    //  phase start from its first arc.
+    //
+    //------------------------------------------------------------------------------
+    template<class network_type>
+    bool
+    level_graph::build(const network_type& network,
+                       int source,
+                       int sink)
+    {
+        leveled_.reset();
+        queue_.clear();
+
+        queue_.push_back(source);
+        leveled_.set(source);
+        levels_[source] = 0;
+        currentArcs_[source] = network.begin(source);
+
+        for (std::size_t head = 0; head < queue_.size(); ++head)
+        {
+            int current = queue_[head];
+            if (leveled_.test(sink) && (levels_[current] >= levels_[sink]))
+            {
+                break;
+            }
+
+            for (int arc = network.begin(current); arc < network.end(current); ++arc)
+            {
+                int target = network.head(arc);
+                if (!leveled_.test(target) && (network.residual(arc) > 0))
+                {
+                    leveled_.set(target);
+                    levels_[target] = levels_[current] + 1;
+                    currentArcs_[target] = network.begin(target);
+                    queue_.push_back(target);
+                }
+            }
+        }
+
+        return leveled_.test(sink);
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  Path grows along current arcs into the next level, never past sink
+    //  level. Reaching the sink augments by path bottleneck and retreats to
+    //  the tail of the first saturated arc. A vertex with no admissible arc
+    //  left gets a level no live vertex can step into, and path retreats
+    //  past it, moving its predecessor's current arc on.
+    //
+    //------------------------------------------------------------------------------
+    template<class network_type>
+    int
+    level_graph::blocking_flow(network_type& network,
+                               int source,
+                               int sink,
+                               int limit)
+    {
+        int flow = 0;
+        path_.clear();
+
+        while (flow < limit)
+        {
+            int current = path_.empty() ? source : network.head(path_.back());
+
+            // augment along path
+            if (current == sink)
+            {
+                int bottleneck = limit - flow;
+                for (int arc : path_)
+                {
+                    bottleneck = std::min(bottleneck, network.residual(arc));
+                }
+
+                std::size_t saturated = path_.size();
+                for (std::size_t index = 0; index < path_.size(); ++index)
+                {
+                    network.push(path_[index], bottleneck);
+                    if (saturated == path_.size() && network.residual(path_[index]) == 0)
+                    {
+                        saturated = index;
+                    }
+                }
+
+                flow += bottleneck;
+                path_.resize(saturated);
+                continue;
+            }
+
+            // advance along first admissible arc
+            int& arc = currentArcs_[current];
+            for (; arc < network.end(current); ++arc)
+            {
+                int target = network.head(arc);
+                if (leveled_.test(target) &&
+                    (levels_[target] == levels_[current] + 1) &&
+                    ((target == sink) || (levels_[target] < levels_[sink])) &&
+                    (network.residual(arc) > 0))
+                {
+                    break;
+                }
+            }
+            if (arc < network.end(current))
+            {
+                path_.push_back(arc);
+                continue;
+            }
+
+            // dead end: prune, retreat
+            if (current == source)
+            {
+                break;
+            }
+            levels_[current] = -1;
+            path_.pop_back();
+            int previous = path_.empty() ? source : network.head(path_.back());
+            ++currentArcs_[previous];
+        }
+
+        return flow;
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    inline bool
+    level_graph::is_leveled(int vertex) const
+    {
+        return leveled_.test(vertex);
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    inline void
+    level_graph::clear()
+    {
+        leveled_.reset();
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    inline std::size_t
+    level_graph::memory() const
+    {
+        return utility::vector_bytes(levels_) +
+               leveled_.memory() +
+               utility::vector_bytes(queue_) +
+               utility::vector_bytes(currentArcs_) +
+               utility::vector_bytes(path_);
+    }
+
+} // namespace algorithm
+
+
+
+#endif // GRAPH_LIB_ALGORITHM_FLOW_LEVEL_GRAPH_HPP
+//==============================================================================
+// End of level-graph.hpp
+// (note: the newline at the end of the file is intentional)
+//==============================================================================
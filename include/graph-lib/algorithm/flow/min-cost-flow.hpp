@@ -0,0 +1,912 @@
+//==============================================================================
+///
+/// @file min-cost-flow.hpp
+///
+/// @brief Minimum cost maximum flow, edge weights are per unit costs.
+///
+/// Flow state lives in a residual network built from a snapshot of the
+/// graph taken at construction; a reverse arc costs minus its forward arc.
+/// Two strategies compute a maximum flow of minimum total cost:
+///     - successive shortest paths - augment along cheapest residual paths
+///       found by Dijkstra over reduced costs. Johnson potentials keep
+///       reduced costs non-negative; negative edge weights get initial
+///       potentials from Bellman-Ford, a negative cycle reachable from
+///       source is rejected. One Dijkstra per augmentation, so best when
+///       flow value is small;
+///     - cost scaling - Goldberg-Tarjan refine: maximum flow value is found
+///       by push_relabel, then an epsilon-optimal flow of that value is
+///       refined by push/relabel on prices while epsilon shrinks by alpha_.
+///       Costs are multiplied by V + 1, so epsilon 1 means optimal. Time
+///       depends on log of largest cost rather than on flow value, better
+///       for large instances. Negative cost cycles are saturated.
+/// Results are total flow, total cost and flow of every snapshot arc.
+///
+/// The documentation is available on the following website:
+/// <website>
+///
+/// Support email: <email>
+///
+//==============================================================================
+
+//==============================================================================
+// Include only once
+//
+#ifndef GRAPH_LIB_ALGORITHM_FLOW_MIN_COST_FLOW_HPP
+#define GRAPH_LIB_ALGORITHM_FLOW_MIN_COST_FLOW_HPP
+
+
+//------------------------------------------------------------------------------
+// Include files
+//------------------------------------------------------------------------------
+// System
+// e.g.: #include <iostream>        // stdout
+#include <vector>
+#include <deque>
+#include <limits>                   // std::numeric_limits
+#include <algorithm>                // std::min, std::max, std::push_heap
+#include <functional>               // std::greater
+#include <utility>                  // std::pair, std::move
+#include <stdexcept>                // std::invalid_argument
+
+// Project
+// e.g.: #include "IncludeFile.h"   // MyType_t
+#include "graph-lib/component/vertex.hpp"                   // component::Vertex
+#include "graph-lib/implementation/compressed-list.hpp"     // implementation::CompressedList
+#include "graph-lib/utility/memory.hpp"                     // utility::memory_usage
+#include "graph-lib/utility/epoch.hpp"                      // utility::epoch_marks
+#include "graph-lib/algorithm/flow/residual-network.hpp"    // algorithm::residual_network
+#include "graph-lib/algorithm/flow/push-relabel.hpp"        // algorithm::push_relabel
+
+
+//------------------------------------------------------------------------------
+// Global references
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Constants
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Macros
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Forward declarations
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Data types
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+/// @brief Common graph algorithms.
+///
+//------------------------------------------------------------------------------
+namespace algorithm
+{
+    //------------------------------------------------------------------------------
+    /// @brief Algorithm traits.
+    //------------------------------------------------------------------------------
+    namespace traits
+    {
+        //------------------------------------------------------------------------------
+        /// @brief Encapsulates minimum cost flow strategies.
+        //------------------------------------------------------------------------------
+        enum class cost_mode
+        {
+            /// @brief Dijkstra augmentations over reduced costs.
+            successive_shortest_paths,
+            /// @brief Push/relabel refinement of epsilon-optimal flows.
+            cost_scaling
+        };
+
+    } // namespace traits
+
+    //------------------------------------------------------------------------------
+    /// @brief Minimum cost flow implementation.
+    ///
+    //------------------------------------------------------------------------------
+    template<class id_type,
+             class graph_type = graph::Graph<id_type>>
+    class min_cost_flow
+    {
+        using vertex_type           = component::Vertex<id_type>;
+        using list_type             = implementation::CompressedList<id_type>;
+        using network_type          = residual_network<id_type>;
+
+    public:
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Value constructor.
+        ///
+        /// Snapshot of the graph is taken here.
+        ///
+        /// @param[in] pGraph Input graph pointer.
+        ///
+        //------------------------------------------------------------------------------
+        min_cost_flow(const graph_type* pGraph);
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Snapshot constructor.
+        ///
+        /// Results refer to snapshot handles (see reordering.hpp).
+        ///
+        /// @param[in] snapshot Graph snapshot, get_graph() returns nullptr.
+        ///
+        //------------------------------------------------------------------------------
+        explicit min_cost_flow(list_type snapshot);
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Send maximum flow at minimum cost.
+        ///
+        /// @param[in] source Flow start vertex.
+        ///
+        /// @param[in] sink Flow end vertex.
+        ///
+        /// @param[in] mode Strategy.
+        ///
+        /// @throw std::invalid_argument Successive shortest paths found a
+        ///        negative cost cycle reachable from source.
+        ///
+        //------------------------------------------------------------------------------
+        void
+        run(const vertex_type& source,
+            const vertex_type& sink,
+            traits::cost_mode mode = traits::cost_mode::successive_shortest_paths);
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Get algorithm execution results.
+        ///
+        /// @return Maximum flow value.
+        ///
+        //------------------------------------------------------------------------------
+        int
+        get() const;
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Get total cost of flow.
+        ///
+        /// @return Sum of edge flow times edge weight.
+        ///
+        //------------------------------------------------------------------------------
+        long long
+        get_cost() const;
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Get flow of every edge.
+        ///
+        /// @return Flow per snapshot arc.
+        ///
+        //------------------------------------------------------------------------------
+        const std::vector<int>&
+        get_edge_flows() const;
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Get flow between two vertices.
+        ///
+        /// @param[in] from Edge start vertex.
+        ///
+        /// @param[in] to Edge end vertex.
+        ///
+        /// @return Flow summed over all arcs from -> to.
+        ///
+        //------------------------------------------------------------------------------
+        int
+        get_flow(const vertex_type& from,
+                 const vertex_type& to) const;
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Get snapshot defining handles and arcs.
+        ///
+        /// @return Graph snapshot.
+        ///
+        //------------------------------------------------------------------------------
+        const list_type&
+        get_snapshot() const;
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Get algorithm's graph.
+        ///
+        /// @return Pointer to graph object.
+        ///
+        //------------------------------------------------------------------------------
+        const graph_type*
+        get_graph() const;
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Heap memory used by algorithm state.
+        ///
+        /// @return Memory usage report, snapshot and residual network are auxiliary.
+        ///
+        //------------------------------------------------------------------------------
+        utility::memory_usage
+        MemoryUsage() const;
+
+    private:
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Cost of residual arc relative to prices.
+        ///
+        /// @param[in] arc Residual arc.
+        ///
+        /// @param[in] tail Arc start vertex.
+        ///
+        //------------------------------------------------------------------------------
+        long long
+        reduced_cost(int arc,
+                     int tail) const;
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Initial potentials for negative costs.
+        ///
+        /// @param[in] source Source handle.
+        ///
+        //------------------------------------------------------------------------------
+        void
+        bellman_ford(int source);
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Cheapest residual path by reduced cost.
+        ///
+        /// @param[in] source Source handle.
+        ///
+        /// @param[in] sink Sink handle.
+        ///
+        /// @return True if sink was reached.
+        ///
+        //------------------------------------------------------------------------------
+        bool
+        dijkstra(int source,
+                 int sink);
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Successive shortest paths implementation.
+        ///
+        /// @param[in] source Source handle.
+        ///
+        /// @param[in] sink Sink handle.
+        ///
+        //------------------------------------------------------------------------------
+        void
+        successive_shortest_paths(int source,
+                                  int sink);
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Turn flow into epsilon-optimal one.
+        ///
+        /// @param[in] epsilon Optimality bound, in scaled cost units.
+        ///
+        //------------------------------------------------------------------------------
+        void
+        refine(long long epsilon);
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Cost scaling implementation.
+        ///
+        /// @param[in] source Source vertex.
+        ///
+        /// @param[in] sink Sink vertex.
+        ///
+        //------------------------------------------------------------------------------
+        void
+        cost_scaling(const vertex_type& source,
+                     const vertex_type& sink);
+
+    private:
+
+        /// @brief Epsilon reduction per cost scaling phase.
+        static constexpr long long alpha_ = 8;
+
+        /// @brief Max flow possible to send over the network.
+        int flow_;
+
+        /// @brief Total cost of flow.
+        long long cost_;
+
+        /// @brief Graph snapshot.
+        list_type snapshot_;
+
+        /// @brief Residual arcs and flow.
+        network_type network_;
+
+        /// @brief Per unit cost of residual arcs.
+        std::vector<long long> costs_;
+
+        /// @brief Multiplier applied to costs, V + 1 while cost scaling.
+        long long scale_;
+
+        /// @brief Vertex potentials, prices while cost scaling.
+        std::vector<long long> potentials_;
+
+        /// @brief Dijkstra distances, valid for reached vertices.
+        std::vector<long long> distances_;
+
+        /// @brief Arc reaching vertex on cheapest path.
+        std::vector<int> parentArcs_;
+
+        /// @brief Vertices reached in current search.
+        utility::epoch_marks reached_;
+
+        /// @brief Dijkstra queue, min heap of (distance, vertex).
+        std::vector<std::pair<long long, int>> heap_;
+
+        /// @brief Vertex excess while cost scaling.
+        std::vector<int> excess_;
+
+        /// @brief Next arc to try of every vertex.
+        std::vector<int> currentArcs_;
+
+        /// @brief Active vertices in FIFO order.
+        std::deque<int> active_;
+
+        /// @brief Flow per snapshot arc.
+        std::vector<int> edgeFlows_;
+
+        /// @brief Graph.
+        const graph_type* pGraph_;
+    };
+
+} // namespace algorithm
+
+
+//------------------------------------------------------------------------------
+// Function declarations
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Variable definitions
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Function definitions
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+//
+// Algorithms namespace
+//
+//------------------------------------------------------------------------------
+namespace algorithm
+{
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type, class graph_type>
+    min_cost_flow<id_type, graph_type>::min_cost_flow(const graph_type* pGraph) :
+            min_cost_flow(list_type(*pGraph))
+    {
+        pGraph_ = pGraph;
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type, class graph_type>
+    min_cost_flow<id_type, graph_type>::min_cost_flow(
+            typename min_cost_flow<id_type, graph_type>::list_type snapshot) : flow_(0),
+                                                                               cost_(0),
+                                                                               snapshot_(std::move(snapshot)),
+                                                                               network_(snapshot_),
+                                                                               costs_(network_.arc_count(), 0),
+                                                                               scale_(1),
+                                                                               potentials_(snapshot_.Size(), 0),
+                                                                               distances_(snapshot_.Size(), 0),
+                                                                               parentArcs_(snapshot_.Size(), -1),
+                                                                               reached_(snapshot_.Size()),
+                                                                               excess_(snapshot_.Size(), 0),
+                                                                               currentArcs_(snapshot_.Size(), 0),
+                                                                               edgeFlows_(snapshot_.EdgeCount(), 0),
+                                                                               pGraph_(nullptr)
+    {
+        for (int arc = 0; arc < snapshot_.EdgeCount(); ++arc)
+        {
+            int forward = network_.forward_arc(arc);
+            costs_[forward] = snapshot_.Weight(arc);
+            costs_[network_.reverse(forward)] = -static_cast<long long>(snapshot_.Weight(arc));
+        }
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type, class graph_type>
+    void
+    min_cost_flow<id_type, graph_type>::run(
+            const typename min_cost_flow<id_type, graph_type>::vertex_type& source,
+            const typename min_cost_flow<id_type, graph_type>::vertex_type& sink,
+            traits::cost_mode mode)
+    {
+        const int sourceHandle = snapshot_.GetHandle(source);
+        const int sinkHandle = snapshot_.GetHandle(sink);
+
+        network_.reset();
+        std::fill(potentials_.begin(), potentials_.end(), 0);
+        flow_ = 0;
+
+        if (sourceHandle != sinkHandle)
+        {
+            if (mode == traits::cost_mode::cost_scaling)
+            {
+                cost_scaling(source, sink);
+            }
+            else
+            {
+                successive_shortest_paths(sourceHandle, sinkHandle);
+            }
+        }
+
+        // results from residual network
+        cost_ = 0;
+        for (int arc = 0; arc < snapshot_.EdgeCount(); ++arc)
+        {
+            edgeFlows_[arc] = network_.flow(network_.forward_arc(arc));
+            cost_ += static_cast<long long>(edgeFlows_[arc]) * snapshot_.Weight(arc);
+        }
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type, class graph_type>
+    int
+    min_cost_flow<id_type, graph_type>::get() const
+    {
+        return flow_;
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type, class graph_type>
+    long long
+    min_cost_flow<id_type, graph_type>::get_cost() const
+    {
+        return cost_;
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type, class graph_type>
+    const std::vector<int>&
+    min_cost_flow<id_type, graph_type>::get_edge_flows() const
+    {
+        return edgeFlows_;
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type, class graph_type>
+    int
+    min_cost_flow<id_type, graph_type>::get_flow(
+            const typename min_cost_flow<id_type, graph_type>::vertex_type& from,
+            const typename min_cost_flow<id_type, graph_type>::vertex_type& to) const
+    {
+        const int fromHandle = snapshot_.GetHandle(from);
+        const int toHandle = snapshot_.GetHandle(to);
+
+        int flow = 0;
+        for (int arc = snapshot_.Begin(fromHandle); arc < snapshot_.End(fromHandle); ++arc)
+        {
+            if (snapshot_.Target(arc) == toHandle)
+            {
+                flow += edgeFlows_[arc];
+            }
+        }
+
+        return flow;
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type, class graph_type>
+    const typename min_cost_flow<id_type, graph_type>::list_type&
+    min_cost_flow<id_type, graph_type>::get_snapshot() const
+    {
+        return snapshot_;
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type, class graph_type>
+    const graph_type*
+    min_cost_flow<id_type, graph_type>::get_graph() const
+    {
+        return pGraph_;
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type, class graph_type>
+    utility::memory_usage
+    min_cost_flow<id_type, graph_type>::MemoryUsage() const
+    {
+        utility::memory_usage usage;
+        usage.auxiliary = snapshot_.MemoryUsage().total() +
+                          network_.memory() +
+                          utility::vector_bytes(costs_) +
+                          utility::vector_bytes(potentials_) +
+                          utility::vector_bytes(distances_) +
+                          utility::vector_bytes(parentArcs_) +
+                          reached_.memory() +
+                          utility::vector_bytes(heap_) +
+                          utility::vector_bytes(excess_) +
+                          utility::vector_bytes(currentArcs_) +
+                          active_.size() * sizeof(int) +
+                          utility::vector_bytes(edgeFlows_);
+
+        return usage;
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type, class graph_type>
+    long long
+    min_cost_flow<id_type, graph_type>::reduced_cost(int arc,
+                                                     int tail) const
+    {
+        return costs_[arc] * scale_ + potentials_[tail] - potentials_[network_.head(arc)];
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  Queue based Bellman-Ford over arcs with capacity. A vertex dequeued
+    //  V times lies on a negative cycle. Vertices not reached keep
+    //  potential 0; they stay out of reach for the whole run, since reverse
+    //  arcs only appear along paths from source.
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type, class graph_type>
+    void
+    min_cost_flow<id_type, graph_type>::bellman_ford(int source)
+    {
+        const int size = network_.size();
+
+        std::vector<int> passes(size, 0);
+        std::vector<char> queued(size, 0);
+        std::deque<int> queue;
+
+        reached_.reset();
+        reached_.set(source);
+        distances_[source] = 0;
+        queue.push_back(source);
+        queued[source] = 1;
+
+        while (!queue.empty())
+        {
+            int current = queue.front();
+            queue.pop_front();
+            queued[current] = 0;
+
+            if (++passes[current] > size)
+            {
+                throw std::invalid_argument("Negative cost cycle reachable from source");
+            }
+
+            for (int arc = network_.begin(current); arc < network_.end(current); ++arc)
+            {
+                int target = network_.head(arc);
+                long long distance = distances_[current] + costs_[arc];
+                if ((network_.residual(arc) > 0) &&
+                    (!reached_.test(target) || distance < distances_[target]))
+                {
+                    reached_.set(target);
+                    distances_[target] = distance;
+                    if (!queued[target])
+                    {
+                        queued[target] = 1;
+                        queue.push_back(target);
+                    }
+                }
+            }
+        }
+
+        for (int vertex = 0; vertex < size; ++vertex)
+        {
+            potentials_[vertex] = reached_.test(vertex) ? distances_[vertex] : 0;
+        }
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  Search stops once sink is settled: every vertex closer than sink is
+    //  settled by then, the rest are at least as far as sink.
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type, class graph_type>
+    bool
+    min_cost_flow<id_type, graph_type>::dijkstra(int source,
+                                                 int sink)
+    {
+        const std::greater<std::pair<long long, int>> later;
+
+        reached_.reset();
+        heap_.clear();
+
+        reached_.set(source);
+        distances_[source] = 0;
+        heap_.emplace_back(0, source);
+
+        while (!heap_.empty())
+        {
+            std::pop_heap(heap_.begin(), heap_.end(), later);
+            long long distance = heap_.back().first;
+            int current = heap_.back().second;
+            heap_.pop_back();
+
+            // stale entry
+            if (distance > distances_[current])
+            {
+                continue;
+            }
+            if (current == sink)
+            {
+                return true;
+            }
+
+            for (int arc = network_.begin(current); arc < network_.end(current); ++arc)
+            {
+                if (network_.residual(arc) == 0)
+                {
+                    continue;
+                }
+
+                int target = network_.head(arc);
+                long long candidate = distance + reduced_cost(arc, current);
+                if (!reached_.test(target) || candidate < distances_[target])
+                {
+                    reached_.set(target);
+                    distances_[target] = candidate;
+                    parentArcs_[target] = arc;
+                    heap_.emplace_back(candidate, target);
+                    std::push_heap(heap_.begin(), heap_.end(), later);
+                }
+            }
+        }
+
+        return false;
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  Potentials grow by distance capped at sink distance, which keeps
+    //  every residual reduced cost non-negative, including arcs the early
+    //  stopped search never settled.
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type, class graph_type>
+    void
+    min_cost_flow<id_type, graph_type>::successive_shortest_paths(int source,
+                                                                  int sink)
+    {
+        const int size = network_.size();
+        scale_ = 1;
+
+        // negative costs need initial potentials
+        bool negative = false;
+        for (int arc = 0; arc < snapshot_.EdgeCount(); ++arc)
+        {
+            negative = negative || (snapshot_.Weight(arc) < 0);
+        }
+        if (negative)
+        {
+            bellman_ford(source);
+        }
+
+        int flow = 0;
+        while (dijkstra(source, sink))
+        {
+            long long sinkDistance = distances_[sink];
+            for (int vertex = 0; vertex < size; ++vertex)
+            {
+                potentials_[vertex] += reached_.test(vertex) ?
+                    std::min(distances_[vertex], sinkDistance) : sinkDistance;
+            }
+
+            int bottleneck = std::numeric_limits<int>::max();
+            for (int current = sink; current != source; current = network_.head(network_.reverse(parentArcs_[current])))
+            {
+                bottleneck = std::min(bottleneck, network_.residual(parentArcs_[current]));
+            }
+            for (int current = sink; current != source; current = network_.head(network_.reverse(parentArcs_[current])))
+            {
+                network_.push(parentArcs_[current], bottleneck);
+            }
+
+            flow += bottleneck;
+        }
+
+        flow_ = flow;
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  Arcs of negative reduced cost are saturated first, which makes the
+    //  pseudoflow 0-optimal. Active vertices are then discharged in FIFO
+    //  order over admissible arcs (negative reduced cost); a vertex without
+    //  one drops its price to make the cheapest residual arc cost -epsilon.
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type, class graph_type>
+    void
+    min_cost_flow<id_type, graph_type>::refine(long long epsilon)
+    {
+        const int size = network_.size();
+
+        for (int vertex = 0; vertex < size; ++vertex)
+        {
+            currentArcs_[vertex] = network_.begin(vertex);
+            for (int arc = network_.begin(vertex); arc < network_.end(vertex); ++arc)
+            {
+                int amount = network_.residual(arc);
+                if ((amount > 0) && (reduced_cost(arc, vertex) < 0))
+                {
+                    network_.push(arc, amount);
+                    excess_[vertex] -= amount;
+                    excess_[network_.head(arc)] += amount;
+                }
+            }
+        }
+
+        active_.clear();
+        for (int vertex = 0; vertex < size; ++vertex)
+        {
+            if (excess_[vertex] > 0)
+            {
+                active_.push_back(vertex);
+            }
+        }
+
+        while (!active_.empty())
+        {
+            int vertex = active_.front();
+            active_.pop_front();
+
+            while (excess_[vertex] > 0)
+            {
+                // push along admissible arcs
+                int& arc = currentArcs_[vertex];
+                for (; arc < network_.end(vertex); ++arc)
+                {
+                    int residual = network_.residual(arc);
+                    if ((residual > 0) && (reduced_cost(arc, vertex) < 0))
+                    {
+                        int target = network_.head(arc);
+                        int amount = std::min(excess_[vertex], residual);
+                        network_.push(arc, amount);
+                        excess_[vertex] -= amount;
+                        excess_[target] += amount;
+                        if ((excess_[target] > 0) && (excess_[target] <= amount))
+                        {
+                            active_.push_back(target);
+                        }
+
+                        if (excess_[vertex] == 0)
+                        {
+                            break;
+                        }
+                    }
+                }
+                if (excess_[vertex] == 0)
+                {
+                    break;
+                }
+
+                // relabel: cheapest residual arc becomes admissible
+                long long price = std::numeric_limits<long long>::min();
+                for (int scan = network_.begin(vertex); scan < network_.end(vertex); ++scan)
+                {
+                    if (network_.residual(scan) > 0)
+                    {
+                        price = std::max(price, potentials_[network_.head(scan)] - costs_[scan] * scale_);
+                    }
+                }
+                if (price == std::numeric_limits<long long>::min())
+                {
+                    break;
+                }
+                potentials_[vertex] = price - epsilon;
+                currentArcs_[vertex] = network_.begin(vertex);
+            }
+        }
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  Source starts with the maximum flow value as excess and sink with the
+    //  same deficit, so every refine ends with a flow of that value.
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type, class graph_type>
+    void
+    min_cost_flow<id_type, graph_type>::cost_scaling(
+            const typename min_cost_flow<id_type, graph_type>::vertex_type& source,
+            const typename min_cost_flow<id_type, graph_type>::vertex_type& sink)
+    {
+        push_relabel<id_type, graph_type> maxFlow(snapshot_);
+        maxFlow.run(source, sink);
+        flow_ = maxFlow.get();
+
+        scale_ = network_.size() + 1;
+        std::fill(excess_.begin(), excess_.end(), 0);
+        excess_[snapshot_.GetHandle(source)] = flow_;
+        excess_[snapshot_.GetHandle(sink)] = -flow_;
+
+        long long epsilon = 0;
+        for (auto cost : costs_)
+        {
+            epsilon = std::max(epsilon, cost * scale_);
+        }
+
+        do
+        {
+            epsilon = std::max(1LL, epsilon / alpha_);
+            refine(epsilon);
+        }
+        while (epsilon > 1);
+    }
+
+} // namespace algorithm
+
+
+
+#endif // GRAPH_LIB_ALGORITHM_FLOW_MIN_COST_FLOW_HPP
+//==============================================================================
+// End of min-cost-flow.hpp
+// (note: the newline at the end of the file is intentional)
+//==============================================================================
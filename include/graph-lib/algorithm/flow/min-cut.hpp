@@ -0,0 +1,169 @@
+//==============================================================================
+///
+/// @file min-cut.hpp
+///
+/// @brief Minimum s-t cut representation.
+///
+/// Once a maximum flow is found, vertices still reachable from source over
+/// residual arcs form the source side of a minimum cut, and the edges
+/// leaving it are saturated. Flow engines already run that residual search
+/// as their last step, so they hand their marks to to_min_cut() instead of
+/// searching again.
+///
+/// The documentation is available on the following website:
+/// <website>
+///
+/// Support email: <email>
+///
+//==============================================================================
+
+//==============================================================================
+// Include only once
+//
+#ifndef GRAPH_LIB_ALGORITHM_FLOW_MIN_CUT_HPP
+#define GRAPH_LIB_ALGORITHM_FLOW_MIN_CUT_HPP
+
+
+//------------------------------------------------------------------------------
+// Include files
+//------------------------------------------------------------------------------
+// System
+// e.g.: #include <iostream>        // stdout
+#include <vector>
+#include <utility>                  // std::pair
+
+// Project
+// e.g.: #include "IncludeFile.h"   // MyType_t
+#include "graph-lib/component/vertex.hpp"                   // component::Vertex
+#include "graph-lib/implementation/compressed-list.hpp"     // implementation::CompressedList
+
+
+//------------------------------------------------------------------------------
+// Global references
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Constants
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Macros
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Forward declarations
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Data types
+//------------------------------------------------------------------------------
+namespace algorithm
+{
+    //------------------------------------------------------------------------------
+    /// @brief Source side and crossing edges of an s-t cut.
+    ///
+    //------------------------------------------------------------------------------
+    template<class id_type>
+    struct min_cut
+    {
+        /// @brief Vertices on source side, in snapshot order.
+        std::vector<component::Vertex<id_type>> source_side;
+
+        /// @brief Edges from source side to sink side, as (from, to).
+        std::vector<std::pair<component::Vertex<id_type>, component::Vertex<id_type>>> edges;
+
+        /// @brief Capacity sum of crossing edges.
+        long long capacity = 0;
+    };
+
+} // namespace algorithm
+
+
+//------------------------------------------------------------------------------
+// Function declarations
+//------------------------------------------------------------------------------
+namespace algorithm
+{
+    //------------------------------------------------------------------------------
+    /// @brief Fill cut from source side marks.
+    ///
+    /// @param[in] list Snapshot defining handles and arcs.
+    ///
+    /// @param[in] inSourceSide Callable, true for handles on source side.
+    ///
+    /// @param[out] cut Cut, previous content is dropped.
+    ///
+    //------------------------------------------------------------------------------
+    template<class id_type,
+             class side_type>
+    void
+    to_min_cut(const implementation::CompressedList<id_type>& list,
+               side_type inSourceSide,
+               min_cut<id_type>& cut);
+
+} // namespace algorithm
+
+
+//------------------------------------------------------------------------------
+// Variable definitions
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Function definitions
+//------------------------------------------------------------------------------
+namespace algorithm
+{
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type,
+             class side_type>
+    void
+    to_min_cut(const implementation::CompressedList<id_type>& list,
+               side_type inSourceSide,
+               min_cut<id_type>& cut)
+    {
+        cut.source_side.clear();
+        cut.edges.clear();
+        cut.capacity = 0;
+
+        for (int vertex = 0; vertex < list.Size(); ++vertex)
+        {
+            if (!inSourceSide(vertex))
+            {
+                continue;
+            }
+
+            cut.source_side.push_back(list.GetVertex(vertex));
+            for (int arc = list.Begin(vertex); arc < list.End(vertex); ++arc)
+            {
+                if (!inSourceSide(list.Target(arc)))
+                {
+                    cut.edges.emplace_back(list.GetVertex(vertex), list.GetVertex(list.Target(arc)));
+                    cut.capacity += list.Capacity(arc);
+                }
+            }
+        }
+    }
+
+} // namespace algorithm
+
+
+
+#endif // GRAPH_LIB_ALGORITHM_FLOW_MIN_CUT_HPP
+//==============================================================================
+// End of min-cut.hpp
+// (note: the newline at the end of the file is intentional)
+//==============================================================================
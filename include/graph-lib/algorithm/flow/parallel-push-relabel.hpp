@@ -0,0 +1,751 @@
+//==============================================================================
+///
+/// @file parallel-push-relabel.hpp
+///
+/// @brief Synchronous parallel push-relabel maximum flow.
+///
+/// Active vertices are discharged by a team of threads in rounds over the
+/// same residual network the sequential push_relabel uses. Labels are frozen
+/// while a round pushes, so an arc and its reverse can never both be
+/// admissible and every residual pair is written by one thread only. Flow
+/// pushed into a vertex is collected in an atomic incoming counter and
+/// merged into its excess between barriers; vertices that received flow are
+/// claimed with an atomic round stamp, so each enters the next round once.
+/// Vertices left with excess compute new labels from the frozen ones, which
+/// keeps labeling valid even when neighbours are relabeled in the same
+/// round. Global relabel runs on one thread once relabel work exceeds
+/// alpha_ * V + E and also removes vertices cut off from sink, doing the
+/// gap heuristic's job.
+///
+/// The documentation is available on the following website:
+/// <website>
+///
+/// Support email: <email>
+///
+//==============================================================================
+
+//==============================================================================
+// Include only once
+//
+#ifndef GRAPH_LIB_ALGORITHM_FLOW_PARALLEL_PUSH_RELABEL_HPP
+#define GRAPH_LIB_ALGORITHM_FLOW_PARALLEL_PUSH_RELABEL_HPP
+
+
+//------------------------------------------------------------------------------
+// Include files
+//------------------------------------------------------------------------------
+// System
+// e.g.: #include <iostream>        // stdout
+#include <vector>
+#include <atomic>
+#include <thread>
+#include <algorithm>                // std::min, std::max
+#include <utility>                  // std::move
+#include <stdexcept>                // std::invalid_argument
+
+// Project
+// e.g.: #include "IncludeFile.h"   // MyType_t
+#include "graph-lib/component/vertex.hpp"                   // component::Vertex
+#include "graph-lib/implementation/compressed-list.hpp"     // implementation::CompressedList
+#include "graph-lib/utility/memory.hpp"                     // utility::memory_usage
+#include "graph-lib/utility/barrier.hpp"                    // utility::barrier
+#include "graph-lib/algorithm/flow/residual-network.hpp"    // algorithm::residual_network
+
+
+//------------------------------------------------------------------------------
+// Global references
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Constants
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Macros
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Forward declarations
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Data types
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+/// @brief Common graph algorithms.
+///
+//------------------------------------------------------------------------------
+namespace algorithm
+{
+    //------------------------------------------------------------------------------
+    /// @brief Parallel push-relabel implementation.
+    ///
+    //------------------------------------------------------------------------------
+    template<class id_type,
+             class graph_type = graph::Graph<id_type>>
+    class parallel_push_relabel
+    {
+        using vertex_type           = component::Vertex<id_type>;
+        using list_type             = implementation::CompressedList<id_type>;
+        using network_type          = residual_network<id_type>;
+
+    public:
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Value constructor.
+        ///
+        /// Snapshot of the graph is taken here.
+        ///
+        /// @param[in] pGraph Input graph pointer.
+        ///
+        /// @param[in] threads Thread count, 0 - hardware concurrency.
+        ///
+        //------------------------------------------------------------------------------
+        parallel_push_relabel(const graph_type* pGraph,
+                              int threads = 0);
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Snapshot constructor.
+        ///
+        /// Results refer to snapshot handles (see reordering.hpp).
+        ///
+        /// @param[in] snapshot Graph snapshot, get_graph() returns nullptr.
+        ///
+        /// @param[in] threads Thread count, 0 - hardware concurrency.
+        ///
+        //------------------------------------------------------------------------------
+        explicit parallel_push_relabel(list_type snapshot,
+                                       int threads = 0);
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Set thread count.
+        ///
+        /// @param[in] threads Thread count, 0 - hardware concurrency.
+        ///
+        //------------------------------------------------------------------------------
+        void
+        set_threads(int threads);
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Execute parallel push-relabel algorithm.
+        ///
+        /// @param[in] source Flow start vertex.
+        ///
+        /// @param[in] sink Flow end vertex.
+        ///
+        //------------------------------------------------------------------------------
+        void
+        run(const vertex_type& source,
+            const vertex_type& sink);
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Get algorithm execution results.
+        ///
+        /// @return Maximum flow value.
+        ///
+        //------------------------------------------------------------------------------
+        int
+        get() const;
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Get algorithm's graph.
+        ///
+        /// @return Pointer to graph object.
+        ///
+        //------------------------------------------------------------------------------
+        const graph_type*
+        get_graph() const;
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Heap memory used by algorithm state.
+        ///
+        /// @return Memory usage report, snapshot and residual network are auxiliary.
+        ///
+        //------------------------------------------------------------------------------
+        utility::memory_usage
+        MemoryUsage() const;
+
+    private:
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Set exact distance labels, rebuild active vertex list.
+        ///
+        /// @param[in] source Source handle.
+        ///
+        /// @param[in] sink Sink handle.
+        ///
+        //------------------------------------------------------------------------------
+        void
+        global_relabel(int source,
+                       int sink);
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Push vertex excess over admissible arcs under frozen labels.
+        ///
+        /// @param[in] vertex Active vertex handle.
+        ///
+        /// @param[in] sink Sink handle.
+        ///
+        /// @param[in] round Current round, stamps claimed targets.
+        ///
+        /// @param[out] claimed Targets claimed for next round.
+        ///
+        //------------------------------------------------------------------------------
+        void
+        push_excess(int vertex,
+                    int sink,
+                    int round,
+                    std::vector<int>& claimed);
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Compute label of vertex left with excess.
+        ///
+        /// @param[in] vertex Vertex handle.
+        ///
+        /// @return Lowest residual neighbour label plus one, at most size().
+        ///
+        //------------------------------------------------------------------------------
+        int
+        relabel(int vertex);
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Discharge rounds until no vertex is active.
+        ///
+        /// @param[in] source Source handle.
+        ///
+        /// @param[in] sink Sink handle.
+        ///
+        /// @param[in] threads Thread count.
+        ///
+        //------------------------------------------------------------------------------
+        void
+        discharge_rounds(int source,
+                         int sink,
+                         int threads);
+
+    private:
+
+        /// @brief Active vertices taken by a thread at once.
+        static constexpr std::size_t chunk_ = 64;
+
+        /// @brief Global relabel frequency, work per vertex.
+        static constexpr int alpha_ = 6;
+
+        /// @brief Work charged per relabel on top of arc scans.
+        static constexpr int beta_ = 12;
+
+        /// @brief Max flow possible to send over the network.
+        int flow_;
+
+        /// @brief Thread count.
+        int threads_;
+
+        /// @brief Graph snapshot.
+        list_type snapshot_;
+
+        /// @brief Residual arcs and flow.
+        network_type network_;
+
+        /// @brief Distance labels, frozen during a round.
+        std::vector<int> labels_;
+
+        /// @brief Labels computed in current round.
+        std::vector<int> newLabels_;
+
+        /// @brief Vertex excess, written by the thread discharging the vertex.
+        std::vector<int> excess_;
+
+        /// @brief Flow received in current round.
+        std::vector<std::atomic<int>> incoming_;
+
+        /// @brief Round in which vertex was last claimed.
+        std::vector<std::atomic<int>> stamps_;
+
+        /// @brief Next arc to try of every vertex.
+        std::vector<int> currentArcs_;
+
+        /// @brief Vertices discharged in current round.
+        std::vector<int> active_;
+
+        /// @brief Global relabel BFS queue, consumed by index.
+        std::vector<int> queue_;
+
+        /// @brief Graph.
+        const graph_type* pGraph_;
+    };
+
+} // namespace algorithm
+
+
+//------------------------------------------------------------------------------
+// Function declarations
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Variable definitions
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Function definitions
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+//
+// Algorithms namespace
+//
+//------------------------------------------------------------------------------
+namespace algorithm
+{
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type, class graph_type>
+    parallel_push_relabel<id_type, graph_type>::parallel_push_relabel(const graph_type* pGraph,
+                                                                      int threads) :
+            parallel_push_relabel(list_type(*pGraph), threads)
+    {
+        pGraph_ = pGraph;
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type, class graph_type>
+    parallel_push_relabel<id_type, graph_type>::parallel_push_relabel(
+            typename parallel_push_relabel<id_type, graph_type>::list_type snapshot,
+            int threads) : flow_(0),
+                           threads_(0),
+                           snapshot_(std::move(snapshot)),
+                           network_(snapshot_),
+                           labels_(snapshot_.Size(), 0),
+                           newLabels_(snapshot_.Size(), 0),
+                           excess_(snapshot_.Size(), 0),
+                           incoming_(snapshot_.Size()),
+                           stamps_(snapshot_.Size()),
+                           currentArcs_(snapshot_.Size(), 0),
+                           pGraph_(nullptr)
+    {
+        set_threads(threads);
+        queue_.reserve(snapshot_.Size());
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type, class graph_type>
+    void
+    parallel_push_relabel<id_type, graph_type>::set_threads(int threads)
+    {
+        if (threads < 0)
+        {
+            throw std::invalid_argument("Thread count must not be negative");
+        }
+
+        threads_ = (threads == 0) ?
+            std::max(1, static_cast<int>(std::thread::hardware_concurrency())) : threads;
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type, class graph_type>
+    void
+    parallel_push_relabel<id_type, graph_type>::run(
+            const typename parallel_push_relabel<id_type, graph_type>::vertex_type& source,
+            const typename parallel_push_relabel<id_type, graph_type>::vertex_type& sink)
+    {
+        const int sourceHandle = snapshot_.GetHandle(source);
+        const int sinkHandle = snapshot_.GetHandle(sink);
+
+        network_.reset();
+        flow_ = 0;
+
+        // nothing to send
+        if (sourceHandle == sinkHandle)
+        {
+            return;
+        }
+
+        // no point in more threads than vertices
+        int threads = std::max(1, std::min(threads_, snapshot_.Size()));
+        discharge_rounds(sourceHandle, sinkHandle, threads);
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type, class graph_type>
+    int
+    parallel_push_relabel<id_type, graph_type>::get() const
+    {
+        return flow_;
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type, class graph_type>
+    const graph_type*
+    parallel_push_relabel<id_type, graph_type>::get_graph() const
+    {
+        return pGraph_;
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type, class graph_type>
+    utility::memory_usage
+    parallel_push_relabel<id_type, graph_type>::MemoryUsage() const
+    {
+        utility::memory_usage usage;
+        usage.auxiliary = snapshot_.MemoryUsage().total() +
+                          network_.memory() +
+                          utility::vector_bytes(labels_) +
+                          utility::vector_bytes(newLabels_) +
+                          utility::vector_bytes(excess_) +
+                          utility::vector_bytes(incoming_) +
+                          utility::vector_bytes(stamps_) +
+                          utility::vector_bytes(currentArcs_) +
+                          utility::vector_bytes(active_) +
+                          utility::vector_bytes(queue_);
+
+        return usage;
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  Reverse BFS from sink, as in push_relabel. Runs on one thread between
+    //  rounds, when all incoming flow has been merged into excess.
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type, class graph_type>
+    void
+    parallel_push_relabel<id_type, graph_type>::global_relabel(int source,
+                                                               int sink)
+    {
+        const int size = network_.size();
+
+        std::fill(labels_.begin(), labels_.end(), size);
+
+        queue_.clear();
+        queue_.push_back(sink);
+        labels_[sink] = 0;
+
+        for (std::size_t head = 0; head < queue_.size(); ++head)
+        {
+            int current = queue_[head];
+            int label = labels_[current] + 1;
+
+            for (int arc = network_.begin(current); arc < network_.end(current); ++arc)
+            {
+                int target = network_.head(arc);
+                if ((labels_[target] == size) &&
+                    (target != source) &&
+                    (network_.residual(network_.reverse(arc)) > 0))
+                {
+                    labels_[target] = label;
+                    currentArcs_[target] = network_.begin(target);
+                    queue_.push_back(target);
+                }
+            }
+        }
+
+        // BFS order lists every vertex still able to reach sink
+        active_.clear();
+        for (std::size_t head = 1; head < queue_.size(); ++head)
+        {
+            if (excess_[queue_[head]] > 0)
+            {
+                active_.push_back(queue_[head]);
+            }
+        }
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  Arc label is tested before its residual: with labels frozen, residual
+    //  of an arc into a vertex one label lower is written by no other thread.
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type, class graph_type>
+    void
+    parallel_push_relabel<id_type, graph_type>::push_excess(int vertex,
+                                                            int sink,
+                                                            int round,
+                                                            std::vector<int>& claimed)
+    {
+        int label = labels_[vertex];
+
+        int& arc = currentArcs_[vertex];
+        for (; arc < network_.end(vertex); ++arc)
+        {
+            int target = network_.head(arc);
+            if (labels_[target] != label - 1)
+            {
+                continue;
+            }
+
+            int residual = network_.residual(arc);
+            if (residual > 0)
+            {
+                int amount = std::min(excess_[vertex], residual);
+                network_.push(arc, amount);
+                excess_[vertex] -= amount;
+                incoming_[target].fetch_add(amount, std::memory_order_relaxed);
+
+                if ((target != sink) &&
+                    (stamps_[target].exchange(round, std::memory_order_relaxed) != round))
+                {
+                    claimed.push_back(target);
+                }
+
+                if (excess_[vertex] == 0)
+                {
+                    break;
+                }
+            }
+        }
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type, class graph_type>
+    int
+    parallel_push_relabel<id_type, graph_type>::relabel(int vertex)
+    {
+        const int size = network_.size();
+
+        int lowest = size;
+        int lowestArc = network_.begin(vertex);
+        for (int arc = network_.begin(vertex); arc < network_.end(vertex); ++arc)
+        {
+            if ((network_.residual(arc) > 0) && (labels_[network_.head(arc)] < lowest))
+            {
+                lowest = labels_[network_.head(arc)];
+                lowestArc = arc;
+            }
+        }
+
+        currentArcs_[vertex] = lowestArc;
+        return std::min(lowest + 1, size);
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  Every round takes five barrier phases:
+    //      1. push excess of active chunks, claim targets;
+    //      2. relabel vertices left with excess from frozen labels;
+    //      3. thread 0 computes claimed buffer offsets in the next list;
+    //      4. buffers are copied into the next list, new labels applied and
+    //      incoming flow of claimed vertices merged into excess;
+    //      5. thread 0 swaps lists and runs global relabel when due.
+    //  Calling thread is thread 0 of the team.
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type, class graph_type>
+    void
+    parallel_push_relabel<id_type, graph_type>::discharge_rounds(int source,
+                                                                 int sink,
+                                                                 int threads)
+    {
+        const int size = network_.size();
+        const long long threshold = static_cast<long long>(alpha_) * size + network_.arc_count() / 2;
+
+        for (int vertex = 0; vertex < size; ++vertex)
+        {
+            excess_[vertex] = 0;
+            incoming_[vertex].store(0, std::memory_order_relaxed);
+            stamps_[vertex].store(-1, std::memory_order_relaxed);
+        }
+
+        // saturate source arcs
+        for (int arc = network_.begin(source); arc < network_.end(source); ++arc)
+        {
+            int amount = network_.residual(arc);
+            if (amount > 0)
+            {
+                network_.push(arc, amount);
+                excess_[network_.head(arc)] += amount;
+            }
+        }
+        excess_[source] = 0;
+
+        global_relabel(source, sink);
+
+        std::vector<int> next;
+        std::vector<std::vector<int>> buffers(threads);
+        std::vector<std::size_t> offsets(threads + 1, 0);
+        std::vector<long long> work(threads, 0);
+        std::atomic<std::size_t> pushCursor(0);
+        std::atomic<std::size_t> relabelCursor(0);
+        int round = 0;
+        utility::barrier sync(threads);
+
+        auto worker = [&](int thread)
+        {
+            auto& local = buffers[thread];
+
+            while (!active_.empty())
+            {
+                // 1. push
+                local.clear();
+                for (;;)
+                {
+                    std::size_t begin = pushCursor.fetch_add(chunk_, std::memory_order_relaxed);
+                    if (begin >= active_.size())
+                    {
+                        break;
+                    }
+                    std::size_t end = std::min(begin + chunk_, active_.size());
+
+                    for (std::size_t position = begin; position < end; ++position)
+                    {
+                        push_excess(active_[position], sink, round, local);
+                    }
+                }
+                sync.arrive_and_wait();
+
+                // 2. relabel
+                for (;;)
+                {
+                    std::size_t begin = relabelCursor.fetch_add(chunk_, std::memory_order_relaxed);
+                    if (begin >= active_.size())
+                    {
+                        break;
+                    }
+                    std::size_t end = std::min(begin + chunk_, active_.size());
+
+                    for (std::size_t position = begin; position < end; ++position)
+                    {
+                        int vertex = active_[position];
+                        newLabels_[vertex] = labels_[vertex];
+                        if (excess_[vertex] == 0)
+                        {
+                            continue;
+                        }
+
+                        newLabels_[vertex] = relabel(vertex);
+                        work[thread] += beta_ + (network_.end(vertex) - network_.begin(vertex));
+
+                        if ((newLabels_[vertex] < size) &&
+                            (stamps_[vertex].exchange(round, std::memory_order_relaxed) != round))
+                        {
+                            local.push_back(vertex);
+                        }
+                    }
+                }
+                sync.arrive_and_wait();
+
+                // 3. offsets
+                if (thread == 0)
+                {
+                    for (int other = 0; other < threads; ++other)
+                    {
+                        offsets[other + 1] = offsets[other] + buffers[other].size();
+                    }
+                    next.resize(offsets[threads]);
+                }
+                sync.arrive_and_wait();
+
+                // 4. concatenate, apply labels, merge excess
+                std::copy(local.begin(), local.end(), next.begin() + offsets[thread]);
+                std::size_t first = active_.size() * thread / threads;
+                std::size_t last = active_.size() * (thread + 1) / threads;
+                for (std::size_t position = first; position < last; ++position)
+                {
+                    labels_[active_[position]] = newLabels_[active_[position]];
+                }
+                for (int vertex : local)
+                {
+                    excess_[vertex] += incoming_[vertex].exchange(0, std::memory_order_relaxed);
+                }
+                sync.arrive_and_wait();
+
+                // 5. swap
+                if (thread == 0)
+                {
+                    active_.swap(next);
+                    pushCursor.store(0, std::memory_order_relaxed);
+                    relabelCursor.store(0, std::memory_order_relaxed);
+                    ++round;
+
+                    long long total = 0;
+                    for (auto amount : work)
+                    {
+                        total += amount;
+                    }
+                    if (total > threshold)
+                    {
+                        std::fill(work.begin(), work.end(), 0);
+                        global_relabel(source, sink);
+                    }
+                }
+                sync.arrive_and_wait();
+            }
+        };
+
+        std::vector<std::thread> team;
+        for (int thread = 1; thread < threads; ++thread)
+        {
+            team.emplace_back(worker, thread);
+        }
+        worker(0);
+        for (auto& member : team)
+        {
+            member.join();
+        }
+
+        flow_ = excess_[sink] + incoming_[sink].load(std::memory_order_relaxed);
+    }
+
+} // namespace algorithm
+
+
+
+#endif // GRAPH_LIB_ALGORITHM_FLOW_PARALLEL_PUSH_RELABEL_HPP
+//==============================================================================
+// End of parallel-push-relabel.hpp
+// (note: the newline at the end of the file is intentional)
+//==============================================================================
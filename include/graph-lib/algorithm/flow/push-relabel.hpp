@@ -0,0 +1,734 @@
+//==============================================================================
+///
+/// @file push-relabel.hpp
+///
+/// @brief Highest label push-relabel maximum flow.
+///
+/// Flow state lives in a residual network with paired reverse arcs built
+/// from a snapshot of the graph taken at construction; graph edges are never
+/// written. Only the first phase of push-relabel runs: it ends with a
+/// maximum preflow whose sink excess is the maximum flow value.
+///
+/// Active vertices are kept in buckets by label and the highest one is
+/// discharged first. Two heuristics keep labels close to exact distances:
+///     - global relabel - reverse BFS from sink over residual arcs, run
+///       after work proportional to graph size has been done;
+///     - gap - once no vertex is left at some label k, vertices above k can
+///       no longer reach the sink and are lifted out of the way at once.
+/// Every vertex keeps a current arc, arcs before it are not admissible
+/// until the vertex is relabeled.
+///
+/// The documentation is available on the following website:
+/// <website>
+///
+/// Support email: <email>
+///
+//==============================================================================
+
+//==============================================================================
+// Include only once
+//
+#ifndef GRAPH_LIB_ALGORITHM_FLOW_PUSH_RELABEL_HPP
+#define GRAPH_LIB_ALGORITHM_FLOW_PUSH_RELABEL_HPP
+
+
+//------------------------------------------------------------------------------
+// Include files
+//------------------------------------------------------------------------------
+// System
+// e.g.: #include <iostream>        // stdout
+#include <vector>
+#include <algorithm>            // std::min, std::fill
+#include <utility>              // std::move
+
+// Project
+// e.g.: #include "IncludeFile.h"   // MyType_t
+#include "graph-lib/component/vertex.hpp"   // component::Vertex
+#include "graph-lib/utility/memory.hpp"     // utility::memory_usage
+#include "graph-lib/implementation/compressed-list.hpp"    // implementation::CompressedList
+#include "graph-lib/algorithm/flow/residual-network.hpp"   // algorithm::residual_network
+
+//------------------------------------------------------------------------------
+// Global references
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Constants
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Macros
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Forward declarations
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Data types
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+/// @brief Common graph algorithms.
+///
+//------------------------------------------------------------------------------
+namespace algorithm
+{
+    //------------------------------------------------------------------------------
+    /// @brief Push-relabel algorithm implementation.
+    ///
+    //------------------------------------------------------------------------------
+    template<class id_type,
+             class graph_type = graph::Graph<id_type>>
+    class push_relabel
+    {
+        using vertex_type           = component::Vertex<id_type>;
+        using list_type             = implementation::CompressedList<id_type>;
+        using network_type          = residual_network<id_type>;
+
+    public:
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Value constructor.
+        ///
+        /// @param[in] pGraph Input graph pointer.
+        ///
+        //------------------------------------------------------------------------------
+        push_relabel(const graph_type* pGraph);
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Snapshot constructor.
+        ///
+        /// Results refer to snapshot handles (see reordering.hpp).
+        ///
+        /// @param[in] snapshot Graph snapshot, get_graph() returns nullptr.
+        ///
+        //------------------------------------------------------------------------------
+        explicit push_relabel(list_type snapshot);
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Execute push-relabel algorithm.
+        ///
+        /// @param[in] source Flow start vertex.
+        ///
+        /// @param[in] sink Flow end vertex.
+        ///
+        //------------------------------------------------------------------------------
+        void
+        run(const vertex_type& source,
+            const vertex_type& sink);
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Get algorithm execution results.
+        ///
+        /// @return Maximum flow value.
+        ///
+        //------------------------------------------------------------------------------
+        int
+        get() const;
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Get algorithm's graph.
+        ///
+        /// @return Pointer to graph object.
+        ///
+        //------------------------------------------------------------------------------
+        const graph_type*
+        get_graph() const;
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Heap memory used by algorithm state.
+        ///
+        /// @return Memory usage report, snapshot and residual network are auxiliary.
+        ///
+        //------------------------------------------------------------------------------
+        utility::memory_usage
+        MemoryUsage() const;
+
+    private:
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Put vertex into active bucket of its label.
+        ///
+        /// @param[in] vertex Vertex handle.
+        ///
+        //------------------------------------------------------------------------------
+        void
+        activate(int vertex);
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Put vertex into label bucket of its label.
+        ///
+        /// @param[in] vertex Vertex handle.
+        ///
+        //------------------------------------------------------------------------------
+        void
+        insert_labeled(int vertex);
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Take vertex out of label bucket of its label.
+        ///
+        /// @param[in] vertex Vertex handle.
+        ///
+        //------------------------------------------------------------------------------
+        void
+        remove_labeled(int vertex);
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Set exact distance labels, rebuild buckets.
+        ///
+        /// @param[in] source Source handle.
+        ///
+        /// @param[in] sink Sink handle.
+        ///
+        //------------------------------------------------------------------------------
+        void
+        global_relabel(int source,
+                       int sink);
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Lift vertices labeled above an emptied label out of the network.
+        ///
+        /// @param[in] label Label left without vertices.
+        ///
+        //------------------------------------------------------------------------------
+        void
+        gap(int label);
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Push excess of vertex away, relabeling as needed.
+        ///
+        /// @param[in] vertex Active vertex handle, already out of its bucket.
+        ///
+        /// @param[in] sink Sink handle.
+        ///
+        //------------------------------------------------------------------------------
+        void
+        discharge(int vertex,
+                  int sink);
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Push-relabel algorithm implementation.
+        ///
+        /// @param[in] source Source handle.
+        ///
+        /// @param[in] sink Sink handle.
+        ///
+        //------------------------------------------------------------------------------
+        void
+        push_relabel_inner(int source,
+                           int sink);
+
+    private:
+
+        /// @brief Global relabel frequency, work per vertex.
+        static constexpr int alpha_ = 6;
+
+        /// @brief Work charged per relabel on top of arc scans.
+        static constexpr int beta_ = 12;
+
+        /// @brief Max flow possible to send over the network.
+        int flow_;
+
+        /// @brief Graph snapshot.
+        list_type snapshot_;
+
+        /// @brief Residual arcs and flow.
+        network_type network_;
+
+        /// @brief Distance labels, size() for vertices cut off from sink.
+        std::vector<int> labels_;
+
+        /// @brief Vertex excess.
+        std::vector<int> excess_;
+
+        /// @brief Next arc to try of every vertex.
+        std::vector<int> currentArcs_;
+
+        /// @brief First active vertex of every label, -1 if none.
+        std::vector<int> activeHeads_;
+
+        /// @brief Next active vertex in bucket.
+        std::vector<int> nextActive_;
+
+        /// @brief First vertex of every label, -1 if none.
+        std::vector<int> labeledHeads_;
+
+        /// @brief Next vertex in label bucket.
+        std::vector<int> nextLabeled_;
+
+        /// @brief Previous vertex in label bucket.
+        std::vector<int> previousLabeled_;
+
+        /// @brief Global relabel BFS queue, consumed by index.
+        std::vector<int> queue_;
+
+        /// @brief Highest label that may hold an active vertex.
+        int maxActive_;
+
+        /// @brief Highest label below size() holding a vertex.
+        int maxLabel_;
+
+        /// @brief Work since last global relabel.
+        long long work_;
+
+        /// @brief Graph.
+        const graph_type* pGraph_;
+    };
+
+} // namespace algorithm
+
+
+//------------------------------------------------------------------------------
+// Function declarations
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Variable definitions
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Function definitions
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+//
+// Algorithms namespace
+//
+//------------------------------------------------------------------------------
+namespace algorithm
+{
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type, class graph_type>
+    push_relabel<id_type, graph_type>::push_relabel(const graph_type* pGraph) :
+            push_relabel(list_type(*pGraph))
+    {
+        pGraph_ = pGraph;
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type, class graph_type>
+    push_relabel<id_type, graph_type>::push_relabel(
+            typename push_relabel<id_type, graph_type>::list_type snapshot) : flow_(0),
+                                                                              snapshot_(std::move(snapshot)),
+                                                                              network_(snapshot_),
+                                                                              labels_(snapshot_.Size(), 0),
+                                                                              excess_(snapshot_.Size(), 0),
+                                                                              currentArcs_(snapshot_.Size(), 0),
+                                                                              activeHeads_(snapshot_.Size(), -1),
+                                                                              nextActive_(snapshot_.Size(), -1),
+                                                                              labeledHeads_(snapshot_.Size(), -1),
+                                                                              nextLabeled_(snapshot_.Size(), -1),
+                                                                              previousLabeled_(snapshot_.Size(), -1),
+                                                                              maxActive_(-1),
+                                                                              maxLabel_(-1),
+                                                                              work_(0),
+                                                                              pGraph_(nullptr)
+    {
+        queue_.reserve(snapshot_.Size());
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type, class graph_type>
+    void
+    push_relabel<id_type, graph_type>::run(
+            const typename push_relabel<id_type, graph_type>::vertex_type& source,
+            const typename push_relabel<id_type, graph_type>::vertex_type& sink)
+    {
+        const int sourceHandle = snapshot_.GetHandle(source);
+        const int sinkHandle = snapshot_.GetHandle(sink);
+
+        network_.reset();
+        flow_ = 0;
+
+        // nothing to send
+        if (sourceHandle == sinkHandle)
+        {
+            return;
+        }
+
+        push_relabel_inner(sourceHandle, sinkHandle);
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type, class graph_type>
+    int
+    push_relabel<id_type, graph_type>::get() const
+    {
+        return flow_;
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type, class graph_type>
+    const graph_type*
+    push_relabel<id_type, graph_type>::get_graph() const
+    {
+        return pGraph_;
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type, class graph_type>
+    utility::memory_usage
+    push_relabel<id_type, graph_type>::MemoryUsage() const
+    {
+        utility::memory_usage usage;
+        usage.auxiliary = snapshot_.MemoryUsage().total() +
+                          network_.memory() +
+                          utility::vector_bytes(labels_) +
+                          utility::vector_bytes(excess_) +
+                          utility::vector_bytes(currentArcs_) +
+                          utility::vector_bytes(activeHeads_) +
+                          utility::vector_bytes(nextActive_) +
+                          utility::vector_bytes(labeledHeads_) +
+                          utility::vector_bytes(nextLabeled_) +
+                          utility::vector_bytes(previousLabeled_) +
+                          utility::vector_bytes(queue_);
+
+        return usage;
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  Active buckets are singly linked stacks. A vertex may linger in a
+    //  bucket after losing its label or excess; such entries are skipped
+    //  when popped.
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type, class graph_type>
+    void
+    push_relabel<id_type, graph_type>::activate(int vertex)
+    {
+        int label = labels_[vertex];
+
+        nextActive_[vertex] = activeHeads_[label];
+        activeHeads_[label] = vertex;
+        maxActive_ = std::max(maxActive_, label);
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  Label buckets are doubly linked, so relabel removes a vertex in O(1)
+    //  and an emptied bucket reveals a gap.
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type, class graph_type>
+    void
+    push_relabel<id_type, graph_type>::insert_labeled(int vertex)
+    {
+        int label = labels_[vertex];
+        int head = labeledHeads_[label];
+
+        previousLabeled_[vertex] = -1;
+        nextLabeled_[vertex] = head;
+        if (head != -1)
+        {
+            previousLabeled_[head] = vertex;
+        }
+        labeledHeads_[label] = vertex;
+        maxLabel_ = std::max(maxLabel_, label);
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type, class graph_type>
+    void
+    push_relabel<id_type, graph_type>::remove_labeled(int vertex)
+    {
+        int previous = previousLabeled_[vertex];
+        int next = nextLabeled_[vertex];
+
+        if (previous != -1)
+        {
+            nextLabeled_[previous] = next;
+        }
+        else
+        {
+            labeledHeads_[labels_[vertex]] = next;
+        }
+        if (next != -1)
+        {
+            previousLabeled_[next] = previous;
+        }
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  Residual arc u -> w exists iff reverse of arc w -> u has residual
+    //  capacity, so BFS from sink walks vertex arcs and tests their reverse.
+    //  Vertices not reached cannot send flow to sink any more and keep label
+    //  size(), which takes them out of the discharge loop.
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type, class graph_type>
+    void
+    push_relabel<id_type, graph_type>::global_relabel(int source,
+                                                      int sink)
+    {
+        const int size = network_.size();
+
+        std::fill(labels_.begin(), labels_.end(), size);
+        std::fill(activeHeads_.begin(), activeHeads_.end(), -1);
+        std::fill(labeledHeads_.begin(), labeledHeads_.end(), -1);
+        maxActive_ = -1;
+        maxLabel_ = -1;
+        work_ = 0;
+
+        queue_.clear();
+        queue_.push_back(sink);
+        labels_[sink] = 0;
+        insert_labeled(sink);
+
+        for (std::size_t head = 0; head < queue_.size(); ++head)
+        {
+            int current = queue_[head];
+            int label = labels_[current] + 1;
+
+            for (int arc = network_.begin(current); arc < network_.end(current); ++arc)
+            {
+                int target = network_.head(arc);
+                if ((labels_[target] == size) &&
+                    (target != source) &&
+                    (network_.residual(network_.reverse(arc)) > 0))
+                {
+                    labels_[target] = label;
+                    currentArcs_[target] = network_.begin(target);
+                    insert_labeled(target);
+                    if (excess_[target] > 0)
+                    {
+                        activate(target);
+                    }
+                    queue_.push_back(target);
+                }
+            }
+        }
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  Every vertex labeled above an empty label has lost all residual paths
+    //  to sink, since labels drop by at most one along residual arcs.
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type, class graph_type>
+    void
+    push_relabel<id_type, graph_type>::gap(int label)
+    {
+        const int size = network_.size();
+
+        for (int current = label; current <= maxLabel_; ++current)
+        {
+            for (int vertex = labeledHeads_[current]; vertex != -1; vertex = nextLabeled_[vertex])
+            {
+                labels_[vertex] = size;
+            }
+            labeledHeads_[current] = -1;
+            activeHeads_[current] = -1;
+        }
+
+        maxLabel_ = label - 1;
+        maxActive_ = std::min(maxActive_, maxLabel_);
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  Pushes go over admissible arcs, label dropping by exactly one, starting
+    //  at current arc. With no admissible arc left the vertex is relabeled
+    //  to one above its lowest residual neighbour, unless it is alone at its
+    //  label - then the gap lifts it together with everything above.
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type, class graph_type>
+    void
+    push_relabel<id_type, graph_type>::discharge(int vertex,
+                                                 int sink)
+    {
+        const int size = network_.size();
+
+        while (excess_[vertex] > 0)
+        {
+            int label = labels_[vertex];
+
+            // push along admissible arcs
+            int& arc = currentArcs_[vertex];
+            for (; arc < network_.end(vertex); ++arc)
+            {
+                int target = network_.head(arc);
+                int residual = network_.residual(arc);
+                if ((residual > 0) && (labels_[target] == label - 1))
+                {
+                    int amount = std::min(excess_[vertex], residual);
+                    network_.push(arc, amount);
+                    excess_[vertex] -= amount;
+                    if ((excess_[target] == 0) && (target != sink))
+                    {
+                        excess_[target] = amount;
+                        activate(target);
+                    }
+                    else
+                    {
+                        excess_[target] += amount;
+                    }
+
+                    if (excess_[vertex] == 0)
+                    {
+                        break;
+                    }
+                }
+            }
+            if (excess_[vertex] == 0)
+            {
+                break;
+            }
+
+            // no vertex left at label: gap
+            if ((previousLabeled_[vertex] == -1) && (nextLabeled_[vertex] == -1))
+            {
+                gap(label);
+                break;
+            }
+
+            // relabel
+            int lowest = size;
+            int lowestArc = network_.begin(vertex);
+            for (int scan = network_.begin(vertex); scan < network_.end(vertex); ++scan)
+            {
+                if ((network_.residual(scan) > 0) && (labels_[network_.head(scan)] < lowest))
+                {
+                    lowest = labels_[network_.head(scan)];
+                    lowestArc = scan;
+                }
+            }
+            work_ += beta_ + (network_.end(vertex) - network_.begin(vertex));
+
+            remove_labeled(vertex);
+            if (lowest + 1 >= size)
+            {
+                labels_[vertex] = size;
+                break;
+            }
+            labels_[vertex] = lowest + 1;
+            currentArcs_[vertex] = lowestArc;
+            insert_labeled(vertex);
+        }
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  Source arcs are saturated up front and source keeps label size(), so
+    //  flow sent back to source stays there. Discharge always picks the
+    //  highest active label; global relabel is rerun once relabel work
+    //  exceeds alpha_ * V + E.
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type, class graph_type>
+    void
+    push_relabel<id_type, graph_type>::push_relabel_inner(int source,
+                                                          int sink)
+    {
+        const int size = network_.size();
+        const long long threshold = static_cast<long long>(alpha_) * size + network_.arc_count() / 2;
+
+        std::fill(excess_.begin(), excess_.end(), 0);
+
+        // saturate source arcs
+        for (int arc = network_.begin(source); arc < network_.end(source); ++arc)
+        {
+            int amount = network_.residual(arc);
+            if (amount > 0)
+            {
+                network_.push(arc, amount);
+                excess_[network_.head(arc)] += amount;
+            }
+        }
+        excess_[source] = 0;
+
+        global_relabel(source, sink);
+
+        while (maxActive_ >= 0)
+        {
+            int vertex = activeHeads_[maxActive_];
+            if (vertex == -1)
+            {
+                --maxActive_;
+                continue;
+            }
+            activeHeads_[maxActive_] = nextActive_[vertex];
+
+            // stale entry
+            if ((labels_[vertex] != maxActive_) || (excess_[vertex] == 0))
+            {
+                continue;
+            }
+
+            discharge(vertex, sink);
+
+            if (work_ > threshold)
+            {
+                global_relabel(source, sink);
+            }
+        }
+
+        flow_ = excess_[sink];
+    }
+
+} // namespace algorithm
+
+
+
+#endif // GRAPH_LIB_ALGORITHM_FLOW_PUSH_RELABEL_HPP
+//==============================================================================
+// End of push-relabel.hpp
+// (note: the newline at the end of the file is intentional)
+//==============================================================================
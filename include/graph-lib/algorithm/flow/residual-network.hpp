@@ -0,0 +1,934 @@
+//==============================================================================
+///
+/// @file residual-network.hpp
+///
+/// @brief Dense residual network of a graph snapshot.
+///
+/// Every snapshot arc u -> v becomes a pair of residual arcs: forward arc
+/// u -> v starting with arc capacity and reverse arc v -> u starting empty.
+/// Paired arcs refer to each other, so pushing flow over one of them is two
+/// array updates. Arcs are grouped by tail vertex in CSR form: forward arcs
+/// of a vertex in snapshot order, followed by reverse arcs of arcs entering
+/// it. Flow algorithms keep their whole state here and never touch graph
+/// edges while running.
+/// Capacities may be edited in place. An added arc pair goes to the ends
+/// of its vertex ranges, with flow of all arcs kept. A range with no free
+/// slot left is moved to the end of the arrays with room for twice its
+/// arcs, leaving its old slots unused, so an insertion costs amortized
+/// O(1) past the first one at a vertex, which copies its O(degree) arcs.
+/// Moved arcs change index, so callers drop cached arcs of both ends. Edge
+/// arc ids stay stable: snapshot arcs keep theirs, added arcs continue
+/// after.
+///
+/// The documentation is available on the following website:
+/// <website>
+///
+/// Support email: <email>
+///
+//==============================================================================
+
+//==============================================================================
+// Include only once
+//
+#ifndef GRAPH_LIB_ALGORITHM_FLOW_RESIDUAL_NETWORK_HPP
+#define GRAPH_LIB_ALGORITHM_FLOW_RESIDUAL_NETWORK_HPP
+
+
+//------------------------------------------------------------------------------
+// Include files
+//------------------------------------------------------------------------------
+// System
+// e.g.: #include <iostream>        // stdout
+#include <cstddef>                  // std::size_t
+#include <vector>
+
+// Project
+// e.g.: #include "IncludeFile.h"   // MyType_t
+#include "graph-lib/implementation/compressed-list.hpp"    // implementation::CompressedList
+#include "graph-lib/utility/memory.hpp"                     // utility::vector_bytes
+
+
+//------------------------------------------------------------------------------
+// Global references
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Constants
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Macros
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Forward declarations
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Data types
+//------------------------------------------------------------------------------
+namespace algorithm
+{
+    //------------------------------------------------------------------------------
+    /// @brief Residual network with paired reverse arcs.
+    ///
+    /// Residual arc a, begin(v) <= a < end(v), connects vertex v with vertex
+    /// head(a); reverse(a) connects them back.
+    ///
+    //------------------------------------------------------------------------------
+    template<class id_type>
+    class residual_network
+    {
+        using list_type             = implementation::CompressedList<id_type>;
+
+    public:
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Value constructor.
+        ///
+        /// @param[in] list Graph snapshot, arc capacities become forward capacities.
+        ///
+        //------------------------------------------------------------------------------
+        explicit residual_network(const list_type& list);
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Remove all flow.
+        ///
+        //------------------------------------------------------------------------------
+        void
+        reset();
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Send flow over residual arc.
+        ///
+        /// @param[in] arc Residual arc.
+        ///
+        /// @param[in] amount Flow, at most residual(arc).
+        ///
+        //------------------------------------------------------------------------------
+        void
+        push(int arc,
+             int amount);
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Change capacity of forward arc, keeping its flow.
+        ///
+        /// @param[in] arc Forward residual arc.
+        ///
+        /// @param[in] capacity New capacity, at least flow(arc).
+        ///
+        //------------------------------------------------------------------------------
+        void
+        set_capacity(int arc,
+                     int capacity);
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Add arc pair, keeping flow of all arcs.
+        ///
+        /// @param[in] tail Arc start vertex.
+        ///
+        /// @param[in] head Arc end vertex.
+        ///
+        /// @param[in] capacity Arc capacity.
+        ///
+        /// @return Forward residual arc, edge arc id edge_count() - 1.
+        ///
+        //------------------------------------------------------------------------------
+        int
+        add_arc(int tail,
+                int head,
+                int capacity);
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Number of vertices.
+        ///
+        /// @return Vertex count, equal to snapshot size.
+        ///
+        //------------------------------------------------------------------------------
+        int
+        size() const;
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Number of residual arc slots, arc indices are below it.
+        ///
+        /// @return Twice edge_count() plus slots left unused by add_arc().
+        ///
+        //------------------------------------------------------------------------------
+        int
+        arc_count() const;
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Number of edge arcs.
+        ///
+        /// @return Snapshot arc count plus added arcs.
+        ///
+        //------------------------------------------------------------------------------
+        int
+        edge_count() const;
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief First residual arc of a vertex.
+        ///
+        /// @param[in] vertex Vertex handle.
+        ///
+        /// @return Arc index.
+        ///
+        //------------------------------------------------------------------------------
+        int
+        begin(int vertex) const;
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief One past the last residual arc of a vertex.
+        ///
+        /// @param[in] vertex Vertex handle.
+        ///
+        /// @return Arc index.
+        ///
+        //------------------------------------------------------------------------------
+        int
+        end(int vertex) const;
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Residual arc end vertex.
+        ///
+        /// @param[in] arc Residual arc.
+        ///
+        /// @return Vertex handle.
+        ///
+        //------------------------------------------------------------------------------
+        int
+        head(int arc) const;
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Paired residual arc.
+        ///
+        /// @param[in] arc Residual arc.
+        ///
+        /// @return Arc in opposite direction.
+        ///
+        //------------------------------------------------------------------------------
+        int
+        reverse(int arc) const;
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Capacity of residual arc.
+        ///
+        /// @param[in] arc Residual arc.
+        ///
+        /// @return Edge capacity, 0 for reverse arcs.
+        ///
+        //------------------------------------------------------------------------------
+        int
+        capacity(int arc) const;
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Remaining capacity of residual arc.
+        ///
+        /// @param[in] arc Residual arc.
+        ///
+        /// @return Capacity left.
+        ///
+        //------------------------------------------------------------------------------
+        int
+        residual(int arc) const;
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Flow over residual arc.
+        ///
+        /// @param[in] arc Residual arc.
+        ///
+        /// @return Flow, negative for reverse arcs carrying flow back.
+        ///
+        //------------------------------------------------------------------------------
+        int
+        flow(int arc) const;
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Snapshot arc of residual arc.
+        ///
+        /// @param[in] arc Residual arc.
+        ///
+        /// @return Edge arc id, -1 for reverse arcs.
+        ///
+        //------------------------------------------------------------------------------
+        int
+        edge_arc(int arc) const;
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Forward residual arc of edge arc.
+        ///
+        /// @param[in] edgeArc Edge arc id.
+        ///
+        /// @return Residual arc.
+        ///
+        //------------------------------------------------------------------------------
+        int
+        forward_arc(int edgeArc) const;
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Heap bytes used.
+        ///
+        /// @return Byte count.
+        ///
+        //------------------------------------------------------------------------------
+        std::size_t
+        memory() const;
+
+    private:
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Make room for arcs at the end of a vertex range.
+        ///
+        /// @param[in] vertex Vertex handle.
+        ///
+        /// @param[in] count Free slots needed.
+        ///
+        //------------------------------------------------------------------------------
+        void
+        reserve(int vertex,
+                int count);
+
+    private:
+
+        /// @brief Arcs of vertex v are [begins_[v], ends_[v]).
+        std::vector<int> begins_;
+
+        /// @brief One past the last arc of every vertex.
+        std::vector<int> ends_;
+
+        /// @brief One past the last slot of every vertex range, free slots start at ends_.
+        std::vector<int> limits_;
+
+        /// @brief Arc end vertices.
+        std::vector<int> heads_;
+
+        /// @brief Paired arcs.
+        std::vector<int> reverse_;
+
+        /// @brief Initial capacities, 0 for reverse arcs.
+        std::vector<int> capacities_;
+
+        /// @brief Remaining capacities.
+        std::vector<int> residuals_;
+
+        /// @brief Edge arc id of forward arcs, -1 for reverse arcs.
+        std::vector<int> edgeArcs_;
+
+        /// @brief Forward residual arc of every edge arc.
+        std::vector<int> forwardArcs_;
+    };
+
+    //------------------------------------------------------------------------------
+    /// @brief Residual network arcs with remaining capacities kept outside.
+    ///
+    /// Several threads may run on one residual_network this way, each
+    /// pushing flow into a residual array of its own; the network itself is
+    /// only read. Same arc interface as residual_network.
+    ///
+    //------------------------------------------------------------------------------
+    template<class id_type>
+    class overlay_network
+    {
+        using network_type          = residual_network<id_type>;
+
+    public:
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Value constructor.
+        ///
+        /// @param[in] pNetwork Shared network, arcs and capacities.
+        ///
+        /// @param[in] pResiduals Remaining capacity of every residual arc.
+        ///
+        //------------------------------------------------------------------------------
+        overlay_network(const network_type* pNetwork,
+                        std::vector<int>* pResiduals);
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief First residual arc of a vertex.
+        ///
+        /// @param[in] vertex Vertex handle.
+        ///
+        /// @return Arc index.
+        ///
+        //------------------------------------------------------------------------------
+        int
+        begin(int vertex) const;
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief One past the last residual arc of a vertex.
+        ///
+        /// @param[in] vertex Vertex handle.
+        ///
+        /// @return Arc index.
+        ///
+        //------------------------------------------------------------------------------
+        int
+        end(int vertex) const;
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Residual arc end vertex.
+        ///
+        /// @param[in] arc Residual arc.
+        ///
+        /// @return Vertex handle.
+        ///
+        //------------------------------------------------------------------------------
+        int
+        head(int arc) const;
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Remaining capacity of residual arc.
+        ///
+        /// @param[in] arc Residual arc.
+        ///
+        /// @return Capacity left.
+        ///
+        //------------------------------------------------------------------------------
+        int
+        residual(int arc) const;
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Send flow over residual arc.
+        ///
+        /// @param[in] arc Residual arc.
+        ///
+        /// @param[in] amount Flow, at most residual(arc).
+        ///
+        //------------------------------------------------------------------------------
+        void
+        push(int arc,
+             int amount);
+
+    private:
+
+        /// @brief Shared network.
+        const network_type* pNetwork_;
+
+        /// @brief Remaining capacities.
+        std::vector<int>* pResiduals_;
+    };
+
+} // namespace algorithm
+
+
+//------------------------------------------------------------------------------
+// Function declarations
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Variable definitions
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Function definitions
+//------------------------------------------------------------------------------
+namespace algorithm
+{
+    //------------------------------------------------------------------------------
+    //
+    //  Forward arcs of a vertex take the first Degree(v) slots of its range,
+    //  in snapshot order, so forward arc of snapshot arc a of vertex u sits
+    //  at begins_[u] + a - Begin(u). Reverse arcs fill remaining slots.
+    //  Ranges start full.
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type>
+    residual_network<id_type>::residual_network(
+            const typename residual_network<id_type>::list_type& list)
+    {
+        const int size = list.Size();
+        const int arcs = 2 * list.EdgeCount();
+
+        // residual degree: own arcs plus entering arcs
+        std::vector<int> offsets(size + 1, 0);
+        for (int vertex = 0; vertex < size; ++vertex)
+        {
+            offsets[vertex + 1] += list.Degree(vertex);
+            for (int arc = list.Begin(vertex); arc < list.End(vertex); ++arc)
+            {
+                ++offsets[list.Target(arc) + 1];
+            }
+        }
+        for (int vertex = 0; vertex < size; ++vertex)
+        {
+            offsets[vertex + 1] += offsets[vertex];
+        }
+
+        begins_.assign(offsets.begin(), offsets.end() - 1);
+        ends_.assign(offsets.begin() + 1, offsets.end());
+        limits_ = ends_;
+
+        heads_.resize(arcs);
+        reverse_.resize(arcs);
+        capacities_.resize(arcs);
+        edgeArcs_.resize(arcs);
+        forwardArcs_.resize(list.EdgeCount());
+
+        // reverse slots start after forward arcs
+        std::vector<int> cursor(size);
+        for (int vertex = 0; vertex < size; ++vertex)
+        {
+            cursor[vertex] = begins_[vertex] + list.Degree(vertex);
+        }
+
+        for (int vertex = 0; vertex < size; ++vertex)
+        {
+            for (int arc = list.Begin(vertex); arc < list.End(vertex); ++arc)
+            {
+                int target = list.Target(arc);
+                int forward = begins_[vertex] + (arc - list.Begin(vertex));
+                int backward = cursor[target]++;
+
+                heads_[forward] = target;
+                reverse_[forward] = backward;
+                capacities_[forward] = list.Capacity(arc);
+                edgeArcs_[forward] = arc;
+
+                heads_[backward] = vertex;
+                reverse_[backward] = forward;
+                capacities_[backward] = 0;
+                edgeArcs_[backward] = -1;
+
+                forwardArcs_[arc] = forward;
+            }
+        }
+
+        residuals_ = capacities_;
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type>
+    void
+    residual_network<id_type>::reset()
+    {
+        residuals_ = capacities_;
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type>
+    void
+    residual_network<id_type>::push(int arc,
+                                    int amount)
+    {
+        residuals_[arc] -= amount;
+        residuals_[reverse_[arc]] += amount;
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type>
+    void
+    residual_network<id_type>::set_capacity(int arc,
+                                            int capacity)
+    {
+        int flow = capacities_[arc] - residuals_[arc];
+
+        capacities_[arc] = capacity;
+        residuals_[arc] = capacity - flow;
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  Self loop takes two slots of its vertex, any other pair one slot of
+    //  tail and one of head.
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type>
+    int
+    residual_network<id_type>::add_arc(int tail,
+                                       int head,
+                                       int capacity)
+    {
+        if (tail == head)
+        {
+            reserve(tail, 2);
+        }
+        else
+        {
+            reserve(tail, 1);
+            reserve(head, 1);
+        }
+
+        int forward = ends_[tail]++;
+        int backward = ends_[head]++;
+
+        heads_[forward] = head;
+        reverse_[forward] = backward;
+        capacities_[forward] = capacity;
+        residuals_[forward] = capacity;
+        edgeArcs_[forward] = static_cast<int>(forwardArcs_.size());
+
+        heads_[backward] = tail;
+        reverse_[backward] = forward;
+        capacities_[backward] = 0;
+        residuals_[backward] = 0;
+        edgeArcs_[backward] = -1;
+
+        forwardArcs_.push_back(forward);
+
+        return forward;
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type>
+    int
+    residual_network<id_type>::size() const
+    {
+        return static_cast<int>(begins_.size());
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type>
+    int
+    residual_network<id_type>::arc_count() const
+    {
+        return static_cast<int>(heads_.size());
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type>
+    int
+    residual_network<id_type>::edge_count() const
+    {
+        return static_cast<int>(forwardArcs_.size());
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type>
+    int
+    residual_network<id_type>::begin(int vertex) const
+    {
+        return begins_[vertex];
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type>
+    int
+    residual_network<id_type>::end(int vertex) const
+    {
+        return ends_[vertex];
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type>
+    int
+    residual_network<id_type>::head(int arc) const
+    {
+        return heads_[arc];
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type>
+    int
+    residual_network<id_type>::reverse(int arc) const
+    {
+        return reverse_[arc];
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type>
+    int
+    residual_network<id_type>::capacity(int arc) const
+    {
+        return capacities_[arc];
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type>
+    int
+    residual_network<id_type>::residual(int arc) const
+    {
+        return residuals_[arc];
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type>
+    int
+    residual_network<id_type>::flow(int arc) const
+    {
+        return capacities_[arc] - residuals_[arc];
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type>
+    int
+    residual_network<id_type>::edge_arc(int arc) const
+    {
+        return edgeArcs_[arc];
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type>
+    int
+    residual_network<id_type>::forward_arc(int edgeArc) const
+    {
+        return forwardArcs_[edgeArc];
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type>
+    std::size_t
+    residual_network<id_type>::memory() const
+    {
+        return utility::vector_bytes(begins_) +
+               utility::vector_bytes(ends_) +
+               utility::vector_bytes(limits_) +
+               utility::vector_bytes(heads_) +
+               utility::vector_bytes(reverse_) +
+               utility::vector_bytes(capacities_) +
+               utility::vector_bytes(residuals_) +
+               utility::vector_bytes(edgeArcs_) +
+               utility::vector_bytes(forwardArcs_);
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  Range is copied to the end of the arrays in arc order. Reverse links
+    //  of arcs outside the range are pointed at the new slots; links within
+    //  the range (self loops) move with it. Old slots keep no capacity and
+    //  pair with themselves, but are never scanned again.
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type>
+    void
+    residual_network<id_type>::reserve(int vertex,
+                                       int count)
+    {
+        if (ends_[vertex] + count <= limits_[vertex])
+        {
+            return;
+        }
+
+        const int first = begins_[vertex];
+        const int last = ends_[vertex];
+        const int moved = arc_count();
+        const int slots = 2 * (last - first + count);
+
+        heads_.resize(moved + slots, vertex);
+        reverse_.resize(moved + slots);
+        capacities_.resize(moved + slots, 0);
+        residuals_.resize(moved + slots, 0);
+        edgeArcs_.resize(moved + slots, -1);
+
+        for (int arc = first; arc < last; ++arc)
+        {
+            int target = moved + (arc - first);
+            int paired = reverse_[arc];
+
+            heads_[target] = heads_[arc];
+            capacities_[target] = capacities_[arc];
+            residuals_[target] = residuals_[arc];
+            edgeArcs_[target] = edgeArcs_[arc];
+            if ((paired >= first) && (paired < last))
+            {
+                reverse_[target] = moved + (paired - first);
+            }
+            else
+            {
+                reverse_[target] = paired;
+                reverse_[paired] = target;
+            }
+            if (edgeArcs_[arc] != -1)
+            {
+                forwardArcs_[edgeArcs_[arc]] = target;
+            }
+
+            capacities_[arc] = 0;
+            residuals_[arc] = 0;
+            edgeArcs_[arc] = -1;
+            reverse_[arc] = arc;
+        }
+        for (int arc = moved + (last - first); arc < moved + slots; ++arc)
+        {
+            reverse_[arc] = arc;
+        }
+
+        begins_[vertex] = moved;
+        ends_[vertex] = moved + (last - first);
+        limits_[vertex] = moved + slots;
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type>
+    overlay_network<id_type>::overlay_network(
+            const typename overlay_network<id_type>::network_type* pNetwork,
+            std::vector<int>* pResiduals) : pNetwork_(pNetwork),
+                                            pResiduals_(pResiduals)
+    {   }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type>
+    int
+    overlay_network<id_type>::begin(int vertex) const
+    {
+        return pNetwork_->begin(vertex);
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type>
+    int
+    overlay_network<id_type>::end(int vertex) const
+    {
+        return pNetwork_->end(vertex);
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type>
+    int
+    overlay_network<id_type>::head(int arc) const
+    {
+        return pNetwork_->head(arc);
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type>
+    int
+    overlay_network<id_type>::residual(int arc) const
+    {
+        return (*pResiduals_)[arc];
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type>
+    void
+    overlay_network<id_type>::push(int arc,
+                                   int amount)
+    {
+        (*pResiduals_)[arc] -= amount;
+        (*pResiduals_)[pNetwork_->reverse(arc)] += amount;
+    }
+
+} // namespace algorithm
+
+
+
+#endif // GRAPH_LIB_ALGORITHM_FLOW_RESIDUAL_NETWORK_HPP
+//==============================================================================
+// End of residual-network.hpp
+// (note: the newline at the end of the file is intentional)
+//==============================================================================
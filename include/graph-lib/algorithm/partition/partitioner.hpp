@@ -0,0 +1,1069 @@
+//==============================================================================
+///
+/// @file partitioner.hpp
+///
+/// @brief Graph partitioning into shards.
+///
+/// Partitioner splits graph vertices into K parts and builds a shard per part.
+/// Shard is a local CompressedList containing owned vertices followed by
+/// ghost vertices - copies of remote endpoints of cut arcs, which carry no
+/// outgoing arcs themselves. Each ghost records its owner part and handle in
+/// the owner shard, each owned vertex with a cut arc is listed as boundary.
+/// Global handle -> (part, local handle) mapping is kept by partitioner.
+/// Supported schemes:
+///     - hash - part is vertex id hash modulo K.
+///     - range - contiguous ranges of global handles of equal size.
+///     - multilevel - heavy edge matching coarsening, greedy graph growing
+///     initial partition and boundary refinement on every uncoarsening level,
+///     minimizing edge cut under balance constraint.
+///
+/// The documentation is available on the following website:
+/// <website>
+///
+/// Support email: <email>
+///
+//==============================================================================
+
+//==============================================================================
+// Include only once
+//
+#ifndef GRAPH_LIB_ALGORITHM_PARTITION_PARTITIONER_HPP
+#define GRAPH_LIB_ALGORITHM_PARTITION_PARTITIONER_HPP
+
+
+//------------------------------------------------------------------------------
+// Include files
+//------------------------------------------------------------------------------
+// System
+// e.g.: #include <iostream>        // stdout
+#include <vector>
+#include <map>
+#include <utility>                  // std::pair
+#include <algorithm>                // std::max, std::sort, std::push_heap
+#include <numeric>                  // std::iota
+#include <functional>               // std::hash
+#include <stdexcept>                // std::invalid_argument
+
+// Project
+// e.g.: #include "IncludeFile.h"   // MyType_t
+#include "graph-lib/component/vertex.hpp"                  // component::Vertex
+#include "graph-lib/implementation/compressed-list.hpp"     // implementation::CompressedList
+#include "graph-lib/utility/memory.hpp"                     // utility::memory_usage
+
+
+//------------------------------------------------------------------------------
+// Global references
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Constants
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Macros
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Forward declarations
+//------------------------------------------------------------------------------
+namespace graph
+{
+    template<class id_type,
+             typename implementation_type>
+    class Graph;
+}
+
+
+//------------------------------------------------------------------------------
+// Data types
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+/// @brief Common graph algorithms.
+///
+//------------------------------------------------------------------------------
+namespace algorithm
+{
+    //------------------------------------------------------------------------------
+    /// @brief Algorithm traits.
+    //------------------------------------------------------------------------------
+    namespace traits
+    {
+        //------------------------------------------------------------------------------
+        /// @brief Encapsulates partitioning schemes.
+        //------------------------------------------------------------------------------
+        enum class partition_scheme
+        {
+            /// @brief Vertex id hash.
+            hash,
+            /// @brief Contiguous handle ranges.
+            range,
+            /// @brief Multilevel edge cut minimization.
+            multilevel
+        };
+
+    } // namespace traits
+
+    //------------------------------------------------------------------------------
+    /// @brief Single partition of a graph.
+    ///
+    //------------------------------------------------------------------------------
+    template<class id_type>
+    struct shard
+    {
+        /// @brief Local graph: handles [0, owned) are owned, the rest are ghosts.
+        implementation::CompressedList<id_type> list;
+
+        /// @brief Number of owned vertices.
+        int owned = 0;
+
+        /// @brief Local handle -> global handle.
+        std::vector<int> global;
+
+        /// @brief Ghost (local handle - owned) -> owner part.
+        std::vector<int> ghost_owner;
+
+        /// @brief Ghost (local handle - owned) -> local handle in owner shard.
+        std::vector<int> ghost_remote;
+
+        /// @brief Owned local handles having arcs to other parts.
+        std::vector<int> boundary;
+    };
+
+    //------------------------------------------------------------------------------
+    /// @brief Partition quality report.
+    ///
+    //------------------------------------------------------------------------------
+    struct partition_statistics
+    {
+        /// @brief Arcs with endpoints in different parts.
+        int edge_cut = 0;
+
+        /// @brief Largest part size divided by average part size.
+        double balance = 0.0;
+
+        /// @brief Owned vertex count of every part.
+        std::vector<int> sizes;
+    };
+
+    //------------------------------------------------------------------------------
+    /// @brief Graph partitioner implementation.
+    ///
+    //------------------------------------------------------------------------------
+    template<class id_type>
+    class partitioner
+    {
+        using vertex_type           = component::Vertex<id_type>;
+        using graph_type            = graph::Graph<id_type>;
+        using list_type             = implementation::CompressedList<id_type>;
+        using shard_type            = shard<id_type>;
+
+        //------------------------------------------------------------------------------
+        /// @brief Undirected weighted graph used by multilevel scheme.
+        //------------------------------------------------------------------------------
+        struct level_graph
+        {
+            std::vector<int> offsets;
+            std::vector<int> targets;
+            std::vector<int> weights;
+            std::vector<int> vertexWeights;
+        };
+
+    public:
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Value constructor.
+        ///
+        /// @param[in] pGraph Input graph pointer.
+        ///
+        //------------------------------------------------------------------------------
+        partitioner(const graph_type* pGraph);
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Snapshot constructor.
+        ///
+        /// Results refer to snapshot handles (see reordering.hpp).
+        ///
+        /// @param[in] snapshot Graph snapshot, get_graph() returns nullptr.
+        ///
+        //------------------------------------------------------------------------------
+        explicit partitioner(list_type snapshot);
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Split graph into parts and build shards.
+        ///
+        /// @param[in] parts Number of parts.
+        ///
+        /// @param[in] scheme Partitioning scheme.
+        ///
+        /// @param[in] imbalance Allowed part size excess over average
+        ///                      (multilevel scheme only).
+        ///
+        //------------------------------------------------------------------------------
+        void
+        run(int parts,
+            traits::partition_scheme scheme = traits::partition_scheme::multilevel,
+            double imbalance = 0.03);
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Get algorithm execution results.
+        ///
+        /// @return Shards, indexed by part.
+        ///
+        //------------------------------------------------------------------------------
+        const std::vector<shard_type>&
+        get() const;
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Get partition quality.
+        ///
+        /// @return Edge cut and balance statistics.
+        ///
+        //------------------------------------------------------------------------------
+        const partition_statistics&
+        get_statistics() const;
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Locate vertex in shards.
+        ///
+        /// @param[in] vertex Input vertex.
+        ///
+        /// @return <owner part, local handle in owner shard> pair.
+        ///
+        //------------------------------------------------------------------------------
+        std::pair<int, int>
+        locate(const vertex_type& vertex) const;
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Get global snapshot partitioning was computed on.
+        ///
+        /// @return Global snapshot, its handles are global handles.
+        ///
+        //------------------------------------------------------------------------------
+        const list_type&
+        get_global() const;
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Get algorithm's graph.
+        ///
+        /// @return Reference to graph object.
+        ///
+        //------------------------------------------------------------------------------
+        const graph_type*
+        get_graph() const;
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Heap memory used by algorithm state.
+        ///
+        /// @return Memory usage report, shards are reported as graph memory.
+        ///
+        //------------------------------------------------------------------------------
+        utility::memory_usage
+        MemoryUsage() const;
+
+
+    private:
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Hash partitioning.
+        ///
+        //------------------------------------------------------------------------------
+        void
+        partition_hash(int parts);
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Range partitioning.
+        ///
+        //------------------------------------------------------------------------------
+        void
+        partition_range(int parts);
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Multilevel partitioning.
+        ///
+        //------------------------------------------------------------------------------
+        void
+        partition_multilevel(int parts,
+                             double imbalance);
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Build undirected weighted graph from global snapshot.
+        ///
+        //------------------------------------------------------------------------------
+        level_graph
+        symmetrize() const;
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Contract heavy edge matching.
+        ///
+        /// @param[in] fine Input graph.
+        ///
+        /// @param[out] map Fine vertex -> coarse vertex.
+        ///
+        /// @return Coarse graph.
+        ///
+        //------------------------------------------------------------------------------
+        level_graph
+        coarsen(const level_graph& fine,
+                std::vector<int>& map) const;
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Greedy graph growing partition of the coarsest graph.
+        ///
+        //------------------------------------------------------------------------------
+        std::vector<int>
+        initial_partition(const level_graph& graph,
+                          int parts) const;
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Greedy boundary refinement.
+        ///
+        //------------------------------------------------------------------------------
+        void
+        refine(const level_graph& graph,
+               std::vector<int>& part,
+               int parts,
+               double imbalance) const;
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Build shards and statistics from owner_.
+        ///
+        //------------------------------------------------------------------------------
+        void
+        build_shards(int parts);
+
+    private:
+
+        /// @brief Global snapshot.
+        list_type global_;
+
+        /// @brief Global handle -> part.
+        std::vector<int> owner_;
+
+        /// @brief Global handle -> local handle in owner shard.
+        std::vector<int> local_;
+
+        /// @brief Shards.
+        std::vector<shard_type> shards_;
+
+        /// @brief Partition quality.
+        partition_statistics statistics_;
+
+        /// @brief Graph.
+        const graph_type* pGraph_;
+    };
+
+} // namespace algorithm
+
+
+//------------------------------------------------------------------------------
+// Function declarations
+//------------------------------------------------------------------------------
+
+
+//------------------------------------------------------------------------------
+// Variable definitions
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Function definitions
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+//
+// Algorithms namespace
+//
+//------------------------------------------------------------------------------
+namespace algorithm
+{
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type>
+    partitioner<id_type>::partitioner(
+            const typename partitioner<id_type>::graph_type* pGraph) : partitioner(list_type(*pGraph))
+    {
+        pGraph_ = pGraph;
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type>
+    partitioner<id_type>::partitioner(
+            typename partitioner<id_type>::list_type snapshot) : global_(std::move(snapshot)),
+                                                                 pGraph_(nullptr)
+    {   }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type>
+    void
+    partitioner<id_type>::run(int parts,
+                              traits::partition_scheme scheme,
+                              double imbalance)
+    {
+        if (parts < 1)
+        {
+            throw std::invalid_argument("Number of parts must be positive");
+        }
+
+        owner_.assign(global_.Size(), 0);
+
+        switch (scheme)
+        {
+            case traits::partition_scheme::hash:
+                partition_hash(parts);
+                break;
+
+            case traits::partition_scheme::range:
+                partition_range(parts);
+                break;
+
+            case traits::partition_scheme::multilevel:
+            default:
+                partition_multilevel(parts, imbalance);
+                break;
+        }
+
+        build_shards(parts);
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type>
+    const std::vector<typename partitioner<id_type>::shard_type>&
+    partitioner<id_type>::get() const
+    {
+        return shards_;
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type>
+    const partition_statistics&
+    partitioner<id_type>::get_statistics() const
+    {
+        return statistics_;
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type>
+    std::pair<int, int>
+    partitioner<id_type>::locate(
+            const typename partitioner<id_type>::vertex_type& vertex) const
+    {
+        int handle = global_.GetHandle(vertex);
+
+        return std::make_pair(owner_.at(handle), local_.at(handle));
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type>
+    const typename partitioner<id_type>::list_type&
+    partitioner<id_type>::get_global() const
+    {
+        return global_;
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type>
+    const typename partitioner<id_type>::graph_type*
+    partitioner<id_type>::get_graph() const
+    {
+        return pGraph_;
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type>
+    utility::memory_usage
+    partitioner<id_type>::MemoryUsage() const
+    {
+        utility::memory_usage usage = global_.MemoryUsage();
+
+        for (const auto& part : shards_)
+        {
+            usage += part.list.MemoryUsage();
+            usage.auxiliary += utility::vector_bytes(part.global) +
+                               utility::vector_bytes(part.ghost_owner) +
+                               utility::vector_bytes(part.ghost_remote) +
+                               utility::vector_bytes(part.boundary);
+        }
+        usage.auxiliary += utility::vector_bytes(owner_) +
+                           utility::vector_bytes(local_) +
+                           utility::vector_bytes(shards_);
+
+        return usage;
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type>
+    void
+    partitioner<id_type>::partition_hash(int parts)
+    {
+        for (int v = 0; v < global_.Size(); ++v)
+        {
+            owner_[v] = static_cast<int>(
+                std::hash<id_type>()(global_.GetVertex(v).Id()) % parts);
+        }
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type>
+    void
+    partitioner<id_type>::partition_range(int parts)
+    {
+        long long size = global_.Size();
+
+        for (int v = 0; v < global_.Size(); ++v)
+        {
+            owner_[v] = static_cast<int>(v * parts / size);
+        }
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  Coarsen until graph is small or stops shrinking, partition the coarsest
+    //  level, then project back refining on every level.
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type>
+    void
+    partitioner<id_type>::partition_multilevel(int parts,
+                                               double imbalance)
+    {
+        std::vector<level_graph> levels;
+        std::vector<std::vector<int>> maps;
+
+        levels.push_back(symmetrize());
+
+        const int coarsestSize = std::max(20 * parts, 64);
+        while (static_cast<int>(levels.back().vertexWeights.size()) > coarsestSize)
+        {
+            std::vector<int> map;
+            level_graph coarse = coarsen(levels.back(), map);
+
+            // matching found almost nothing to contract
+            if (coarse.vertexWeights.size() * 10 > levels.back().vertexWeights.size() * 9)
+            {
+                break;
+            }
+
+            maps.push_back(std::move(map));
+            levels.push_back(std::move(coarse));
+        }
+
+        std::vector<int> part = initial_partition(levels.back(), parts);
+        refine(levels.back(), part, parts, imbalance);
+
+        for (int level = static_cast<int>(maps.size()) - 1; level >= 0; --level)
+        {
+            std::vector<int> finePart(maps[level].size());
+            for (std::size_t v = 0; v < finePart.size(); ++v)
+            {
+                finePart[v] = part[maps[level][v]];
+            }
+            part.swap(finePart);
+
+            refine(levels[level], part, parts, imbalance);
+        }
+
+        owner_ = std::move(part);
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  Arc direction is dropped, parallel arcs are merged into weight.
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type>
+    typename partitioner<id_type>::level_graph
+    partitioner<id_type>::symmetrize() const
+    {
+        int size = global_.Size();
+        std::vector<std::map<int, int>> adjacency(size);
+
+        for (int v = 0; v < size; ++v)
+        {
+            for (int arc = global_.Begin(v); arc < global_.End(v); ++arc)
+            {
+                int target = global_.Target(arc);
+                if (target != v)
+                {
+                    ++adjacency[v][target];
+                    ++adjacency[target][v];
+                }
+            }
+        }
+
+        level_graph result;
+        result.vertexWeights.assign(size, 1);
+        result.offsets.push_back(0);
+        for (int v = 0; v < size; ++v)
+        {
+            for (const auto& entry : adjacency[v])
+            {
+                result.targets.push_back(entry.first);
+                result.weights.push_back(entry.second);
+            }
+            result.offsets.push_back(static_cast<int>(result.targets.size()));
+        }
+
+        return result;
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  Each unmatched vertex is matched with unmatched neighbour connected by
+    //  the heaviest edge; lighter vertices are visited first to keep coarse
+    //  vertex weights even.
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type>
+    typename partitioner<id_type>::level_graph
+    partitioner<id_type>::coarsen(
+            const typename partitioner<id_type>::level_graph& fine,
+            std::vector<int>& map) const
+    {
+        int size = static_cast<int>(fine.vertexWeights.size());
+
+        std::vector<int> visitOrder(size);
+        std::iota(visitOrder.begin(), visitOrder.end(), 0);
+        std::stable_sort(visitOrder.begin(), visitOrder.end(),
+            [&fine](int lhs, int rhs)
+            {
+                return fine.vertexWeights[lhs] < fine.vertexWeights[rhs];
+            });
+
+        map.assign(size, -1);
+        int coarseSize = 0;
+        for (auto v : visitOrder)
+        {
+            if (map[v] != -1)
+            {
+                continue;
+            }
+
+            int mate = -1;
+            int mateWeight = 0;
+            for (int arc = fine.offsets[v]; arc < fine.offsets[v + 1]; ++arc)
+            {
+                int target = fine.targets[arc];
+                if (map[target] == -1 && fine.weights[arc] > mateWeight)
+                {
+                    mate = target;
+                    mateWeight = fine.weights[arc];
+                }
+            }
+
+            map[v] = coarseSize;
+            if (mate != -1)
+            {
+                map[mate] = coarseSize;
+            }
+            ++coarseSize;
+        }
+
+        // contract
+        level_graph coarse;
+        coarse.vertexWeights.assign(coarseSize, 0);
+        std::vector<std::vector<int>> members(coarseSize);
+        for (int v = 0; v < size; ++v)
+        {
+            coarse.vertexWeights[map[v]] += fine.vertexWeights[v];
+            members[map[v]].push_back(v);
+        }
+
+        std::vector<int> slot(coarseSize, -1);
+        coarse.offsets.push_back(0);
+        for (int c = 0; c < coarseSize; ++c)
+        {
+            int begin = static_cast<int>(coarse.targets.size());
+            for (auto v : members[c])
+            {
+                for (int arc = fine.offsets[v]; arc < fine.offsets[v + 1]; ++arc)
+                {
+                    int target = map[fine.targets[arc]];
+                    if (target == c)
+                    {
+                        continue;
+                    }
+                    if (slot[target] < begin)
+                    {
+                        slot[target] = static_cast<int>(coarse.targets.size());
+                        coarse.targets.push_back(target);
+                        coarse.weights.push_back(0);
+                    }
+                    coarse.weights[slot[target]] += fine.weights[arc];
+                }
+            }
+            coarse.offsets.push_back(static_cast<int>(coarse.targets.size()));
+        }
+
+        return coarse;
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  Parts are grown one after another from an unassigned vertex, always
+    //  adding the frontier vertex most connected to the growing part, until
+    //  part reaches its share of total weight. Last part takes the rest.
+    //  Frontier is a max-heap of (connection, vertex) with lazy deletion:
+    //  every connection change pushes a new entry, entries of assigned
+    //  vertices or with outdated connection are skipped when popped.
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type>
+    std::vector<int>
+    partitioner<id_type>::initial_partition(
+            const typename partitioner<id_type>::level_graph& graph,
+            int parts) const
+    {
+        int size = static_cast<int>(graph.vertexWeights.size());
+        long long totalWeight = 0;
+        for (auto weight : graph.vertexWeights)
+        {
+            totalWeight += weight;
+        }
+
+        std::vector<int> part(size, parts - 1);
+        std::vector<char> assigned(size, 0);
+        std::vector<int> connection(size, 0);
+        long long assignedWeight = 0;
+        int seed = 0;
+
+        for (int p = 0; p + 1 < parts; ++p)
+        {
+            long long target = (totalWeight - assignedWeight) / (parts - p);
+            long long partWeight = 0;
+            std::vector<std::pair<int, int>> frontier;
+            std::vector<int> touched;
+
+            while (partWeight < target)
+            {
+                // pick most connected frontier vertex, or a new seed
+                int best = -1;
+                while (!frontier.empty() && best == -1)
+                {
+                    std::pop_heap(frontier.begin(), frontier.end());
+                    auto entry = frontier.back();
+                    frontier.pop_back();
+                    if (!assigned[entry.second] && entry.first == connection[entry.second])
+                    {
+                        best = entry.second;
+                    }
+                }
+                if (best == -1)
+                {
+                    while (seed < size && assigned[seed])
+                    {
+                        ++seed;
+                    }
+                    if (seed == size)
+                    {
+                        break;
+                    }
+                    best = seed;
+                }
+
+                assigned[best] = 1;
+                part[best] = p;
+                partWeight += graph.vertexWeights[best];
+
+                for (int arc = graph.offsets[best]; arc < graph.offsets[best + 1]; ++arc)
+                {
+                    int neighbour = graph.targets[arc];
+                    if (!assigned[neighbour])
+                    {
+                        if (connection[neighbour] == 0)
+                        {
+                            touched.push_back(neighbour);
+                        }
+                        connection[neighbour] += graph.weights[arc];
+                        frontier.emplace_back(connection[neighbour], neighbour);
+                        std::push_heap(frontier.begin(), frontier.end());
+                    }
+                }
+            }
+
+            for (auto v : touched)
+            {
+                connection[v] = 0;
+            }
+            assignedWeight += partWeight;
+        }
+
+        return part;
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  Boundary vertex moves to the neighbouring part it is most connected to
+    //  if it decreases cut and keeps target part under the balance limit, or
+    //  if it relieves an overloaded part. Few passes are enough in practice.
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type>
+    void
+    partitioner<id_type>::refine(
+            const typename partitioner<id_type>::level_graph& graph,
+            std::vector<int>& part,
+            int parts,
+            double imbalance) const
+    {
+        int size = static_cast<int>(graph.vertexWeights.size());
+
+        std::vector<long long> partWeight(parts, 0);
+        long long totalWeight = 0;
+        for (int v = 0; v < size; ++v)
+        {
+            partWeight[part[v]] += graph.vertexWeights[v];
+            totalWeight += graph.vertexWeights[v];
+        }
+        const double limit = (1.0 + imbalance) * static_cast<double>(totalWeight) / parts;
+
+        std::vector<long long> connection(parts, 0);
+        std::vector<int> touched;
+        for (int pass = 0; pass < 8; ++pass)
+        {
+            bool moved = false;
+
+            for (int v = 0; v < size; ++v)
+            {
+                int from = part[v];
+
+                // connectivity of v to every adjacent part
+                touched.clear();
+                for (int arc = graph.offsets[v]; arc < graph.offsets[v + 1]; ++arc)
+                {
+                    int p = part[graph.targets[arc]];
+                    if (connection[p] == 0)
+                    {
+                        touched.push_back(p);
+                    }
+                    connection[p] += graph.weights[arc];
+                }
+
+                int best = from;
+                long long bestGain = 0;
+                for (auto p : touched)
+                {
+                    if (p == from)
+                    {
+                        continue;
+                    }
+
+                    long long gain = connection[p] - connection[from];
+                    bool fits = partWeight[p] + graph.vertexWeights[v] <= limit;
+                    bool relieves = partWeight[from] > limit &&
+                                    partWeight[p] + graph.vertexWeights[v] < partWeight[from];
+
+                    if ((fits && gain > bestGain) || (relieves && best == from))
+                    {
+                        best = p;
+                        bestGain = gain;
+                    }
+                }
+
+                for (auto p : touched)
+                {
+                    connection[p] = 0;
+                }
+                connection[from] = 0;
+
+                if (best != from)
+                {
+                    partWeight[from] -= graph.vertexWeights[v];
+                    partWeight[best] += graph.vertexWeights[v];
+                    part[v] = best;
+                    moved = true;
+                }
+            }
+
+            if (!moved)
+            {
+                break;
+            }
+        }
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  Owned vertices keep global handle order; ghosts are numbered in order
+    //  of first reference.
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type>
+    void
+    partitioner<id_type>::build_shards(int parts)
+    {
+        int size = global_.Size();
+
+        // local handles of owned vertices
+        local_.assign(size, 0);
+        statistics_ = partition_statistics();
+        statistics_.sizes.assign(parts, 0);
+        for (int v = 0; v < size; ++v)
+        {
+            local_[v] = statistics_.sizes[owner_[v]]++;
+        }
+
+        shards_.clear();
+        shards_.resize(parts);
+
+        std::vector<int> ghostLocal(size, -1);
+        for (int p = 0; p < parts; ++p)
+        {
+            auto& current = shards_[p];
+            current.owned = statistics_.sizes[p];
+
+            std::vector<component::Vertex<id_type>> vertices;
+            std::vector<int> offsets(1, 0);
+            std::vector<int> targets;
+            std::vector<int> weights;
+            std::vector<int> capacities;
+
+            for (int v = 0; v < size; ++v)
+            {
+                if (owner_[v] == p)
+                {
+                    current.global.push_back(v);
+                    vertices.push_back(global_.GetVertex(v));
+                }
+            }
+
+            for (int local = 0; local < current.owned; ++local)
+            {
+                int v = current.global[local];
+                bool isBoundary = false;
+
+                for (int arc = global_.Begin(v); arc < global_.End(v); ++arc)
+                {
+                    int target = global_.Target(arc);
+                    int targetLocal = local_[target];
+
+                    if (owner_[target] != p)
+                    {
+                        isBoundary = true;
+                        ++statistics_.edge_cut;
+
+                        if (ghostLocal[target] == -1)
+                        {
+                            ghostLocal[target] = static_cast<int>(vertices.size());
+                            vertices.push_back(global_.GetVertex(target));
+                            current.global.push_back(target);
+                            current.ghost_owner.push_back(owner_[target]);
+                            current.ghost_remote.push_back(local_[target]);
+                        }
+                        targetLocal = ghostLocal[target];
+                    }
+
+                    targets.push_back(targetLocal);
+                    weights.push_back(global_.Weight(arc));
+                    capacities.push_back(global_.Capacity(arc));
+                }
+
+                if (isBoundary)
+                {
+                    current.boundary.push_back(local);
+                }
+                offsets.push_back(static_cast<int>(targets.size()));
+            }
+
+            // ghosts have no outgoing arcs
+            for (std::size_t ghost = 0; ghost < current.ghost_owner.size(); ++ghost)
+            {
+                offsets.push_back(static_cast<int>(targets.size()));
+            }
+
+            // reset ghost table for next part
+            for (std::size_t i = current.owned; i < current.global.size(); ++i)
+            {
+                ghostLocal[current.global[i]] = -1;
+            }
+
+            current.list = list_type(std::move(vertices), std::move(offsets),
+                                     std::move(targets), std::move(weights),
+                                     std::move(capacities));
+        }
+
+        int largest = 0;
+        for (auto partSize : statistics_.sizes)
+        {
+            largest = std::max(largest, partSize);
+        }
+        statistics_.balance = (size == 0) ? 1.0 :
+            static_cast<double>(largest) * parts / static_cast<double>(size);
+    }
+
+} // namespace algorithm
+
+
+
+#endif // GRAPH_LIB_ALGORITHM_PARTITION_PARTITIONER_HPP
+//==============================================================================
+// End of partitioner.hpp
+// (note: the newline at the end of the file is intentional)
+//==============================================================================
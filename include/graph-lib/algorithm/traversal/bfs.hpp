@@ -6,12 +6,46 @@
 ///
 /// Breadth First Search is one of the most basic and core graph traversal
 /// algorithms encapsulated inside an object. Algorithm class is parametrized by
-/// graph's vertex id type. Single algorithm object works with single graph object.
-/// Contains queue implementation and flow variation, the latter being used in
-/// Edmonds-Karp flow algorithm to produce traversal tree depending on flow.
-/// Both BFS produce a parent structure, which is a dictionary containing
-/// child-parent pairs, where child - graph's vertex, parent - it's predecessor
-/// in a traversal order.
+/// graph's vertex id type and graph type: graph::Graph or any view exposing the
+/// same cbegin()/cend()/GetNeighbours() read interface (see view namespace).
+/// Single algorithm object works with single graph object, whose structure
+/// must not change during object lifetime: a CompressedList snapshot of the
+/// graph is taken at construction and searches run over snapshot handles.
+/// Views are walked in place instead: the snapshot holds their vertices only,
+/// queue searches follow GetNeighbours() and look targets up in the handle
+/// index, so no arc is copied. Modes needing arc indices - direction
+/// optimizing, bidirectional, filters judging snapshot arcs only - take the
+/// view's arcs once, on first use.
+/// Queue implementation is parametrized by compile time policies (see
+/// traversal-policy.hpp): edge filter, visitor and terminator. Residual
+/// capacity filter produces traversal tree depending on flow, which is read
+/// from the graph edges themselves.
+/// Direction optimizing variation (traits::bfs_mode::direction_optimizing) runs with
+/// bitmap frontiers, expanding small frontiers top-down and switching to
+/// bottom-up scans - every unvisited vertex looks for a parent among its
+/// in-neighbours - when frontier grows large, which saves most edge
+/// inspections on low diameter graphs.
+/// Targeted searches answer s-t reachability: search() stops as soon as the
+/// target is labeled, search_bidirectional() grows a forward tree from the
+/// source and a backward tree over incoming arcs from the target, always
+/// expanding the smaller frontier by a level, and stitches the shortest path
+/// through the best meeting arc into the parent array.
+/// All BFS produce dense arrays indexed by snapshot handle: parent handle,
+/// distance from root and discovery order. Parent structure, a dictionary
+/// containing child-parent pairs, where child - graph's vertex, parent - it's
+/// predecessor in a traversal order, is derived from them on demand.
+/// range() exposes queue BFS as a lazy input range of (vertex, parent, depth)
+/// steps (see traversal-range.hpp): a vertex is expanded only when iteration
+/// moves past it, so consumers can stop early without paying for the rest.
+/// Queue and top-down expansion run a prefetch pipeline over the vertices
+/// waiting in the queue: arc offsets of the vertex 2 * d positions ahead,
+/// arc targets of the vertex d ahead, and visited marks and parent slots of
+/// targets of the vertex d / 2 ahead are requested before they are needed,
+/// hiding random accesses once graph arrays no longer fit in cache. Distance
+/// d is set by set_prefetch_distance(), 0 disables prefetching.
+/// Object is a reusable workspace: arrays and buffers are allocated once and
+/// discovered vertices are epoch marks, so starting a new run is O(1) and
+/// stale array entries are cleared only when whole arrays are requested.
 ///
 /// The documentation is available on the following website:
 /// <website>
@@ -33,15 +67,25 @@
 // System
 // e.g.: #include <iostream>        // stdout
 #include <map>
-#include <queue>
-#include <string>
-#include <algorithm> 			// std::for_each
+#include <vector>
+#include <algorithm>
+#include <utility> 			// std::move
+#include <stdexcept> 			// std::logic_error
 #include <iostream>
 
 // Project
 // e.g.: #include "IncludeFile.h"   // MyType_t
 #include "graph-lib/component/vertex.hpp"	// component::Vertex
 #include "graph-lib/utility/print.hpp" 		// Debug printing
+#include "graph-lib/utility/memory.hpp" 	// utility::memory_usage
+#include "graph-lib/utility/bitmap.hpp" 	// utility::bitmap
+#include "graph-lib/utility/epoch.hpp" 		// utility::epoch_marks
+#include "graph-lib/utility/prefetch.hpp" 	// utility::prefetch
+#include "graph-lib/implementation/compressed-list.hpp"			// implementation::CompressedList
+#include "graph-lib/view/view-support.hpp"						// view::support::is_view
+#include "graph-lib/algorithm/traversal/parent-structure.hpp"	// algorithm::parent_structure
+#include "graph-lib/algorithm/traversal/traversal-policy.hpp"	// algorithm::policy
+#include "graph-lib/algorithm/traversal/traversal-range.hpp"	// algorithm::traversal_range
 
 
 //------------------------------------------------------------------------------
@@ -83,19 +127,37 @@ namespace graph
 //------------------------------------------------------------------------------
 namespace algorithm
 {
+	//------------------------------------------------------------------------------
+	/// @brief Algorithm traits.
+	//------------------------------------------------------------------------------
+	namespace traits
+	{
+		//------------------------------------------------------------------------------
+		/// @brief Encapsulates BFS strategies.
+		//------------------------------------------------------------------------------
+		enum class bfs_mode
+		{
+			/// @brief Queue expansion.
+			queue,
+			/// @brief Top-down/bottom-up switching over bitmap frontiers.
+			direction_optimizing
+		};
+
+	} // namespace traits
+
 	//------------------------------------------------------------------------------
 	/// @brief BFS implementation.
 	///
 	//------------------------------------------------------------------------------
-	template<class id_type>
+	template<class id_type,
+	         class graph_type = graph::Graph<id_type>>
 	class bfs
 	{
 		using vertex_type           = component::Vertex<id_type>;
         using edge_type             = component::Edge<id_type>;
-        using parent_structure      = std::map<vertex_type,
-        									   vertex_type,
-        									   component::support::vertex_less<id_type>>;
-        using graph_type 			= graph::Graph<id_type>;
+        using parent_structure      = algorithm::parent_structure<id_type>;
+        using list_type 			= implementation::CompressedList<id_type>;
+        using graph_edge_type 		= view::support::edge_of<graph_type>;
 
 	public:
 
@@ -103,32 +165,221 @@ namespace algorithm
 		///
 		/// @brief Value constructor.
 		///
+		/// Snapshot of the graph is taken here, O(V + E) time and memory. Of a
+		/// view only vertices are taken, O(V); its arcs are walked in place.
+		///
 		/// @param[in] pGraph Input graph pointer.
 		///
 		//------------------------------------------------------------------------------
 		bfs(const graph_type* pGraph);
 
+		//------------------------------------------------------------------------------
+		///
+		/// @brief Snapshot constructor.
+		///
+		/// Results refer to snapshot handles (see reordering.hpp).
+		/// Filters reading graph edges need the graph constructor.
+		///
+		/// @param[in] snapshot Graph snapshot, get_graph() returns nullptr.
+		///
+		//------------------------------------------------------------------------------
+		explicit bfs(list_type snapshot);
+
 		//------------------------------------------------------------------------------
 		///
 		/// @brief Execute BFS algorithm.
 		///
 		/// @param[in] root Starting vertex.
 		///
+		/// @param[in] mode Strategy.
+		///
+		//------------------------------------------------------------------------------
+		void
+		run(const vertex_type& root,
+			traits::bfs_mode mode = traits::bfs_mode::queue);
+
+		//------------------------------------------------------------------------------
+		///
+		/// @brief Execute queue BFS algorithm with policies.
+		///
+		/// @param[in] root Starting vertex.
+		///
+		/// @param[in] filter Edge filter.
+		///
+		/// @param[in] visitor Visitor, taken by reference when lvalue.
+		///
+		/// @param[in] terminator Early termination predicate.
+		///
 		//------------------------------------------------------------------------------
+		template<class filter_type,
+				 class visitor_type = policy::null_visitor,
+				 class terminator_type = policy::never_stop>
 		void
 		run(const vertex_type& root,
-			std::string mode = "");
+			const filter_type& filter,
+			visitor_type&& visitor = visitor_type(),
+			const terminator_type& terminator = terminator_type());
+
+		//------------------------------------------------------------------------------
+		///
+		/// @brief Search path to target, stop once it is labeled.
+		///
+		/// Vertices not explored before target was found stay undiscovered.
+		///
+		/// @param[in] source Starting vertex.
+		///
+		/// @param[in] target Vertex to reach.
+		///
+		/// @param[in] filter Edge filter.
+		///
+		/// @retval True If target was reached.
+		/// @retval False otherwise.
+		///
+		//------------------------------------------------------------------------------
+		template<class filter_type = policy::all_arcs>
+		bool
+		search(const vertex_type& source,
+			   const vertex_type& target,
+			   const filter_type& filter = filter_type());
+
+		//------------------------------------------------------------------------------
+		///
+		/// @brief Search shortest path to target from both ends.
+		///
+		/// Only path vertices and forward tree are left in parent array.
+		///
+		/// @param[in] source Starting vertex.
+		///
+		/// @param[in] target Vertex to reach.
+		///
+		/// @param[in] filter Edge filter, must not read graph edges.
+		///
+		/// @retval True If target was reached.
+		/// @retval False otherwise.
+		///
+		//------------------------------------------------------------------------------
+		template<class filter_type = policy::all_arcs>
+		bool
+		search_bidirectional(const vertex_type& source,
+							 const vertex_type& target,
+							 const filter_type& filter = filter_type());
+
+		//------------------------------------------------------------------------------
+		///
+		/// @brief Lazy queue BFS in discovery order.
+		///
+		/// Results of the previous run are dropped; arrays reflect vertices
+		/// discovered so far. Any other run invalidates the range.
+		///
+		/// @param[in] root Starting vertex.
+		///
+		/// @param[in] filter Edge filter.
+		///
+		/// @return Input range of traversal steps.
+		///
+		//------------------------------------------------------------------------------
+		template<class filter_type = policy::all_arcs>
+		traversal_range<bfs, filter_type>
+		range(const vertex_type& root,
+			  const filter_type& filter = filter_type());
+
+		//------------------------------------------------------------------------------
+		///
+		/// @brief Set prefetch lookahead.
+		///
+		/// @param[in] distance Queue positions ahead, 0 disables prefetching.
+		///
+		//------------------------------------------------------------------------------
+		void
+		set_prefetch_distance(int distance);
 
 		//------------------------------------------------------------------------------
 		///
 		/// @brief Get algorithm execution results.
 		///
+		/// Built from dense parent array on first call after a run.
+		///
 		/// @return Reference to parent structure defining order.
 		///
 		//------------------------------------------------------------------------------
 		const parent_structure&
 		get() const;
 
+		//------------------------------------------------------------------------------
+		///
+		/// @brief Get dense parent array.
+		///
+		/// First call after a run clears stale entries, O(V).
+		///
+		/// @return Parent handle per snapshot handle, -1 if not discovered,
+		///         root is its own parent.
+		///
+		//------------------------------------------------------------------------------
+		const std::vector<int>&
+		get_parents() const;
+
+		//------------------------------------------------------------------------------
+		///
+		/// @brief Get parent of one vertex, O(1).
+		///
+		/// @param[in] handle Snapshot handle.
+		///
+		/// @return Parent handle, -1 if not discovered.
+		///
+		//------------------------------------------------------------------------------
+		int
+		get_parent(int handle) const;
+
+		//------------------------------------------------------------------------------
+		///
+		/// @brief Get distance of one vertex, O(1).
+		///
+		/// @param[in] handle Snapshot handle.
+		///
+		/// @return Number of edges from root, -1 if not discovered.
+		///
+		//------------------------------------------------------------------------------
+		int
+		get_distance(int handle) const;
+
+		//------------------------------------------------------------------------------
+		///
+		/// @brief Get dense distance array.
+		///
+		/// First call after a run clears stale entries, O(V).
+		///
+		/// @return Number of edges from root per snapshot handle, -1 if not
+		///         discovered.
+		///
+		//------------------------------------------------------------------------------
+		const std::vector<int>&
+		get_distances() const;
+
+		//------------------------------------------------------------------------------
+		///
+		/// @brief Get dense discovery order array.
+		///
+		/// First call after a run clears stale entries, O(V).
+		///
+		/// @return Discovery index per snapshot handle, -1 if not discovered.
+		///
+		//------------------------------------------------------------------------------
+		const std::vector<int>&
+		get_order() const;
+
+		//------------------------------------------------------------------------------
+		///
+		/// @brief Get snapshot defining handles.
+		///
+		/// Search walking a view in place holds its vertices only, until a
+		/// mode needing arcs takes them.
+		///
+		/// @return Graph snapshot.
+		///
+		//------------------------------------------------------------------------------
+		const list_type&
+		get_snapshot() const;
+
 		//------------------------------------------------------------------------------
 		///
 		/// @brief Get algorithm's graph.
@@ -139,67 +390,265 @@ namespace algorithm
 		const graph_type*
 		get_graph() const;
 
+		//------------------------------------------------------------------------------
+		///
+		/// @brief Heap memory used by algorithm state.
+		///
+		/// @return Memory usage report, snapshot and results are auxiliary.
+		///
+		//------------------------------------------------------------------------------
+		utility::memory_usage
+		MemoryUsage() const;
 
 	private:
 
+		template<class, class>
+		friend class traversal_range;
+
 		//------------------------------------------------------------------------------
 		///
 		/// @brief Check if vertex can be used by BFS algorithm.
 		///
-		/// @param[in] vertex Input vertex.
+		/// @param[in] handle Input vertex handle.
 		///
 		/// @retval True If vertex is available.
 		/// @retval False otherwise.
 		///
 		//------------------------------------------------------------------------------
 		bool
-		is_available(const vertex_type& vertex);
+		is_available(int handle) const;
+
+		//------------------------------------------------------------------------------
+		///
+		/// @brief Start new run, O(1).
+		///
+		//------------------------------------------------------------------------------
+		void
+		flush_structure();
 
 		//------------------------------------------------------------------------------
 		///
-		/// @brief Check if edge can be used by BFS_flow algorithm.
+		/// @brief Clear stale entries of result arrays.
 		///
-		/// @param[in] edge Input edge.
+		//------------------------------------------------------------------------------
+		void
+		sanitize() const;
+
+		//------------------------------------------------------------------------------
+		///
+		/// @brief Label vertex as discovered.
+		///
+		/// @param[in] handle Discovered vertex handle.
+		///
+		/// @param[in] parent Parent handle.
+		///
+		/// @param[in] distance Distance from root.
+		///
+		//------------------------------------------------------------------------------
+		void
+		discover(int handle,
+				 int parent,
+				 int distance);
+
+		//------------------------------------------------------------------------------
+		///
+		/// @brief Queue BFS implementation.
+		///
+		/// @param[in] root Starting vertex handle.
+		///
+		/// @param[in] filter Edge filter.
+		///
+		/// @param[in] visitor Visitor.
+		///
+		/// @param[in] terminator Early termination predicate.
+		///
+		//------------------------------------------------------------------------------
+		template<class filter_type,
+				 class visitor_type,
+				 class terminator_type>
+		void
+		bfs_queue(int root,
+				  const filter_type& filter,
+				  visitor_type& visitor,
+				  const terminator_type& terminator);
+
+		//------------------------------------------------------------------------------
+		///
+		/// @brief Prefetch for vertices waiting after frontier[index].
+		///
+		/// @param[in] frontier Vertices in expansion order.
+		///
+		/// @param[in] index Position of vertex about to be expanded.
+		///
+		//------------------------------------------------------------------------------
+		void
+		prefetch_ahead(const std::vector<int>& frontier,
+					   std::size_t index) const;
+
+		//------------------------------------------------------------------------------
 		///
-		/// @retval True If it can.
+		/// @brief Discover children of one vertex.
+		///
+		/// @param[in] current Expanded vertex handle.
+		///
+		/// @param[in] filter Edge filter.
+		///
+		/// @param[in] visitor Visitor.
+		///
+		/// @param[in] terminator Early termination predicate.
+		///
+		/// @retval True If terminator stopped the search.
 		/// @retval False otherwise.
 		///
 		//------------------------------------------------------------------------------
+		template<class filter_type,
+				 class visitor_type,
+				 class terminator_type>
 		bool
-		is_flow_available(const edge_type& edge);
+		bfs_expand(int current,
+				   const filter_type& filter,
+				   visitor_type& visitor,
+				   const terminator_type& terminator);
 
 		//------------------------------------------------------------------------------
 		///
-		/// @brief Reset parent structure.
+		/// @brief Start lazy run at root.
+		///
+		/// @param[in] root Starting vertex handle.
 		///
 		//------------------------------------------------------------------------------
 		void
-		flush_structure();
+		step_start(int root);
 
 		//------------------------------------------------------------------------------
 		///
-		/// @brief Queue BFS implementation.
+		/// @brief Expand current vertex of lazy run, move to next one.
 		///
-		/// @param[in] root Starting vertex.
+		/// @param[in] filter Edge filter.
+		///
+		/// @retval True If there is a next vertex.
+		/// @retval False otherwise.
+		///
+		//------------------------------------------------------------------------------
+		template<class filter_type>
+		bool
+		step_next(const filter_type& filter);
+
+		//------------------------------------------------------------------------------
+		///
+		/// @brief Current vertex of lazy run.
+		///
+		/// @return Traversal step.
+		///
+		//------------------------------------------------------------------------------
+		traversal_step
+		step_current() const;
+
+		//------------------------------------------------------------------------------
+		///
+		/// @brief Direction optimizing BFS implementation.
+		///
+		/// @param[in] root Starting vertex handle.
 		///
 		//------------------------------------------------------------------------------
 		void
-		bfs_queue(const vertex_type& root);
+		bfs_direction_optimizing(int root);
 
 		//------------------------------------------------------------------------------
 		///
-		/// @brief Queue BFS implementation for network flow.
+		/// @brief Build incoming arcs on first use.
 		///
-		/// @param[in] root Starting vertex.
+		//------------------------------------------------------------------------------
+		void
+		build_incoming();
+
+		//------------------------------------------------------------------------------
+		///
+		/// @brief Replace vertex snapshot of a view with a full one, once.
 		///
 		//------------------------------------------------------------------------------
 		void
-		bfs_queue_flow(const vertex_type& root);
+		take_arcs();
 
 	private:
 
-		/// @brief Parent structure.
-		parent_structure structure_;
+		/// @brief Switch to bottom-up when frontier arcs exceed unexplored arcs / alpha.
+		static constexpr long long alpha_ = 14;
+
+		/// @brief Switch back to top-down when frontier is smaller than V / beta.
+		static constexpr long long beta_ = 24;
+
+		/// @brief Default prefetch lookahead.
+		static constexpr int prefetch_ = 8;
+
+		/// @brief Prefetch lookahead, 0 if disabled.
+		int prefetchDistance_;
+
+		/// @brief Graph snapshot.
+		list_type snapshot_;
+
+		/// @brief Incoming arc offsets of snapshot vertices.
+		std::vector<int> inOffsets_;
+
+		/// @brief Incoming arc sources.
+		std::vector<int> inSources_;
+
+		/// @brief Incoming arc indices in snapshot.
+		std::vector<int> inArcs_;
+
+		/// @brief Vertices discovered in current run.
+		utility::epoch_marks visited_;
+
+		/// @brief Parent handles, valid for visited vertices.
+		mutable std::vector<int> parents_;
+
+		/// @brief Distances from root, valid for visited vertices.
+		mutable std::vector<int> distances_;
+
+		/// @brief Discovery indices, valid for visited vertices.
+		mutable std::vector<int> order_;
+
+		/// @brief Arrays hold -1 for vertices not visited.
+		mutable bool arraysValid_;
+
+		/// @brief Discovered vertices in discovery order, doubles as queue.
+		std::vector<int> queue_;
+
+		/// @brief Queue index of current vertex of lazy run.
+		std::size_t cursor_;
+
+		/// @brief Vertices of backward tree.
+		utility::epoch_marks backVisited_;
+
+		/// @brief Next handle towards target in backward tree.
+		std::vector<int> successors_;
+
+		/// @brief Distances to target in backward tree.
+		std::vector<int> backDistances_;
+
+		/// @brief Top-down frontier buffers.
+		std::vector<int> frontier_;
+
+		/// @brief Next top-down frontier.
+		std::vector<int> nextFrontier_;
+
+		/// @brief Bottom-up frontier.
+		utility::bitmap frontierBits_;
+
+		/// @brief Next bottom-up frontier.
+		utility::bitmap nextBits_;
+
+		/// @brief Backward tree vertices in discovery order.
+		std::vector<int> backQueue_;
+
+		/// @brief Parent structure, derived on demand.
+		mutable parent_structure structure_;
+
+		/// @brief Parent structure matches dense arrays.
+		mutable bool structureValid_;
+
+		/// @brief Search walks the view itself, snapshot holds vertices only.
+		bool inPlace_;
 
 		/// @brief Graph.
 		const graph_type* pGraph_;
@@ -230,35 +679,281 @@ namespace algorithm
 //------------------------------------------------------------------------------
 namespace algorithm
 {
+	//------------------------------------------------------------------------------
+	//
+	//  Views keep their arcs, only vertices are taken.
+	//
+	//------------------------------------------------------------------------------
+	template<class id_type, class graph_type>
+	bfs<id_type, graph_type>::bfs(const graph_type* pGraph) :
+			bfs(view::support::is_view<graph_type>::value ? list_type::VerticesOf(*pGraph) :
+															list_type(*pGraph))
+	{
+		pGraph_ = pGraph;
+		inPlace_ = view::support::is_view<graph_type>::value;
+	}
+
 	//------------------------------------------------------------------------------
 	//
 	//  <Design related information>
 	//
 	//------------------------------------------------------------------------------
-	template<class id_type>
-	bfs<id_type>::bfs(const typename bfs<id_type>::graph_type* pGraph) : pGraph_(pGraph)
+	template<class id_type, class graph_type>
+	bfs<id_type, graph_type>::bfs(
+			typename bfs<id_type, graph_type>::list_type snapshot) : prefetchDistance_(prefetch_),
+																	 snapshot_(std::move(snapshot)),
+																	 arraysValid_(false),
+																	 cursor_(0),
+																	 structureValid_(false),
+																	 inPlace_(false),
+																	 pGraph_(nullptr)
 	{
+		visited_.resize(snapshot_.Size());
+		parents_.resize(snapshot_.Size());
+		distances_.resize(snapshot_.Size());
+		order_.resize(snapshot_.Size());
+		queue_.reserve(snapshot_.Size());
+
 		flush_structure();
 	}
 
 	//------------------------------------------------------------------------------
 	//
-	//  <Design related information>
+	//  Results of the previous run are dropped.
 	//
 	//------------------------------------------------------------------------------
-	template<class id_type>
+	template<class id_type, class graph_type>
 	void
-	bfs<id_type>::run(const typename bfs<id_type>::vertex_type& root,
-					  std::string mode)
+	bfs<id_type, graph_type>::run(const typename bfs<id_type, graph_type>::vertex_type& root,
+								  traits::bfs_mode mode)
 	{
-		if (mode == "flow")
+		if (mode == traits::bfs_mode::direction_optimizing)
 		{
-			bfs_queue_flow(root);
+			int rootHandle = snapshot_.GetHandle(root);
+
+			take_arcs();
+			flush_structure();
+			bfs_direction_optimizing(rootHandle);
 		}
 		else
 		{
-			bfs_queue(root);
+			run(root, policy::all_arcs());
+		}
+	}
+
+	//------------------------------------------------------------------------------
+	//
+	//  Results of the previous run are dropped.
+	//
+	//------------------------------------------------------------------------------
+	template<class id_type, class graph_type>
+	template<class filter_type,
+			 class visitor_type,
+			 class terminator_type>
+	void
+	bfs<id_type, graph_type>::run(const typename bfs<id_type, graph_type>::vertex_type& root,
+								  const filter_type& filter,
+								  visitor_type&& visitor,
+								  const terminator_type& terminator)
+	{
+		int rootHandle = snapshot_.GetHandle(root);
+
+		if constexpr (!policy::judges_edges<filter_type, graph_edge_type>)
+		{
+			take_arcs();
+		}
+		flush_structure();
+		bfs_queue(rootHandle, filter, visitor, terminator);
+	}
+
+	//------------------------------------------------------------------------------
+	//
+	//  <Design related information>
+	//
+	//------------------------------------------------------------------------------
+	template<class id_type, class graph_type>
+	template<class filter_type>
+	bool
+	bfs<id_type, graph_type>::search(const typename bfs<id_type, graph_type>::vertex_type& source,
+									 const typename bfs<id_type, graph_type>::vertex_type& target,
+									 const filter_type& filter)
+	{
+		int targetHandle = snapshot_.GetHandle(target);
+
+		run(source, filter, policy::null_visitor(), policy::stop_at{targetHandle});
+
+		return !is_available(targetHandle);
+	}
+
+	//------------------------------------------------------------------------------
+	//
+	//  Forward tree lives in the regular result arrays, backward tree in
+	//  successor arrays; a vertex is never labeled by both. Meeting arcs
+	//  (forward vertex -> backward vertex) are collected over a whole level
+	//  and the shortest one is taken, since the first meeting found within a
+	//  level need not lie on a shortest path. Backward vertices of the chosen
+	//  path are then discovered along successor links.
+	//
+	//------------------------------------------------------------------------------
+	template<class id_type, class graph_type>
+	template<class filter_type>
+	bool
+	bfs<id_type, graph_type>::search_bidirectional(
+			const typename bfs<id_type, graph_type>::vertex_type& source,
+			const typename bfs<id_type, graph_type>::vertex_type& target,
+			const filter_type& filter)
+	{
+		static_assert(!filter_type::reads_edges, "Backward search filters must not read graph edges");
+
+		int sourceHandle = snapshot_.GetHandle(source);
+		int targetHandle = snapshot_.GetHandle(target);
+
+		take_arcs();
+		flush_structure();
+		build_incoming();
+
+		discover(sourceHandle, sourceHandle, 0);
+		if (sourceHandle == targetHandle)
+		{
+			return true;
+		}
+
+		if (backVisited_.size() != snapshot_.Size())
+		{
+			backVisited_.resize(snapshot_.Size());
+			successors_.resize(snapshot_.Size());
+			backDistances_.resize(snapshot_.Size());
+		}
+		backVisited_.reset();
+		backQueue_.assign(1, targetHandle);
+		backVisited_.set(targetHandle);
+		successors_[targetHandle] = targetHandle;
+		backDistances_[targetHandle] = 0;
+
+		std::size_t forwardBegin = 0;
+		std::size_t backwardBegin = 0;
+		int meetFrom = -1;
+		int meetTo = -1;
+		int meetLength = 0;
+
+		// keep shortest meeting arc
+		auto meet = [&](int from, int to)
+		{
+			int length = distances_[from] + 1 + backDistances_[to];
+			if (meetFrom == -1 || length < meetLength)
+			{
+				meetFrom = from;
+				meetTo = to;
+				meetLength = length;
+			}
+		};
+
+		while (forwardBegin < queue_.size() && backwardBegin < backQueue_.size())
+		{
+			if (queue_.size() - forwardBegin <= backQueue_.size() - backwardBegin)
+			{
+				// forward level over outgoing arcs
+				std::size_t end = queue_.size();
+				for (std::size_t index = forwardBegin; index < end; ++index)
+				{
+					int current = queue_[index];
+					for (int arc = snapshot_.Begin(current); arc < snapshot_.End(current); ++arc)
+					{
+						if (!filter(snapshot_, arc))
+						{
+							continue;
+						}
+
+						int next = snapshot_.Target(arc);
+						if (backVisited_.test(next))
+						{
+							meet(current, next);
+						}
+						else if (is_available(next))
+						{
+							discover(next, current, distances_[current] + 1);
+						}
+					}
+				}
+				forwardBegin = end;
+			}
+			else
+			{
+				// backward level over incoming arcs
+				std::size_t end = backQueue_.size();
+				for (std::size_t index = backwardBegin; index < end; ++index)
+				{
+					int current = backQueue_[index];
+					for (int slot = inOffsets_[current]; slot < inOffsets_[current + 1]; ++slot)
+					{
+						if (!filter(snapshot_, inArcs_[slot]))
+						{
+							continue;
+						}
+
+						int previous = inSources_[slot];
+						if (!is_available(previous))
+						{
+							meet(previous, current);
+						}
+						else if (!backVisited_.test(previous))
+						{
+							backVisited_.set(previous);
+							successors_[previous] = current;
+							backDistances_[previous] = backDistances_[current] + 1;
+							backQueue_.push_back(previous);
+						}
+					}
+				}
+				backwardBegin = end;
+			}
+
+			if (meetFrom != -1)
+			{
+				// stitch backward part of the path
+				discover(meetTo, meetFrom, distances_[meetFrom] + 1);
+				for (int current = meetTo; current != targetHandle; current = successors_[current])
+				{
+					discover(successors_[current], current, distances_[current] + 1);
+				}
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	//------------------------------------------------------------------------------
+	//
+	//  <Design related information>
+	//
+	//------------------------------------------------------------------------------
+	template<class id_type, class graph_type>
+	template<class filter_type>
+	traversal_range<bfs<id_type, graph_type>, filter_type>
+	bfs<id_type, graph_type>::range(const typename bfs<id_type, graph_type>::vertex_type& root,
+									const filter_type& filter)
+	{
+		int rootHandle = snapshot_.GetHandle(root);
+
+		if constexpr (!policy::judges_edges<filter_type, graph_edge_type>)
+		{
+			take_arcs();
 		}
+
+		return traversal_range<bfs, filter_type>(this, rootHandle, filter);
+	}
+
+	//------------------------------------------------------------------------------
+	//
+	//  <Design related information>
+	//
+	//------------------------------------------------------------------------------
+	template<class id_type, class graph_type>
+	void
+	bfs<id_type, graph_type>::set_prefetch_distance(int distance)
+	{
+		prefetchDistance_ = distance;
 	}
 
 	//------------------------------------------------------------------------------
@@ -266,10 +961,16 @@ namespace algorithm
 	//  <Design related information>
 	//
 	//------------------------------------------------------------------------------
-	template<class id_type>
-	const typename bfs<id_type>::parent_structure&
-	bfs<id_type>::get() const
+	template<class id_type, class graph_type>
+	const typename bfs<id_type, graph_type>::parent_structure&
+	bfs<id_type, graph_type>::get() const
 	{
+		if (!structureValid_)
+		{
+			to_parent_structure(snapshot_, get_parents(), structure_);
+			structureValid_ = true;
+		}
+
 		return structure_;
 	}
 
@@ -278,9 +979,84 @@ namespace algorithm
 	//  <Design related information>
 	//
 	//------------------------------------------------------------------------------
-	template<class id_type>
-	const typename bfs<id_type>::graph_type*
-	bfs<id_type>::get_graph() const
+	template<class id_type, class graph_type>
+	const std::vector<int>&
+	bfs<id_type, graph_type>::get_parents() const
+	{
+		sanitize();
+		return parents_;
+	}
+
+	//------------------------------------------------------------------------------
+	//
+	//  <Design related information>
+	//
+	//------------------------------------------------------------------------------
+	template<class id_type, class graph_type>
+	int
+	bfs<id_type, graph_type>::get_parent(int handle) const
+	{
+		return visited_.test(handle) ? parents_[handle] : -1;
+	}
+
+	//------------------------------------------------------------------------------
+	//
+	//  <Design related information>
+	//
+	//------------------------------------------------------------------------------
+	template<class id_type, class graph_type>
+	int
+	bfs<id_type, graph_type>::get_distance(int handle) const
+	{
+		return visited_.test(handle) ? distances_[handle] : -1;
+	}
+
+	//------------------------------------------------------------------------------
+	//
+	//  <Design related information>
+	//
+	//------------------------------------------------------------------------------
+	template<class id_type, class graph_type>
+	const std::vector<int>&
+	bfs<id_type, graph_type>::get_distances() const
+	{
+		sanitize();
+		return distances_;
+	}
+
+	//------------------------------------------------------------------------------
+	//
+	//  <Design related information>
+	//
+	//------------------------------------------------------------------------------
+	template<class id_type, class graph_type>
+	const std::vector<int>&
+	bfs<id_type, graph_type>::get_order() const
+	{
+		sanitize();
+		return order_;
+	}
+
+	//------------------------------------------------------------------------------
+	//
+	//  <Design related information>
+	//
+	//------------------------------------------------------------------------------
+	template<class id_type, class graph_type>
+	const typename bfs<id_type, graph_type>::list_type&
+	bfs<id_type, graph_type>::get_snapshot() const
+	{
+		return snapshot_;
+	}
+
+	//------------------------------------------------------------------------------
+	//
+	//  <Design related information>
+	//
+	//------------------------------------------------------------------------------
+	template<class id_type, class graph_type>
+	const graph_type*
+	bfs<id_type, graph_type>::get_graph() const
 	{
 		return pGraph_;
 	}
@@ -290,13 +1066,31 @@ namespace algorithm
 	//  <Design related information>
 	//
 	//------------------------------------------------------------------------------
-	template<class id_type>
-	bool
-	bfs<id_type>::is_available(const typename bfs<id_type>::vertex_type& vertex)
+	template<class id_type, class graph_type>
+	utility::memory_usage
+	bfs<id_type, graph_type>::MemoryUsage() const
 	{
-		// Not Discovered: parent structure contains invalid entry for the second endpoint
-		return (structure_.at(vertex) == 
-				component::Vertex<id_type>::invalidInstance_);
+		utility::memory_usage usage;
+		usage.auxiliary = structure_.get_allocator().allocated() +
+						  snapshot_.MemoryUsage().total() +
+						  utility::vector_bytes(inOffsets_) +
+						  utility::vector_bytes(inSources_) +
+						  utility::vector_bytes(inArcs_) +
+						  visited_.memory() +
+						  backVisited_.memory() +
+						  utility::vector_bytes(frontier_) +
+						  utility::vector_bytes(nextFrontier_) +
+						  frontierBits_.memory() +
+						  nextBits_.memory() +
+						  utility::vector_bytes(parents_) +
+						  utility::vector_bytes(distances_) +
+						  utility::vector_bytes(order_) +
+						  utility::vector_bytes(queue_) +
+						  utility::vector_bytes(successors_) +
+						  utility::vector_bytes(backDistances_) +
+						  utility::vector_bytes(backQueue_);
+
+		return usage;
 	}
 
 	//------------------------------------------------------------------------------
@@ -304,12 +1098,27 @@ namespace algorithm
 	//  <Design related information>
 	//
 	//------------------------------------------------------------------------------
-	template<class id_type>
+	template<class id_type, class graph_type>
 	bool
-	bfs<id_type>::is_flow_available(const typename bfs<id_type>::edge_type& edge)
+	bfs<id_type, graph_type>::is_available(int handle) const
+	{
+		// Not Discovered: not marked in current run
+		return !visited_.test(handle);
+	}
+
+	//------------------------------------------------------------------------------
+	//
+	//  Epoch increment, arrays keep stale entries until sanitized.
+	//
+	//------------------------------------------------------------------------------
+	template<class id_type, class graph_type>
+	void
+	bfs<id_type, graph_type>::flush_structure()
 	{
-		// Discovered: is_available(second_vert) returns true and capacity can accomodate more flow
-		return (is_available(edge.GetVertex(1)) && (edge.GetCapacity() > edge.GetFlow()) );
+		visited_.reset();
+		queue_.clear();
+		arraysValid_ = false;
+		structureValid_ = false;
 	}
 
 	//------------------------------------------------------------------------------
@@ -317,18 +1126,25 @@ namespace algorithm
 	//  <Design related information>
 	//
 	//------------------------------------------------------------------------------
-	template<class id_type>
+	template<class id_type, class graph_type>
 	void
-	bfs<id_type>::flush_structure()
+	bfs<id_type, graph_type>::sanitize() const
 	{
-		// initialize parent structure: insert <vertex, invalid_vertex> entries,
-		// where vertex - vertex of the graph
-		std::for_each(pGraph_->cbegin(), pGraph_->cend(),
-			[this](const auto& tuple)
+		if (arraysValid_)
+		{
+			return;
+		}
+
+		for (int current = 0; current < snapshot_.Size(); ++current)
+		{
+			if (!visited_.test(current))
 			{
-				structure_[tuple.first] = 
-					component::Vertex<id_type>::invalidInstance_;
-			});
+				parents_[current] = -1;
+				distances_[current] = -1;
+				order_[current] = -1;
+			}
+		}
+		arraysValid_ = true;
 	}
 
 	//------------------------------------------------------------------------------
@@ -336,119 +1152,393 @@ namespace algorithm
 	//  <Design related information>
 	//
 	//------------------------------------------------------------------------------
-	template<class id_type>
+	template<class id_type, class graph_type>
+	void
+	bfs<id_type, graph_type>::discover(int handle,
+									   int parent,
+									   int distance)
+	{
+		visited_.set(handle);
+		parents_[handle] = parent;
+		distances_[handle] = distance;
+		order_[handle] = static_cast<int>(queue_.size());
+		queue_.push_back(handle);
+	}
+
+	//------------------------------------------------------------------------------
+	//
+	//  Vertices are labeled when pushed, so every vertex enters the queue once.
+	//
+	//------------------------------------------------------------------------------
+	template<class id_type, class graph_type>
+	template<class filter_type,
+			 class visitor_type,
+			 class terminator_type>
+	void
+	bfs<id_type, graph_type>::bfs_queue(int root,
+										const filter_type& filter,
+										visitor_type& visitor,
+										const terminator_type& terminator)
+	{
+		discover(root, root, 0);
+		visitor.discover(root);
+		if (terminator(root))
+		{
+			return;
+		}
+
+		for (std::size_t head = 0; head < queue_.size(); ++head)
+		{
+			prefetch_ahead(queue_, head);
+			if (bfs_expand(queue_[head], filter, visitor, terminator))
+			{
+				return;
+			}
+		}
+	}
+
+	//------------------------------------------------------------------------------
+	//
+	//  Three stages, each one reading only what an earlier stage requested:
+	//  offsets 2d ahead, then targets d ahead (their offsets arrived by now),
+	//  then marks and parent slots of targets d/2 ahead (their targets
+	//  arrived by now). Queue tail is still growing, so stages just skip
+	//  missing positions.
+	//
+	//------------------------------------------------------------------------------
+	template<class id_type, class graph_type>
 	void
-	bfs<id_type>::bfs_queue(
-			const typename bfs<id_type>::vertex_type& root)
+	bfs<id_type, graph_type>::prefetch_ahead(const std::vector<int>& frontier,
+											 std::size_t index) const
 	{
-		// initialize connection queue
-		std::queue<std::pair<typename bfs<id_type>::vertex_type, 
-							 typename bfs<id_type>::vertex_type>> queue;
-		// artificial algorithm initializer edge
-		auto rootConnection = std::make_pair(root,root);
-		queue.push(rootConnection);
+		if (prefetchDistance_ <= 0 || inPlace_)
+		{
+			return;
+		}
 
-		while (!queue.empty())
+		const std::size_t distance = static_cast<std::size_t>(prefetchDistance_);
+		const std::size_t half = (distance + 1) / 2;
+		if (index + 2 * distance < frontier.size())
+		{
+			snapshot_.PrefetchHeader(frontier[index + 2 * distance]);
+		}
+		if (index + distance < frontier.size())
+		{
+			snapshot_.PrefetchArcs(frontier[index + distance]);
+		}
+		if (index + half < frontier.size())
 		{
-			// pop current top vertex
-			auto neighbourConnection = queue.front();
-			queue.pop();
-
-			//DEBUG
-			std::cout << "	BFS-queue: Current connection: < ";
-			print_vertex<id_type>(neighbourConnection.first);
-			std::cout << ", ";
-			print_vertex<id_type>(neighbourConnection.second);
-			std::cout <<  " >\n"; 
-			//DEBUG
-
-			// if not discovered
-			if (is_available(neighbourConnection.second))
+			int ahead = frontier[index + half];
+			for (int arc = snapshot_.Begin(ahead); arc < snapshot_.End(ahead); ++arc)
 			{
-				//DEBUG
-				std::cout << "		Label current connection as discovered\n";
-				//DEBUG
+				int target = snapshot_.Target(arc);
+				visited_.prefetch(target);
+				utility::prefetch(parents_.data() + target);
+			}
+		}
+	}
+
+	//------------------------------------------------------------------------------
+	//
+	//  Search walking a view in place judges view edges and looks their
+	//  targets up in the handle index. Otherwise filters reading graph edges
+	//  walk graph neighbours in lockstep with snapshot arcs, which are listed
+	//  in the same order; other filters never touch the graph. A search built
+	//  from a snapshot has no graph, and its snapshot may be ordered
+	//  differently, so such filters are refused.
+	//
+	//------------------------------------------------------------------------------
+	template<class id_type, class graph_type>
+	template<class filter_type,
+			 class visitor_type,
+			 class terminator_type>
+	bool
+	bfs<id_type, graph_type>::bfs_expand(int current,
+										 const filter_type& filter,
+										 visitor_type& visitor,
+										 const terminator_type& terminator)
+	{
+		// follow arc if target was not discovered
+		auto follow = [&](int arc, int target)
+		{
+			visitor.examine(current, arc, target);
 
-				// label as discovered
-				structure_.at(neighbourConnection.second) = neighbourConnection.first;
+			if (is_available(target))
+			{
+				discover(target, current, distances_[current] + 1);
+				visitor.discover(target);
+				return terminator(target);
+			}
+			return false;
+		};
 
-				// proceed with children
-				for (auto& neighbourEdge : pGraph_->GetNeighbours(neighbourConnection.second))
+		// proceed with children
+		if constexpr (policy::judges_edges<filter_type, graph_edge_type>)
+		{
+			if (inPlace_)
+			{
+				for (const auto& neighbourEdge : pGraph_->GetNeighbours(snapshot_.GetVertex(current)))
 				{
-					//DEBUG
-					std::cout << "		BFS-queue: Add to queue < ";
-					print_vertex<id_type>(neighbourEdge.GetVertex(0));
-					std::cout << ", ";
-					print_vertex<id_type>(neighbourEdge.GetVertex(1));
-					std::cout << " >\n";
-					//DEBUG
+					if (filter(neighbourEdge) &&
+						follow(-1, snapshot_.GetHandle(neighbourEdge.GetVertex(1))))
+					{
+						return true;
+					}
+				}
 
-					auto tmpPair = std::make_pair(neighbourEdge.GetVertex(0), neighbourEdge.GetVertex(1));
+				visitor.finish(current);
+				return false;
+			}
+		}
 
-					queue.push(tmpPair);
-				}
+		if constexpr (filter_type::reads_edges)
+		{
+			if (pGraph_ == nullptr)
+			{
+				throw std::logic_error("Filter reads graph edges, search has no graph");
+			}
 
+			int arc = snapshot_.Begin(current);
+			for (const auto& neighbourEdge : pGraph_->GetNeighbours(snapshot_.GetVertex(current)))
+			{
+				if (filter(neighbourEdge) && follow(arc, snapshot_.Target(arc)))
+				{
+					return true;
+				}
+				++arc;
+			}
+		}
+		else
+		{
+			for (int arc = snapshot_.Begin(current); arc < snapshot_.End(current); ++arc)
+			{
+				if (filter(snapshot_, arc) && follow(arc, snapshot_.Target(arc)))
+				{
+					return true;
+				}
 			}
 		}
+
+		visitor.finish(current);
+		return false;
 	}
 
+	//------------------------------------------------------------------------------
+	//
+	//  <Design related information>
+	//
+	//------------------------------------------------------------------------------
+	template<class id_type, class graph_type>
+	void
+	bfs<id_type, graph_type>::step_start(int root)
+	{
+		flush_structure();
+		discover(root, root, 0);
+		cursor_ = 0;
+	}
+
+	//------------------------------------------------------------------------------
+	//
+	//  Current vertex is expanded only now, when consumer moves past it.
+	//
+	//------------------------------------------------------------------------------
+	template<class id_type, class graph_type>
+	template<class filter_type>
+	bool
+	bfs<id_type, graph_type>::step_next(const filter_type& filter)
+	{
+		policy::null_visitor visitor;
+		bfs_expand(queue_[cursor_], filter, visitor, policy::never_stop());
+
+		return ++cursor_ < queue_.size();
+	}
 
 	//------------------------------------------------------------------------------
 	//
 	//  <Design related information>
 	//
 	//------------------------------------------------------------------------------
-	template<class id_type>
+	template<class id_type, class graph_type>
+	traversal_step
+	bfs<id_type, graph_type>::step_current() const
+	{
+		int handle = queue_[cursor_];
+
+		return traversal_step{handle, parents_[handle], distances_[handle]};
+	}
+
+	//------------------------------------------------------------------------------
+	//
+	//  Frontier is kept as handle queue while expanding top-down and as bitmap
+	//  while expanding bottom-up; it is converted on every switch. Unexplored
+	//  arcs are tracked as sum of in-degrees of unvisited vertices - exactly
+	//  the arcs a bottom-up step may have to inspect.
+	//
+	//------------------------------------------------------------------------------
+	template<class id_type, class graph_type>
 	void
-	bfs<id_type>::bfs_queue_flow(
-			const typename bfs<id_type>::vertex_type& root)
+	bfs<id_type, graph_type>::bfs_direction_optimizing(int root)
 	{
-		// initialize connection queue
-		std::queue<std::pair<typename bfs<id_type>::vertex_type, 
-							 typename bfs<id_type>::vertex_type>> queue;
-		// artificial algorithm initializer edge
-		auto rootConnection = std::make_pair(root,root);
-		queue.push(rootConnection);
+		build_incoming();
+
+		const int size = snapshot_.Size();
+
+		std::vector<int>& frontier = frontier_;
+		std::vector<int>& next = nextFrontier_;
+		if (frontierBits_.size() != size)
+		{
+			frontierBits_ = utility::bitmap(size);
+			nextBits_ = utility::bitmap(size);
+		}
+		utility::bitmap& frontierBits = frontierBits_;
+		utility::bitmap& nextBits = nextBits_;
+		frontier.assign(1, root);
+
+		discover(root, root, 0);
+
+		int level = 0;
+		long long frontierSize = 1;
+		long long frontierArcs = snapshot_.Degree(root);
+		long long unexploredArcs = static_cast<long long>(inSources_.size()) -
+								   (inOffsets_[root + 1] - inOffsets_[root]);
+		bool bottomUp = false;
 
-		while (!queue.empty())
+		while (frontierSize > 0)
 		{
-			// pop current top vertex
-			auto neighbourConnection = queue.front();
-			queue.pop();
-			
-			//DEBUG
-			std::cout << "	BFS-flow: Current connection: < ";
-			print_vertex<id_type>(neighbourConnection.first);
-			std::cout << ", ";
-			print_vertex<id_type>(neighbourConnection.second);
-			std::cout <<  " >\n"; 
-			//DEBUG
-
-			// proceed with children
-			for (auto& neighbourEdge : pGraph_->GetNeighbours(neighbourConnection.second))
+			// pick direction
+			if (!bottomUp && frontierArcs > unexploredArcs / alpha_)
+			{
+				bottomUp = true;
+				frontierBits.clear();
+				for (auto current : frontier)
+				{
+					frontierBits.set(current);
+				}
+			}
+			else if (bottomUp && frontierSize < size / beta_)
 			{
-				// if neighbour vertex was not discovered
-				if (is_flow_available(neighbourEdge))
+				bottomUp = false;
+				frontier.clear();
+				for (int current = 0; current < size; ++current)
 				{
-					//DEBUG
-					std::cout << "		Label current connection as discovered\n";
-					//DEBUG
+					if (frontierBits.test(current))
+					{
+						frontier.push_back(current);
+					}
+				}
+			}
 
-					// label as discovered
-					structure_.at(neighbourEdge.GetVertex(1)) = neighbourEdge.GetVertex(0);
+			long long nextSize = 0;
+			long long nextArcs = 0;
+			long long claimedArcs = 0;
 
-					//DEBUG
-					std::cout << "		BFS-flow: Add to queue < ";
-					print_vertex<id_type>(neighbourEdge.GetVertex(0));
-					std::cout << ", ";
-					print_vertex<id_type>(neighbourEdge.GetVertex(1));
-					std::cout << " >\n";
-					//DEBUG
+			if (bottomUp)
+			{
+				nextBits.clear();
+				for (int current = 0; current < size; ++current)
+				{
+					if (!is_available(current))
+					{
+						continue;
+					}
+
+					for (int arc = inOffsets_[current]; arc < inOffsets_[current + 1]; ++arc)
+					{
+						if (frontierBits.test(inSources_[arc]))
+						{
+							discover(current, inSources_[arc], level + 1);
+							nextBits.set(current);
+							++nextSize;
+							nextArcs += snapshot_.Degree(current);
+							claimedArcs += inOffsets_[current + 1] - inOffsets_[current];
+							break;
+						}
+					}
+				}
+				frontierBits.swap(nextBits);
+			}
+			else
+			{
+				next.clear();
+				for (std::size_t index = 0; index < frontier.size(); ++index)
+				{
+					prefetch_ahead(frontier, index);
+
+					int current = frontier[index];
+					for (int arc = snapshot_.Begin(current); arc < snapshot_.End(current); ++arc)
+					{
+						int target = snapshot_.Target(arc);
+						if (is_available(target))
+						{
+							discover(target, current, level + 1);
+							next.push_back(target);
+							nextArcs += snapshot_.Degree(target);
+							claimedArcs += inOffsets_[target + 1] - inOffsets_[target];
+						}
+					}
+				}
+				frontier.swap(next);
+				nextSize = static_cast<long long>(frontier.size());
+			}
 
-					auto tmpPair = std::make_pair(neighbourEdge.GetVertex(0), neighbourEdge.GetVertex(1));
+			++level;
+			frontierSize = nextSize;
+			frontierArcs = nextArcs;
+			unexploredArcs -= claimedArcs;
+		}
+	}
 
-					queue.push(tmpPair);
-				}
+	//------------------------------------------------------------------------------
+	//
+	//  Both snapshots follow view iteration order, so handles do not change.
+	//
+	//------------------------------------------------------------------------------
+	template<class id_type, class graph_type>
+	void
+	bfs<id_type, graph_type>::take_arcs()
+	{
+		if (inPlace_)
+		{
+			snapshot_ = list_type(*pGraph_);
+			inPlace_ = false;
+		}
+	}
+
+	//------------------------------------------------------------------------------
+	//
+	//  Counting sort of snapshot arcs by target.
+	//
+	//------------------------------------------------------------------------------
+	template<class id_type, class graph_type>
+	void
+	bfs<id_type, graph_type>::build_incoming()
+	{
+		if (!inOffsets_.empty())
+		{
+			return;
+		}
+
+		const int size = snapshot_.Size();
+		inOffsets_.assign(size + 1, 0);
+		for (int arc = 0; arc < snapshot_.EdgeCount(); ++arc)
+		{
+			++inOffsets_[snapshot_.Target(arc) + 1];
+		}
+		for (int current = 0; current < size; ++current)
+		{
+			inOffsets_[current + 1] += inOffsets_[current];
+		}
+
+		inSources_.resize(snapshot_.EdgeCount());
+		inArcs_.resize(snapshot_.EdgeCount());
+		std::vector<int> position(inOffsets_.begin(), inOffsets_.end() - 1);
+		for (int current = 0; current < size; ++current)
+		{
+			for (int arc = snapshot_.Begin(current); arc < snapshot_.End(current); ++arc)
+			{
+				int slot = position[snapshot_.Target(arc)]++;
+				inSources_[slot] = current;
+				inArcs_[slot] = arc;
 			}
 		}
 	}
@@ -6,10 +6,40 @@
 ///
 /// Depth First Search is one of the most basic and core graph traversal
 /// algorithms encapsulated inside an object. Algorithm class is parametrized by
-/// graph's vertex id type. Single algorithm object works with single graph object.
-/// Contains both recursive and stack implementations. Produces a parent structure,
-/// which is a dictionary containing child-parent pairs, where child - graph's
-/// vertex, parent - it's predecessor in a traversal order.
+/// graph's vertex id type and graph type: graph::Graph or any view exposing the
+/// same cbegin()/cend()/GetNeighbours() read interface (see view namespace).
+/// Single algorithm object works with single graph object, whose structure
+/// must not change during object lifetime: a CompressedList snapshot of the
+/// graph is taken at construction and searches run over snapshot handles.
+/// Views are walked in place instead: the snapshot holds their vertices only,
+/// stack frames keep view neighbour iterators and targets are looked up in
+/// the handle index, so no arc is copied. Such searches have no arc indices
+/// and leave arc classes empty; filters judging snapshot arcs only make the
+/// search take the view's arcs once, on first use.
+/// Search runs on an explicit stack of (vertex, next arc) frames, so it visits
+/// vertices in the same order a recursive implementation would, but depth is
+/// limited by heap, not by call stack. Produces dense arrays indexed by
+/// snapshot handle: parent handle, tree depth, discovery (pre-order) and
+/// finish (post-order) indices, and a class of every examined arc - tree,
+/// back, forward or cross. Undirected edges are two arcs, the one leading
+/// back to the tree parent is classified as back arc.
+/// Search from a root takes compile time policies (see traversal-policy.hpp):
+/// edge filter, visitor and terminator. Arcs rejected by the filter stay
+/// unexplored. Arc scans are resumed across stack frames, so only filters
+/// that do not read graph edges are supported.
+/// range() exposes the same search as a lazy input range of (vertex, parent,
+/// depth) steps in pre-order (see traversal-range.hpp): the stack advances
+/// only to the next discovery when iteration moves on.
+/// While scanning arcs of a vertex the search can prefetch visited mark and
+/// classification entries of the target d arcs ahead. Distance d is set by
+/// set_prefetch_distance(); prefetching is off by default, since on random
+/// graphs search mostly descends before the prefetched entries are used.
+/// Parent structure, a dictionary containing child-parent pairs, where child -
+/// graph's vertex, parent - it's predecessor in a traversal order, is derived
+/// from them on demand.
+/// Object is a reusable workspace: discovered vertices and examined arcs are
+/// epoch marks, so starting a new run is O(1) and stale array entries are
+/// cleared only when whole arrays are requested.
 ///
 /// The documentation is available on the following website:
 /// <website>
@@ -31,14 +61,23 @@
 // System
 // e.g.: #include <iostream>        // stdout
 #include <map>
-#include <stack>
-#include <algorithm> 			// std::for_each
+#include <vector>
+#include <utility> 			// std::pair, std::move, std::declval
+#include <type_traits> 		// std::decay_t
 #include <iostream>
 
 // Project
 // e.g.: #include "IncludeFile.h"   // MyType_t
 #include "graph-lib/component/vertex.hpp"	// component::Vertex
 #include "graph-lib/utility/print.hpp" 		// Debug printing
+#include "graph-lib/utility/memory.hpp" 	// utility::memory_usage
+#include "graph-lib/utility/epoch.hpp" 		// utility::epoch_marks
+#include "graph-lib/utility/prefetch.hpp" 	// utility::prefetch
+#include "graph-lib/implementation/compressed-list.hpp"			// implementation::CompressedList
+#include "graph-lib/view/view-support.hpp"						// view::support::is_view
+#include "graph-lib/algorithm/traversal/parent-structure.hpp"	// algorithm::parent_structure
+#include "graph-lib/algorithm/traversal/traversal-policy.hpp"	// algorithm::policy
+#include "graph-lib/algorithm/traversal/traversal-range.hpp"	// algorithm::traversal_range
 
 
 //------------------------------------------------------------------------------
@@ -80,19 +119,46 @@ namespace graph
 //------------------------------------------------------------------------------
 namespace algorithm
 {
+	//------------------------------------------------------------------------------
+	/// @brief Algorithm traits.
+	//------------------------------------------------------------------------------
+	namespace traits
+	{
+		//------------------------------------------------------------------------------
+		/// @brief Encapsulates DFS arc classes.
+		//------------------------------------------------------------------------------
+		enum class edge_class
+		{
+			/// @brief Arc was not examined.
+			unexplored,
+			/// @brief Arc discovered its target.
+			tree,
+			/// @brief Arc leads to an ancestor on the stack.
+			back,
+			/// @brief Arc leads to a finished descendant.
+			forward,
+			/// @brief Arc leads to a finished vertex of another subtree.
+			cross
+		};
+
+	} // namespace traits
+
 	//------------------------------------------------------------------------------
 	/// @brief DFS implementation.
 	///
 	//------------------------------------------------------------------------------
-	template<class id_type>
+	template<class id_type,
+	         class graph_type = graph::Graph<id_type>>
 	class dfs
 	{
 		using vertex_type           = component::Vertex<id_type>;
         using edge_type             = component::Edge<id_type>;
-        using parent_structure      = std::map<vertex_type,
-        									   vertex_type,
-        									   component::support::vertex_less<id_type>>;
-        using graph_type 			= graph::Graph<id_type>;
+        using parent_structure      = algorithm::parent_structure<id_type>;
+        using list_type 			= implementation::CompressedList<id_type>;
+        using graph_edge_type 		= view::support::edge_of<graph_type>;
+        using neighbour_range 		= std::decay_t<decltype(std::declval<const graph_type&>().GetNeighbours(
+        									std::declval<const vertex_type&>()))>;
+        using neighbour_iterator 	= decltype(std::declval<const neighbour_range&>().begin());
 
 	public:
 
@@ -100,11 +166,25 @@ namespace algorithm
 		///
 		/// @brief Value constructor.
 		///
+		/// Snapshot of the graph is taken here, O(V + E) time and memory. Of a
+		/// view only vertices are taken, O(V); its arcs are walked in place.
+		///
 		/// @param[in] pGraph Input graph pointer.
 		///
 		//------------------------------------------------------------------------------
 		dfs(const graph_type* pGraph);
 
+		//------------------------------------------------------------------------------
+		///
+		/// @brief Snapshot constructor.
+		///
+		/// Results refer to snapshot handles (see reordering.hpp).
+		///
+		/// @param[in] snapshot Graph snapshot, get_graph() returns nullptr.
+		///
+		//------------------------------------------------------------------------------
+		explicit dfs(list_type snapshot);
+
 		//------------------------------------------------------------------------------
 		///
 		/// @brief Execute DFS algorithm.
@@ -115,16 +195,179 @@ namespace algorithm
 		void
 		run(const vertex_type& root);
 
+		//------------------------------------------------------------------------------
+		///
+		/// @brief Execute DFS algorithm with policies.
+		///
+		/// @param[in] root Starting vertex.
+		///
+		/// @param[in] filter Edge filter, must not read graph edges.
+		///
+		/// @param[in] visitor Visitor, taken by reference when lvalue.
+		///
+		/// @param[in] terminator Early termination predicate.
+		///
+		//------------------------------------------------------------------------------
+		template<class filter_type,
+				 class visitor_type = policy::null_visitor,
+				 class terminator_type = policy::never_stop>
+		void
+		run(const vertex_type& root,
+			const filter_type& filter,
+			visitor_type&& visitor = visitor_type(),
+			const terminator_type& terminator = terminator_type());
+
+		//------------------------------------------------------------------------------
+		///
+		/// @brief Execute DFS algorithm from every vertex.
+		///
+		/// Vertices not discovered yet start new trees in snapshot order, each
+		/// tree root is its own parent.
+		///
+		//------------------------------------------------------------------------------
+		void
+		run();
+
+		//------------------------------------------------------------------------------
+		///
+		/// @brief Lazy DFS in discovery order.
+		///
+		/// Results of the previous run are dropped; arrays reflect vertices
+		/// discovered so far. Any other run invalidates the range.
+		///
+		/// @param[in] root Starting vertex.
+		///
+		/// @param[in] filter Edge filter, must not read graph edges.
+		///
+		/// @return Input range of traversal steps.
+		///
+		//------------------------------------------------------------------------------
+		template<class filter_type = policy::all_arcs>
+		traversal_range<dfs, filter_type>
+		range(const vertex_type& root,
+			  const filter_type& filter = filter_type());
+
+		//------------------------------------------------------------------------------
+		///
+		/// @brief Set prefetch lookahead.
+		///
+		/// @param[in] distance Arcs ahead in a scan, 0 disables prefetching.
+		///
+		//------------------------------------------------------------------------------
+		void
+		set_prefetch_distance(int distance);
+
 		//------------------------------------------------------------------------------
 		///
 		/// @brief Get algorithm execution results.
 		///
+		/// Built from dense parent array on first call after a run.
+		///
 		/// @return Reference to parent structure defining order.
 		///
 		//------------------------------------------------------------------------------
 		const parent_structure&
 		get() const;
 
+		//------------------------------------------------------------------------------
+		///
+		/// @brief Get dense parent array.
+		///
+		/// First call after a run clears stale entries, O(V + E).
+		///
+		/// @return Parent handle per snapshot handle, -1 if not discovered,
+		///         root is its own parent.
+		///
+		//------------------------------------------------------------------------------
+		const std::vector<int>&
+		get_parents() const;
+
+		//------------------------------------------------------------------------------
+		///
+		/// @brief Get parent of one vertex, O(1).
+		///
+		/// @param[in] handle Snapshot handle.
+		///
+		/// @return Parent handle, -1 if not discovered.
+		///
+		//------------------------------------------------------------------------------
+		int
+		get_parent(int handle) const;
+
+		//------------------------------------------------------------------------------
+		///
+		/// @brief Get depth of one vertex, O(1).
+		///
+		/// @param[in] handle Snapshot handle.
+		///
+		/// @return Depth, -1 if not discovered.
+		///
+		//------------------------------------------------------------------------------
+		int
+		get_distance(int handle) const;
+
+		//------------------------------------------------------------------------------
+		///
+		/// @brief Get dense depth array.
+		///
+		/// First call after a run clears stale entries, O(V + E).
+		///
+		/// @return Depth in DFS tree per snapshot handle, -1 if not discovered.
+		///
+		//------------------------------------------------------------------------------
+		const std::vector<int>&
+		get_distances() const;
+
+		//------------------------------------------------------------------------------
+		///
+		/// @brief Get dense discovery order array.
+		///
+		/// First call after a run clears stale entries, O(V + E).
+		///
+		/// @return Discovery index per snapshot handle, -1 if not discovered.
+		///
+		//------------------------------------------------------------------------------
+		const std::vector<int>&
+		get_order() const;
+
+		//------------------------------------------------------------------------------
+		///
+		/// @brief Get dense finish order array.
+		///
+		/// First call after a run clears stale entries, O(V + E).
+		///
+		/// @return Finish index per snapshot handle, -1 if not discovered.
+		///
+		//------------------------------------------------------------------------------
+		const std::vector<int>&
+		get_finish() const;
+
+		//------------------------------------------------------------------------------
+		///
+		/// @brief Get arc classes.
+		///
+		/// First call after a run clears stale entries, O(V + E). Empty for a
+		/// search walking a view in place, which has no arc indices.
+		///
+		/// @return Class per snapshot arc index.
+		///
+		//------------------------------------------------------------------------------
+		const std::vector<traits::edge_class>&
+		get_edge_classes() const;
+
+		//------------------------------------------------------------------------------
+		///
+		/// @brief Get snapshot defining handles.
+		///
+		/// Search walking a view in place holds its vertices only, until a
+		/// filter needing arcs takes them.
+		///
+		/// @return Graph snapshot.
+		///
+		//------------------------------------------------------------------------------
+		const list_type&
+		get_snapshot() const;
+
 		//------------------------------------------------------------------------------
 		///
 		/// @brief Get algorithm's graph.
@@ -135,25 +378,37 @@ namespace algorithm
 		const graph_type*
 		get_graph() const;
 
+		//------------------------------------------------------------------------------
+		///
+		/// @brief Heap memory used by algorithm state.
+		///
+		/// @return Memory usage report, snapshot and results are auxiliary.
+		///
+		//------------------------------------------------------------------------------
+		utility::memory_usage
+		MemoryUsage() const;
 
 	private:
 
+		template<class, class>
+		friend class traversal_range;
+
 		//------------------------------------------------------------------------------
 		///
 		/// @brief Check if second enpoint was visited by DFS algorithm.
 		///
-		/// @param[in] vertex Input vertex.
+		/// @param[in] handle Input vertex handle.
 		///
 		/// @retval True If vertex was visited.
 		/// @retval False otherwise.
 		///
 		//------------------------------------------------------------------------------
 		bool
-		is_discovered(const vertex_type& vertex);
+		is_discovered(int handle) const;
 
 		//------------------------------------------------------------------------------
 		///
-		/// @brief Reset parent structure.
+		/// @brief Start new run, O(1).
 		///
 		//------------------------------------------------------------------------------
 		void
@@ -161,31 +416,195 @@ namespace algorithm
 
 		//------------------------------------------------------------------------------
 		///
-		/// @brief Recursive DFS implementation.
+		/// @brief Clear stale entries of result arrays.
+		///
+		//------------------------------------------------------------------------------
+		void
+		sanitize() const;
+
+		//------------------------------------------------------------------------------
+		///
+		/// @brief Label vertex as discovered.
+		///
+		/// @param[in] handle Discovered vertex handle.
 		///
-		/// @param[in] parent Parent vertex.
+		/// @param[in] parent Parent handle.
 		///
-		/// @param[in] vertex Current vertex.
+		/// @param[in] depth Depth in DFS tree.
 		///
 		//------------------------------------------------------------------------------
 		void
-		dfs_recursive(const vertex_type& parent,
-					  const vertex_type& vertex);
+		discover(int handle,
+				 int parent,
+				 int depth);
 
 		//------------------------------------------------------------------------------
 		///
-		/// @brief Stack DFS implementation.
+		/// @brief Classify examined arc.
 		///
-		/// @param[in] root Starting vertex.
+		/// @param[in] arc Snapshot arc index.
+		///
+		/// @param[in] source Arc start handle, on top of the stack.
+		///
+		/// @param[in] target Arc end handle, already discovered.
 		///
 		//------------------------------------------------------------------------------
 		void
-		dfs_stack(const vertex_type& root);
+		classify(int arc,
+				 int source,
+				 int target);
+
+		//------------------------------------------------------------------------------
+		///
+		/// @brief Push frame of a discovered vertex.
+		///
+		/// @param[in] handle Vertex handle.
+		///
+		//------------------------------------------------------------------------------
+		void
+		push_frame(int handle);
+
+		//------------------------------------------------------------------------------
+		///
+		/// @brief Replace vertex snapshot of a view with a full one, once.
+		///
+		//------------------------------------------------------------------------------
+		void
+		take_arcs();
+
+		//------------------------------------------------------------------------------
+		///
+		/// @brief Explicit stack DFS implementation.
+		///
+		/// @param[in] root Starting vertex handle.
+		///
+		/// @param[in] filter Edge filter.
+		///
+		/// @param[in] visitor Visitor.
+		///
+		/// @param[in] terminator Early termination predicate.
+		///
+		/// @retval True If terminator stopped the search.
+		/// @retval False otherwise.
+		///
+		//------------------------------------------------------------------------------
+		template<class filter_type,
+				 class visitor_type,
+				 class terminator_type>
+		bool
+		dfs_stack(int root,
+				  const filter_type& filter,
+				  visitor_type& visitor,
+				  const terminator_type& terminator);
+
+		//------------------------------------------------------------------------------
+		///
+		/// @brief Run stack until next discovery.
+		///
+		/// @param[in] filter Edge filter.
+		///
+		/// @param[in] visitor Visitor.
+		///
+		/// @retval True If a vertex was discovered, it is on top of the stack.
+		/// @retval False If stack ran empty.
+		///
+		//------------------------------------------------------------------------------
+		template<class filter_type,
+				 class visitor_type>
+		bool
+		dfs_advance(const filter_type& filter,
+					visitor_type& visitor);
+
+		//------------------------------------------------------------------------------
+		///
+		/// @brief Start lazy run at root.
+		///
+		/// @param[in] root Starting vertex handle.
+		///
+		//------------------------------------------------------------------------------
+		void
+		step_start(int root);
+
+		//------------------------------------------------------------------------------
+		///
+		/// @brief Move lazy run to next discovered vertex.
+		///
+		/// @param[in] filter Edge filter.
+		///
+		/// @retval True If there is a next vertex.
+		/// @retval False otherwise.
+		///
+		//------------------------------------------------------------------------------
+		template<class filter_type>
+		bool
+		step_next(const filter_type& filter);
+
+		//------------------------------------------------------------------------------
+		///
+		/// @brief Current vertex of lazy run.
+		///
+		/// @return Traversal step.
+		///
+		//------------------------------------------------------------------------------
+		traversal_step
+		step_current() const;
 
 	private:
 
-		/// @brief Parent structure.
-		parent_structure structure_;
+		/// @brief Default prefetch lookahead, disabled: descent leaves the
+		///        scanned vertex before prefetched entries are used.
+		static constexpr int prefetch_ = 0;
+
+		/// @brief Prefetch lookahead, 0 if disabled.
+		int prefetchDistance_;
+
+		/// @brief Graph snapshot.
+		list_type snapshot_;
+
+		/// @brief Vertices discovered in current run.
+		utility::epoch_marks visited_;
+
+		/// @brief Arcs examined in current run.
+		utility::epoch_marks examined_;
+
+		/// @brief Parent handles, valid for visited vertices.
+		mutable std::vector<int> parents_;
+
+		/// @brief Depths in DFS tree, valid for visited vertices.
+		mutable std::vector<int> distances_;
+
+		/// @brief Discovery indices, valid for visited vertices.
+		mutable std::vector<int> order_;
+
+		/// @brief Finish indices, valid for visited vertices.
+		mutable std::vector<int> finish_;
+
+		/// @brief Arc classes, valid for examined arcs.
+		mutable std::vector<traits::edge_class> classes_;
+
+		/// @brief Arrays hold -1 / unexplored for stale entries.
+		mutable bool arraysValid_;
+
+		/// @brief Frames: vertex handle, next arc to examine.
+		std::vector<std::pair<int, int>> stack_;
+
+		/// @brief Next and end neighbour of every frame, in-place search only.
+		std::vector<std::pair<neighbour_iterator, neighbour_iterator>> cursors_;
+
+		/// @brief Number of discovered vertices.
+		int discovered_;
+
+		/// @brief Number of finished vertices.
+		int finished_;
+
+		/// @brief Parent structure, derived on demand.
+		mutable parent_structure structure_;
+
+		/// @brief Parent structure matches dense arrays.
+		mutable bool structureValid_;
+
+		/// @brief Search walks the view itself, snapshot holds vertices only.
+		bool inPlace_;
 
 		/// @brief Graph.
 		const graph_type* pGraph_;
@@ -216,28 +635,141 @@ namespace algorithm
 //------------------------------------------------------------------------------
 namespace algorithm
 {
+	//------------------------------------------------------------------------------
+	//
+	//  Views keep their arcs, only vertices are taken.
+	//
+	//------------------------------------------------------------------------------
+	template<class id_type, class graph_type>
+	dfs<id_type, graph_type>::dfs(const graph_type* pGraph) :
+			dfs(view::support::is_view<graph_type>::value ? list_type::VerticesOf(*pGraph) :
+															list_type(*pGraph))
+	{
+		pGraph_ = pGraph;
+		inPlace_ = view::support::is_view<graph_type>::value;
+	}
+
 	//------------------------------------------------------------------------------
 	//
 	//  <Design related information>
 	//
 	//------------------------------------------------------------------------------
-	template<class id_type>
-	dfs<id_type>::dfs(const typename dfs<id_type>::graph_type* pGraph) : pGraph_(pGraph)
+	template<class id_type, class graph_type>
+	dfs<id_type, graph_type>::dfs(
+			typename dfs<id_type, graph_type>::list_type snapshot) : prefetchDistance_(prefetch_),
+																	 snapshot_(std::move(snapshot)),
+																	 visited_(snapshot_.Size()),
+																	 examined_(snapshot_.EdgeCount()),
+																	 parents_(snapshot_.Size(), -1),
+																	 distances_(snapshot_.Size(), -1),
+																	 order_(snapshot_.Size(), -1),
+																	 finish_(snapshot_.Size(), -1),
+																	 classes_(snapshot_.EdgeCount(), traits::edge_class::unexplored),
+																	 arraysValid_(true),
+																	 discovered_(0),
+																	 finished_(0),
+																	 structureValid_(false),
+																	 inPlace_(false),
+																	 pGraph_(nullptr)
 	{
+
 		flush_structure();
 	}
 
+	//------------------------------------------------------------------------------
+	//
+	//  Results of the previous run are dropped.
+	//
+	//------------------------------------------------------------------------------
+	template<class id_type, class graph_type>
+	void
+	dfs<id_type, graph_type>::run(const typename dfs<id_type, graph_type>::vertex_type& root)
+	{
+		run(root, policy::all_arcs());
+	}
+
+	//------------------------------------------------------------------------------
+	//
+	//  Results of the previous run are dropped.
+	//
+	//------------------------------------------------------------------------------
+	template<class id_type, class graph_type>
+	template<class filter_type,
+			 class visitor_type,
+			 class terminator_type>
+	void
+	dfs<id_type, graph_type>::run(const typename dfs<id_type, graph_type>::vertex_type& root,
+								  const filter_type& filter,
+								  visitor_type&& visitor,
+								  const terminator_type& terminator)
+	{
+		static_assert(!filter_type::reads_edges, "DFS filters must not read graph edges");
+
+		int rootHandle = snapshot_.GetHandle(root);
+
+		if constexpr (!policy::judges_edges<filter_type, graph_edge_type>)
+		{
+			take_arcs();
+		}
+		flush_structure();
+
+		dfs_stack(rootHandle, filter, visitor, terminator);
+	}
+
+	//------------------------------------------------------------------------------
+	//
+	//  Results of the previous run are dropped.
+	//
+	//------------------------------------------------------------------------------
+	template<class id_type, class graph_type>
+	void
+	dfs<id_type, graph_type>::run()
+	{
+		flush_structure();
+
+		policy::null_visitor visitor;
+		for (int current = 0; current < snapshot_.Size(); ++current)
+		{
+			if (!is_discovered(current))
+			{
+				dfs_stack(current, policy::all_arcs(), visitor, policy::never_stop());
+			}
+		}
+	}
+
 	//------------------------------------------------------------------------------
 	//
 	//  <Design related information>
 	//
 	//------------------------------------------------------------------------------
-	template<class id_type>
+	template<class id_type, class graph_type>
+	template<class filter_type>
+	traversal_range<dfs<id_type, graph_type>, filter_type>
+	dfs<id_type, graph_type>::range(const typename dfs<id_type, graph_type>::vertex_type& root,
+									const filter_type& filter)
+	{
+		static_assert(!filter_type::reads_edges, "DFS filters must not read graph edges");
+
+		int rootHandle = snapshot_.GetHandle(root);
+
+		if constexpr (!policy::judges_edges<filter_type, graph_edge_type>)
+		{
+			take_arcs();
+		}
+
+		return traversal_range<dfs, filter_type>(this, rootHandle, filter);
+	}
+
+	//------------------------------------------------------------------------------
+	//
+	//  <Design related information>
+	//
+	//------------------------------------------------------------------------------
+	template<class id_type, class graph_type>
 	void
-	dfs<id_type>::run(const typename dfs<id_type>::vertex_type& root)
+	dfs<id_type, graph_type>::set_prefetch_distance(int distance)
 	{
-		dfs_recursive(root, root);
-		//dfs_stack(root);
+		prefetchDistance_ = distance;
 	}
 
 	//------------------------------------------------------------------------------
@@ -245,10 +777,16 @@ namespace algorithm
 	//  <Design related information>
 	//
 	//------------------------------------------------------------------------------
-	template<class id_type>
-	const typename dfs<id_type>::parent_structure&
-	dfs<id_type>::get() const
+	template<class id_type, class graph_type>
+	const typename dfs<id_type, graph_type>::parent_structure&
+	dfs<id_type, graph_type>::get() const
 	{
+		if (!structureValid_)
+		{
+			to_parent_structure(snapshot_, get_parents(), structure_);
+			structureValid_ = true;
+		}
+
 		return structure_;
 	}
 
@@ -257,9 +795,110 @@ namespace algorithm
 	//  <Design related information>
 	//
 	//------------------------------------------------------------------------------
-	template<class id_type>
-	const typename dfs<id_type>::graph_type*
-	dfs<id_type>::get_graph() const
+	template<class id_type, class graph_type>
+	const std::vector<int>&
+	dfs<id_type, graph_type>::get_parents() const
+	{
+		sanitize();
+		return parents_;
+	}
+
+	//------------------------------------------------------------------------------
+	//
+	//  <Design related information>
+	//
+	//------------------------------------------------------------------------------
+	template<class id_type, class graph_type>
+	const std::vector<int>&
+	dfs<id_type, graph_type>::get_distances() const
+	{
+		sanitize();
+		return distances_;
+	}
+
+	//------------------------------------------------------------------------------
+	//
+	//  <Design related information>
+	//
+	//------------------------------------------------------------------------------
+	template<class id_type, class graph_type>
+	const std::vector<int>&
+	dfs<id_type, graph_type>::get_order() const
+	{
+		sanitize();
+		return order_;
+	}
+
+	//------------------------------------------------------------------------------
+	//
+	//  <Design related information>
+	//
+	//------------------------------------------------------------------------------
+	template<class id_type, class graph_type>
+	const std::vector<int>&
+	dfs<id_type, graph_type>::get_finish() const
+	{
+		sanitize();
+		return finish_;
+	}
+
+	//------------------------------------------------------------------------------
+	//
+	//  <Design related information>
+	//
+	//------------------------------------------------------------------------------
+	template<class id_type, class graph_type>
+	const std::vector<traits::edge_class>&
+	dfs<id_type, graph_type>::get_edge_classes() const
+	{
+		sanitize();
+		return classes_;
+	}
+
+	//------------------------------------------------------------------------------
+	//
+	//  <Design related information>
+	//
+	//------------------------------------------------------------------------------
+	template<class id_type, class graph_type>
+	int
+	dfs<id_type, graph_type>::get_parent(int handle) const
+	{
+		return visited_.test(handle) ? parents_[handle] : -1;
+	}
+
+	//------------------------------------------------------------------------------
+	//
+	//  <Design related information>
+	//
+	//------------------------------------------------------------------------------
+	template<class id_type, class graph_type>
+	int
+	dfs<id_type, graph_type>::get_distance(int handle) const
+	{
+		return visited_.test(handle) ? distances_[handle] : -1;
+	}
+
+	//------------------------------------------------------------------------------
+	//
+	//  <Design related information>
+	//
+	//------------------------------------------------------------------------------
+	template<class id_type, class graph_type>
+	const typename dfs<id_type, graph_type>::list_type&
+	dfs<id_type, graph_type>::get_snapshot() const
+	{
+		return snapshot_;
+	}
+
+	//------------------------------------------------------------------------------
+	//
+	//  <Design related information>
+	//
+	//------------------------------------------------------------------------------
+	template<class id_type, class graph_type>
+	const graph_type*
+	dfs<id_type, graph_type>::get_graph() const
 	{
 		return pGraph_;
 	}
@@ -269,13 +908,24 @@ namespace algorithm
 	//  <Design related information>
 	//
 	//------------------------------------------------------------------------------
-	template<class id_type>
-	bool
-	dfs<id_type>::is_discovered(const typename dfs<id_type>::vertex_type& vertex)
+	template<class id_type, class graph_type>
+	utility::memory_usage
+	dfs<id_type, graph_type>::MemoryUsage() const
 	{
-		// Discovered: parent structure contains valid entry for the second endpoint
-		return (structure_.at(vertex) != 
-				component::Vertex<id_type>::invalidInstance_);
+		utility::memory_usage usage;
+		usage.auxiliary = structure_.get_allocator().allocated() +
+						  snapshot_.MemoryUsage().total() +
+						  utility::vector_bytes(parents_) +
+						  utility::vector_bytes(distances_) +
+						  utility::vector_bytes(order_) +
+						  utility::vector_bytes(finish_) +
+						  utility::vector_bytes(classes_) +
+						  utility::vector_bytes(stack_) +
+						  utility::vector_bytes(cursors_) +
+						  visited_.memory() +
+						  examined_.memory();
+
+		return usage;
 	}
 
 	//------------------------------------------------------------------------------
@@ -283,56 +933,65 @@ namespace algorithm
 	//  <Design related information>
 	//
 	//------------------------------------------------------------------------------
-	template<class id_type>
+	template<class id_type, class graph_type>
+	bool
+	dfs<id_type, graph_type>::is_discovered(int handle) const
+	{
+		return visited_.test(handle);
+	}
+
+	//------------------------------------------------------------------------------
+	//
+	//  Arrays keep stale entries; epoch bump hides them.
+	//
+	//------------------------------------------------------------------------------
+	template<class id_type, class graph_type>
 	void
-	dfs<id_type>::flush_structure()
+	dfs<id_type, graph_type>::flush_structure()
 	{
-		// initialize parent structure: insert <vertex, invalid_vertex> entries,
-		// where vertex - vertex of the graph
-		std::for_each(pGraph_->cbegin(), pGraph_->cend(),
-			[this](const auto& tuple)
-			{
-				structure_[tuple.first] = 
-					component::Vertex<id_type>::invalidInstance_;
-			});
+		visited_.reset();
+		examined_.reset();
+		discovered_ = 0;
+		finished_ = 0;
+		stack_.clear();
+		cursors_.clear();
+		arraysValid_ = false;
+		structureValid_ = false;
 	}
 
 	//------------------------------------------------------------------------------
 	//
-	//  <Design related information>
+	//  One pass per run, only when whole arrays are requested.
 	//
 	//------------------------------------------------------------------------------
-	template<class id_type>
+	template<class id_type, class graph_type>
 	void
-	dfs<id_type>::dfs_recursive(
-			const typename dfs<id_type>::vertex_type& parent,
-			const typename dfs<id_type>::vertex_type& vertex)
-	{
-		//DEBUG
-		std::cout << "	DFS: Current connection<";
-		print_vertex<id_type>(parent);
-		std::cout << ", ";
-		print_vertex<id_type>(vertex);
-		std::cout << " >\n"; 
-		//DEBUG
-
-		// mark node as discovered
-		structure_[vertex] = parent;
-
-		// proceed with vertex children
-		for (auto& neighbour : pGraph_->GetNeighbours(vertex))
+	dfs<id_type, graph_type>::sanitize() const
+	{
+		if (arraysValid_)
 		{
-			if (!is_discovered(neighbour.GetVertex(1)))
-			{
-				//DEBUG
-				std::cout << "		DFS:Proceed with ";
-				print_vertex<id_type>(neighbour.GetVertex(1));
-				std::cout << '\n';
-				//DEBUG
+			return;
+		}
 
-				dfs_recursive(vertex, neighbour.GetVertex(1));
+		for (int handle = 0; handle < snapshot_.Size(); ++handle)
+		{
+			if (!visited_.test(handle))
+			{
+				parents_[handle] = -1;
+				distances_[handle] = -1;
+				order_[handle] = -1;
+				finish_[handle] = -1;
+			}
+		}
+		for (int arc = 0; arc < snapshot_.EdgeCount(); ++arc)
+		{
+			if (!examined_.test(arc))
+			{
+				classes_[arc] = traits::edge_class::unexplored;
 			}
 		}
+
+		arraysValid_ = true;
 	}
 
 	//------------------------------------------------------------------------------
@@ -340,60 +999,268 @@ namespace algorithm
 	//  <Design related information>
 	//
 	//------------------------------------------------------------------------------
-	template<class id_type>
+	template<class id_type, class graph_type>
 	void
-	dfs<id_type>::dfs_stack(
-			const typename dfs<id_type>::vertex_type& root)
+	dfs<id_type, graph_type>::discover(int handle,
+									   int parent,
+									   int depth)
 	{
-		// initialize connection stack
-		std::stack<std::pair<typename dfs<id_type>::vertex_type, 
-							 typename dfs<id_type>::vertex_type>> stack;
-		// artificial algorithm initializer edge
-		auto rootConnection = std::make_pair(root,root);
-		stack.push(rootConnection);
+		visited_.set(handle);
+		parents_[handle] = parent;
+		distances_[handle] = depth;
+		order_[handle] = discovered_++;
+		finish_[handle] = -1;
+	}
 
-		while (!stack.empty())
+	//------------------------------------------------------------------------------
+	//
+	//  Target on the stack (discovered, not finished) is an ancestor; among
+	//  finished targets descendants were discovered later than source.
+	//
+	//------------------------------------------------------------------------------
+	template<class id_type, class graph_type>
+	void
+	dfs<id_type, graph_type>::classify(int arc,
+									   int source,
+									   int target)
+	{
+		examined_.set(arc);
+		if (finish_[target] == -1)
+		{
+			classes_[arc] = traits::edge_class::back;
+		}
+		else if (order_[target] > order_[source])
+		{
+			classes_[arc] = traits::edge_class::forward;
+		}
+		else
 		{
-			// pop current top connection
-			auto neighbourConnection = stack.top();
-			stack.pop();
-
-			//DEBUG
-			std::cout << "	DFS-stack: Current connection: < ";
-			print_vertex<id_type>(neighbourConnection.first);
-			std::cout << ", ";
-			print_vertex<id_type>(neighbourConnection.second);
-			std::cout <<  " >\n"; 
-			//DEBUG
-
-			// if not discovered
-			if (!is_discovered(neighbourConnection.second))
+			classes_[arc] = traits::edge_class::cross;
+		}
+	}
+
+	//------------------------------------------------------------------------------
+	//
+	//  Early termination leaves vertices on the stack unfinished.
+	//
+	//------------------------------------------------------------------------------
+	template<class id_type, class graph_type>
+	template<class filter_type,
+			 class visitor_type,
+			 class terminator_type>
+	bool
+	dfs<id_type, graph_type>::dfs_stack(int root,
+										const filter_type& filter,
+										visitor_type& visitor,
+										const terminator_type& terminator)
+	{
+		// mark root as discovered
+		discover(root, root, 0);
+		visitor.discover(root);
+		if (terminator(root))
+		{
+			return true;
+		}
+		push_frame(root);
+
+		while (dfs_advance(filter, visitor))
+		{
+			if (terminator(stack_.back().first))
 			{
-				//DEBUG
-				std::cout << "		Label current connection as discovered\n";
-				//DEBUG
+				stack_.clear();
+				cursors_.clear();
+				return true;
+			}
+		}
+
+		return false;
+	}
 
-				// label as discovered
-				structure_.at(neighbourConnection.second) = neighbourConnection.first;
+	//------------------------------------------------------------------------------
+	//
+	//  Each frame remembers the next arc to examine, so a vertex resumes its
+	//  arc scan where the recursive version would return to - visit order
+	//  is the same as recursion's. Vertex finishes once all its arcs were
+	//  examined. Search walking a view in place resumes the frame's view
+	//  neighbour iterator instead and classifies nothing.
+	//
+	//------------------------------------------------------------------------------
+	template<class id_type, class graph_type>
+	template<class filter_type,
+			 class visitor_type>
+	bool
+	dfs<id_type, graph_type>::dfs_advance(const filter_type& filter,
+										  visitor_type& visitor)
+	{
+		if constexpr (policy::judges_edges<filter_type, graph_edge_type>)
+		{
+			while (inPlace_ && !stack_.empty())
+			{
+				int current = stack_.back().first;
+				auto& cursor = cursors_.back();
 
-				// proceed with children
-				for (auto& neighbourEdge : pGraph_->GetNeighbours(neighbourConnection.second))
+				// all children examined
+				if (cursor.first == cursor.second)
 				{
-					//DEBUG
-					std::cout << "		DFS-stack: Add to stack < ";
-					print_vertex<id_type>(neighbourEdge.GetVertex(0));
-					std::cout << ", ";
-					print_vertex<id_type>(neighbourEdge.GetVertex(1));
-					std::cout << " >\n";
-					//DEBUG
+					finish_[current] = finished_++;
+					visitor.finish(current);
+					stack_.pop_back();
+					cursors_.pop_back();
+					continue;
+				}
 
-					auto tmpPair = std::make_pair(neighbourEdge.GetVertex(0), neighbourEdge.GetVertex(1));
+				const auto& neighbourEdge = *cursor.first;
+				++cursor.first;
 
-					stack.push(tmpPair);
+				if (!filter(neighbourEdge))
+				{
+					continue;
 				}
 
+				int target = snapshot_.GetHandle(neighbourEdge.GetVertex(1));
+				visitor.examine(current, -1, target);
+
+				// proceed with vertex children
+				if (!is_discovered(target))
+				{
+					discover(target, current, distances_[current] + 1);
+					visitor.discover(target);
+					push_frame(target);
+					return true;
+				}
 			}
 		}
+
+		while (!stack_.empty())
+		{
+			int current = stack_.back().first;
+			int arc = stack_.back().second;
+
+			// all children examined
+			if (arc == snapshot_.End(current))
+			{
+				finish_[current] = finished_++;
+				visitor.finish(current);
+				stack_.pop_back();
+				continue;
+			}
+
+			++stack_.back().second;
+
+			// target a few arcs ahead: mark and classification entries
+			if (prefetchDistance_ > 0 && arc + prefetchDistance_ < snapshot_.End(current))
+			{
+				int ahead = snapshot_.Target(arc + prefetchDistance_);
+				visited_.prefetch(ahead);
+				utility::prefetch(finish_.data() + ahead);
+				utility::prefetch(order_.data() + ahead);
+			}
+
+			if (!filter(snapshot_, arc))
+			{
+				continue;
+			}
+
+			int target = snapshot_.Target(arc);
+			visitor.examine(current, arc, target);
+
+			// proceed with vertex children
+			if (!is_discovered(target))
+			{
+				examined_.set(arc);
+				classes_[arc] = traits::edge_class::tree;
+				discover(target, current, distances_[current] + 1);
+				visitor.discover(target);
+				push_frame(target);
+				return true;
+			}
+			else
+			{
+				classify(arc, current, target);
+			}
+		}
+
+		return false;
+	}
+
+	//------------------------------------------------------------------------------
+	//
+	//  Frame of a search walking a view in place also keeps its neighbour
+	//  range; view ranges iterate storage of the underlying graph, so the
+	//  iterators outlive the range object.
+	//
+	//------------------------------------------------------------------------------
+	template<class id_type, class graph_type>
+	void
+	dfs<id_type, graph_type>::push_frame(int handle)
+	{
+		stack_.emplace_back(handle, snapshot_.Begin(handle));
+		if (inPlace_)
+		{
+			const auto& neighbours = pGraph_->GetNeighbours(snapshot_.GetVertex(handle));
+			cursors_.emplace_back(neighbours.begin(), neighbours.end());
+		}
+	}
+
+	//------------------------------------------------------------------------------
+	//
+	//  Both snapshots follow view iteration order, so handles do not change.
+	//
+	//------------------------------------------------------------------------------
+	template<class id_type, class graph_type>
+	void
+	dfs<id_type, graph_type>::take_arcs()
+	{
+		if (inPlace_)
+		{
+			snapshot_ = list_type(*pGraph_);
+			examined_.resize(snapshot_.EdgeCount());
+			classes_.assign(snapshot_.EdgeCount(), traits::edge_class::unexplored);
+			inPlace_ = false;
+		}
+	}
+
+	//------------------------------------------------------------------------------
+	//
+	//  <Design related information>
+	//
+	//------------------------------------------------------------------------------
+	template<class id_type, class graph_type>
+	void
+	dfs<id_type, graph_type>::step_start(int root)
+	{
+		flush_structure();
+		discover(root, root, 0);
+		push_frame(root);
+	}
+
+	//------------------------------------------------------------------------------
+	//
+	//  <Design related information>
+	//
+	//------------------------------------------------------------------------------
+	template<class id_type, class graph_type>
+	template<class filter_type>
+	bool
+	dfs<id_type, graph_type>::step_next(const filter_type& filter)
+	{
+		policy::null_visitor visitor;
+
+		return dfs_advance(filter, visitor);
+	}
+
+	//------------------------------------------------------------------------------
+	//
+	//  Newest discovery is always on top of the stack.
+	//
+	//------------------------------------------------------------------------------
+	template<class id_type, class graph_type>
+	traversal_step
+	dfs<id_type, graph_type>::step_current() const
+	{
+		int handle = stack_.back().first;
+
+		return traversal_step{handle, parents_[handle], distances_[handle]};
 	}
 }
 
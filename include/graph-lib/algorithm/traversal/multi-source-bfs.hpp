@@ -0,0 +1,504 @@
+//==============================================================================
+///
+/// @file multi-source-bfs.hpp
+///
+/// @brief Bit-parallel multi-source Breadth First Search.
+///
+/// Runs many breadth first searches over a CompressedList snapshot of the
+/// graph at once. Sources are processed in batches of lanes searches; every
+/// vertex holds lanes-bit masks of searches that have seen it and that visit
+/// it on the current level. A level is one scan over the arcs of vertices
+/// with nonzero visit masks, or-ing the masks into targets, so all searches
+/// of a batch share every edge inspection. Masks are fixed arrays of 64 bit
+/// words combined with plain word loops, which compilers turn into vector
+/// instructions.
+/// Result is a dense distance matrix: one row of snapshot handle distances
+/// per source, -1 for vertices a source does not reach.
+///
+/// The documentation is available on the following website:
+/// <website>
+///
+/// Support email: <email>
+///
+//==============================================================================
+
+//==============================================================================
+// Include only once
+//
+#ifndef GRAPH_LIB_ALGORITHM_TRAVERSAL_MULTI_SOURCE_BFS_HPP
+#define GRAPH_LIB_ALGORITHM_TRAVERSAL_MULTI_SOURCE_BFS_HPP
+
+
+//------------------------------------------------------------------------------
+// Include files
+//------------------------------------------------------------------------------
+// System
+// e.g.: #include <iostream>        // stdout
+#include <vector>
+#include <cstdint>                  // std::uint64_t
+#include <cstddef>                  // std::size_t
+#include <algorithm>                // std::fill, std::min
+
+// Project
+// e.g.: #include "IncludeFile.h"   // MyType_t
+#include "graph-lib/component/vertex.hpp"                   // component::Vertex
+#include "graph-lib/implementation/compressed-list.hpp"     // implementation::CompressedList
+#include "graph-lib/utility/memory.hpp"                     // utility::memory_usage
+#include "graph-lib/utility/bitmap.hpp"                     // utility::bitmap::lowest_bit
+
+
+//------------------------------------------------------------------------------
+// Global references
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Constants
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Macros
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Forward declarations
+//------------------------------------------------------------------------------
+namespace graph
+{
+    template<class id_type,
+             typename implementation_type>
+    class Graph;
+}
+
+
+//------------------------------------------------------------------------------
+// Data types
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+/// @brief Common graph algorithms.
+///
+//------------------------------------------------------------------------------
+namespace algorithm
+{
+    //------------------------------------------------------------------------------
+    /// @brief Multi-source BFS implementation.
+    ///
+    /// lanes: concurrent searches per batch, multiple of 64.
+    //------------------------------------------------------------------------------
+    template<class id_type,
+             class graph_type = graph::Graph<id_type>,
+             int lanes = 256>
+    class multi_source_bfs
+    {
+        static_assert(lanes > 0 && lanes % 64 == 0, "Lane count must be a positive multiple of 64");
+
+        using vertex_type           = component::Vertex<id_type>;
+        using list_type             = implementation::CompressedList<id_type>;
+        using word_type             = std::uint64_t;
+
+        /// @brief Words per vertex mask.
+        static constexpr int words_ = lanes / 64;
+
+    public:
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Value constructor.
+        ///
+        /// Snapshot of the graph is taken here.
+        ///
+        /// @param[in] pGraph Input graph pointer.
+        ///
+        //------------------------------------------------------------------------------
+        multi_source_bfs(const graph_type* pGraph);
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Snapshot constructor.
+        ///
+        /// Results refer to snapshot handles (see reordering.hpp).
+        ///
+        /// @param[in] snapshot Graph snapshot, get_graph() returns nullptr.
+        ///
+        //------------------------------------------------------------------------------
+        explicit multi_source_bfs(list_type snapshot);
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Execute BFS from every source.
+        ///
+        /// @param[in] sources Starting vertices, repetitions allowed.
+        ///
+        //------------------------------------------------------------------------------
+        void
+        run(const std::vector<vertex_type>& sources);
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Get algorithm execution results.
+        ///
+        /// @return Distance matrix, entry [source * Size() + handle] is the
+        ///         number of edges from source-th source to vertex with the
+        ///         snapshot handle, -1 if not reached.
+        ///
+        //------------------------------------------------------------------------------
+        const std::vector<int>&
+        get() const;
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Get distance from one source.
+        ///
+        /// @param[in] source Source index in run() argument.
+        ///
+        /// @param[in] vertex Target vertex.
+        ///
+        /// @return Number of edges, -1 if not reached.
+        ///
+        //------------------------------------------------------------------------------
+        int
+        get_distance(int source,
+                     const vertex_type& vertex) const;
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Get number of sources of the last run.
+        ///
+        /// @return Source count.
+        ///
+        //------------------------------------------------------------------------------
+        int
+        get_sources() const;
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Get snapshot defining handles.
+        ///
+        /// @return Graph snapshot.
+        ///
+        //------------------------------------------------------------------------------
+        const list_type&
+        get_snapshot() const;
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Get algorithm's graph.
+        ///
+        /// @return Reference to graph object.
+        ///
+        //------------------------------------------------------------------------------
+        const graph_type*
+        get_graph() const;
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Heap memory used by algorithm state.
+        ///
+        /// @return Memory usage report, snapshot, masks and distances are
+        ///         auxiliary.
+        ///
+        //------------------------------------------------------------------------------
+        utility::memory_usage
+        MemoryUsage() const;
+
+    private:
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Run one batch of searches.
+        ///
+        /// @param[in] roots Source handles, at most lanes of them.
+        ///
+        /// @param[in] first Index of the first batch source.
+        ///
+        //------------------------------------------------------------------------------
+        void
+        run_batch(const std::vector<int>& roots,
+                  int first);
+
+    private:
+
+        /// @brief Graph snapshot.
+        list_type snapshot_;
+
+        /// @brief Searches that have seen a vertex, words_ words per handle.
+        std::vector<word_type> seen_;
+
+        /// @brief Searches visiting a vertex on current level.
+        std::vector<word_type> visit_;
+
+        /// @brief Searches visiting a vertex on next level.
+        std::vector<word_type> visitNext_;
+
+        /// @brief Distance matrix.
+        std::vector<int> distances_;
+
+        /// @brief Number of sources.
+        int sources_;
+
+        /// @brief Graph.
+        const graph_type* pGraph_;
+    };
+
+} // namespace algorithm
+
+
+//------------------------------------------------------------------------------
+// Function declarations
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Variable definitions
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Function definitions
+//------------------------------------------------------------------------------
+namespace algorithm
+{
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type, class graph_type, int lanes>
+    multi_source_bfs<id_type, graph_type, lanes>::multi_source_bfs(const graph_type* pGraph) :
+                                                            multi_source_bfs(list_type(*pGraph))
+    {
+        pGraph_ = pGraph;
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type, class graph_type, int lanes>
+    multi_source_bfs<id_type, graph_type, lanes>::multi_source_bfs(
+            typename multi_source_bfs<id_type, graph_type, lanes>::list_type snapshot) :
+                                                            snapshot_(std::move(snapshot)),
+                                                            sources_(0),
+                                                            pGraph_(nullptr)
+    {
+        seen_.resize(static_cast<std::size_t>(snapshot_.Size()) * words_);
+        visit_.resize(seen_.size());
+        visitNext_.resize(seen_.size());
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  Handles are resolved up front, so an unknown source throws before any
+    //  search starts.
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type, class graph_type, int lanes>
+    void
+    multi_source_bfs<id_type, graph_type, lanes>::run(
+            const std::vector<typename multi_source_bfs<id_type, graph_type, lanes>::vertex_type>& sources)
+    {
+        std::vector<int> roots;
+        roots.reserve(sources.size());
+        for (const auto& source : sources)
+        {
+            roots.push_back(snapshot_.GetHandle(source));
+        }
+
+        sources_ = static_cast<int>(sources.size());
+        distances_.assign(static_cast<std::size_t>(sources_) * snapshot_.Size(), -1);
+
+        std::vector<int> batch;
+        for (int first = 0; first < sources_; first += lanes)
+        {
+            batch.assign(roots.begin() + first,
+                         roots.begin() + std::min(first + lanes, sources_));
+            run_batch(batch, first);
+        }
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type, class graph_type, int lanes>
+    const std::vector<int>&
+    multi_source_bfs<id_type, graph_type, lanes>::get() const
+    {
+        return distances_;
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type, class graph_type, int lanes>
+    int
+    multi_source_bfs<id_type, graph_type, lanes>::get_distance(int source,
+            const typename multi_source_bfs<id_type, graph_type, lanes>::vertex_type& vertex) const
+    {
+        return distances_.at(static_cast<std::size_t>(source) * snapshot_.Size() +
+                             snapshot_.GetHandle(vertex));
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type, class graph_type, int lanes>
+    int
+    multi_source_bfs<id_type, graph_type, lanes>::get_sources() const
+    {
+        return sources_;
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type, class graph_type, int lanes>
+    const typename multi_source_bfs<id_type, graph_type, lanes>::list_type&
+    multi_source_bfs<id_type, graph_type, lanes>::get_snapshot() const
+    {
+        return snapshot_;
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type, class graph_type, int lanes>
+    const graph_type*
+    multi_source_bfs<id_type, graph_type, lanes>::get_graph() const
+    {
+        return pGraph_;
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type, class graph_type, int lanes>
+    utility::memory_usage
+    multi_source_bfs<id_type, graph_type, lanes>::MemoryUsage() const
+    {
+        utility::memory_usage usage;
+        usage.auxiliary = snapshot_.MemoryUsage().total() +
+                          utility::vector_bytes(seen_) +
+                          utility::vector_bytes(visit_) +
+                          utility::vector_bytes(visitNext_) +
+                          utility::vector_bytes(distances_);
+
+        return usage;
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  Every level has two passes:
+    //      1. every vertex with a nonzero visit mask ors it into visitNext of
+    //         its arc targets - one scan of its arcs for all searches;
+    //      2. every vertex keeps only searches that have not seen it yet,
+    //         marks them seen and records distances of their bits.
+    //  Batch ends when a level discovers nothing.
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type, class graph_type, int lanes>
+    void
+    multi_source_bfs<id_type, graph_type, lanes>::run_batch(const std::vector<int>& roots,
+                                                            int first)
+    {
+        const int size = snapshot_.Size();
+        const std::size_t stride = static_cast<std::size_t>(size);
+
+        std::fill(seen_.begin(), seen_.end(), 0);
+        std::fill(visit_.begin(), visit_.end(), 0);
+        std::fill(visitNext_.begin(), visitNext_.end(), 0);
+
+        for (int lane = 0; lane < static_cast<int>(roots.size()); ++lane)
+        {
+            word_type bit = word_type(1) << (lane % 64);
+            std::size_t root = static_cast<std::size_t>(roots[lane]) * words_;
+            seen_[root + lane / 64] |= bit;
+            visit_[root + lane / 64] |= bit;
+            distances_[(first + lane) * stride + roots[lane]] = 0;
+        }
+
+        bool discovered = true;
+        for (int level = 1; discovered; ++level)
+        {
+            // expand: share arc scans between searches
+            for (int current = 0; current < size; ++current)
+            {
+                const word_type* visit = &visit_[static_cast<std::size_t>(current) * words_];
+
+                word_type any = 0;
+                for (int word = 0; word < words_; ++word)
+                {
+                    any |= visit[word];
+                }
+                if (any == 0)
+                {
+                    continue;
+                }
+
+                for (int arc = snapshot_.Begin(current); arc < snapshot_.End(current); ++arc)
+                {
+                    word_type* next = &visitNext_[static_cast<std::size_t>(snapshot_.Target(arc)) * words_];
+                    for (int word = 0; word < words_; ++word)
+                    {
+                        next[word] |= visit[word];
+                    }
+                }
+            }
+
+            // settle: drop searches that have seen the vertex already
+            discovered = false;
+            for (int current = 0; current < size; ++current)
+            {
+                word_type* next = &visitNext_[static_cast<std::size_t>(current) * words_];
+                word_type* seen = &seen_[static_cast<std::size_t>(current) * words_];
+
+                for (int word = 0; word < words_; ++word)
+                {
+                    word_type fresh = next[word] & ~seen[word];
+                    next[word] = fresh;
+                    seen[word] |= fresh;
+
+                    while (fresh != 0)
+                    {
+                        int lane = word * 64 + utility::bitmap::lowest_bit(fresh);
+                        distances_[(first + lane) * stride + current] = level;
+                        fresh &= fresh - 1;
+                        discovered = true;
+                    }
+                }
+            }
+
+            visit_.swap(visitNext_);
+            std::fill(visitNext_.begin(), visitNext_.end(), 0);
+        }
+    }
+
+} // namespace algorithm
+
+
+
+#endif // GRAPH_LIB_ALGORITHM_TRAVERSAL_MULTI_SOURCE_BFS_HPP
+//==============================================================================
+// End of multi-source-bfs.hpp
+// (note: the newline at the end of the file is intentional)
+//==============================================================================
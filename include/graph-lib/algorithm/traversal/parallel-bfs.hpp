@@ -0,0 +1,621 @@
+//==============================================================================
+///
+/// @file parallel-bfs.hpp
+///
+/// @brief Parallel level synchronous Breadth First Search.
+///
+/// Frontier of every level is expanded by a team of threads over a
+/// CompressedList snapshot of the graph. Threads grab frontier chunks from a
+/// shared cursor, claim undiscovered targets with compare-and-swap on a dense
+/// parent array and collect claimed vertices into thread local buffers, which
+/// are concatenated into the next frontier between barriers.
+/// Parent chosen for a vertex depends on thread timing. Deterministic mode
+/// claims vertices the same way, but picks the parent with the lowest
+/// frontier position and sorts every frontier, so repeated runs produce the
+/// same tree regardless of thread count.
+/// Results are the dense parent array over snapshot handles and the same
+/// parent structure the sequential bfs produces.
+///
+/// The documentation is available on the following website:
+/// <website>
+///
+/// Support email: <email>
+///
+//==============================================================================
+
+//==============================================================================
+// Include only once
+//
+#ifndef GRAPH_LIB_ALGORITHM_TRAVERSAL_PARALLEL_BFS_HPP
+#define GRAPH_LIB_ALGORITHM_TRAVERSAL_PARALLEL_BFS_HPP
+
+
+//------------------------------------------------------------------------------
+// Include files
+//------------------------------------------------------------------------------
+// System
+// e.g.: #include <iostream>        // stdout
+#include <map>
+#include <vector>
+#include <atomic>
+#include <thread>
+#include <limits>                   // std::numeric_limits
+#include <algorithm>                // std::sort, std::min
+#include <stdexcept>                // std::invalid_argument
+
+// Project
+// e.g.: #include "IncludeFile.h"   // MyType_t
+#include "graph-lib/component/vertex.hpp"                   // component::Vertex
+#include "graph-lib/implementation/compressed-list.hpp"     // implementation::CompressedList
+#include "graph-lib/utility/memory.hpp"                     // utility::memory_usage
+#include "graph-lib/utility/barrier.hpp"                    // utility::barrier
+#include "graph-lib/algorithm/traversal/parent-structure.hpp"   // algorithm::parent_structure
+
+
+//------------------------------------------------------------------------------
+// Global references
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Constants
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Macros
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Forward declarations
+//------------------------------------------------------------------------------
+namespace graph
+{
+    template<class id_type,
+             typename implementation_type>
+    class Graph;
+}
+
+
+//------------------------------------------------------------------------------
+// Data types
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+/// @brief Common graph algorithms.
+///
+//------------------------------------------------------------------------------
+namespace algorithm
+{
+    //------------------------------------------------------------------------------
+    /// @brief Parallel BFS implementation.
+    ///
+    //------------------------------------------------------------------------------
+    template<class id_type,
+             class graph_type = graph::Graph<id_type>>
+    class parallel_bfs
+    {
+        using vertex_type           = component::Vertex<id_type>;
+        using parent_structure      = algorithm::parent_structure<id_type>;
+        using list_type             = implementation::CompressedList<id_type>;
+
+    public:
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Value constructor.
+        ///
+        /// Snapshot of the graph is taken here.
+        ///
+        /// @param[in] pGraph Input graph pointer.
+        ///
+        /// @param[in] threads Thread count, 0 - hardware concurrency.
+        ///
+        //------------------------------------------------------------------------------
+        parallel_bfs(const graph_type* pGraph,
+                     int threads = 0);
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Snapshot constructor.
+        ///
+        /// Results refer to snapshot handles (see reordering.hpp).
+        ///
+        /// @param[in] snapshot Graph snapshot, get_graph() returns nullptr.
+        ///
+        /// @param[in] threads Thread count, 0 - hardware concurrency.
+        ///
+        //------------------------------------------------------------------------------
+        explicit parallel_bfs(list_type snapshot,
+                              int threads = 0);
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Set thread count.
+        ///
+        /// @param[in] threads Thread count, 0 - hardware concurrency.
+        ///
+        //------------------------------------------------------------------------------
+        void
+        set_threads(int threads);
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Enable or disable deterministic parent selection.
+        ///
+        /// @param[in] deterministic True to make output independent of timing.
+        ///
+        //------------------------------------------------------------------------------
+        void
+        set_deterministic(bool deterministic);
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Execute BFS algorithm.
+        ///
+        /// @param[in] root Starting vertex.
+        ///
+        //------------------------------------------------------------------------------
+        void
+        run(const vertex_type& root);
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Get algorithm execution results.
+        ///
+        /// Built from dense parent array on first call after a run.
+        ///
+        /// @return Reference to parent structure defining order.
+        ///
+        //------------------------------------------------------------------------------
+        const parent_structure&
+        get() const;
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Get dense parent array.
+        ///
+        /// @return Parent handle per snapshot handle, -1 if not discovered,
+        ///         root is its own parent.
+        ///
+        //------------------------------------------------------------------------------
+        const std::vector<int>&
+        get_parents() const;
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Get snapshot defining handles.
+        ///
+        /// @return Graph snapshot.
+        ///
+        //------------------------------------------------------------------------------
+        const list_type&
+        get_snapshot() const;
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Get algorithm's graph.
+        ///
+        /// @return Reference to graph object.
+        ///
+        //------------------------------------------------------------------------------
+        const graph_type*
+        get_graph() const;
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Heap memory used by algorithm state.
+        ///
+        /// @return Memory usage report, snapshot and results are auxiliary.
+        ///
+        //------------------------------------------------------------------------------
+        utility::memory_usage
+        MemoryUsage() const;
+
+    private:
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Expand levels until frontier is empty.
+        ///
+        /// @param[in] root Root handle.
+        ///
+        /// @param[in] threads Thread count.
+        ///
+        //------------------------------------------------------------------------------
+        void
+        expand(int root,
+               int threads);
+
+        //------------------------------------------------------------------------------
+        ///
+        /// @brief Lower atomic value to given one.
+        ///
+        //------------------------------------------------------------------------------
+        static void
+        fetch_min(std::atomic<int>& value,
+                  int candidate);
+
+    private:
+
+        /// @brief Frontier positions taken by a thread at once.
+        static constexpr std::size_t chunk_ = 64;
+
+        /// @brief Graph snapshot.
+        list_type snapshot_;
+
+        /// @brief Thread count.
+        int threads_;
+
+        /// @brief Deterministic mode.
+        bool deterministic_;
+
+        /// @brief Dense parent array.
+        std::vector<int> parents_;
+
+        /// @brief Parent structure, derived on demand.
+        mutable parent_structure structure_;
+
+        /// @brief Parent structure matches dense parent array.
+        mutable bool structureValid_;
+
+        /// @brief Graph.
+        const graph_type* pGraph_;
+    };
+
+} // namespace algorithm
+
+
+//------------------------------------------------------------------------------
+// Function declarations
+//------------------------------------------------------------------------------
+
+
+//------------------------------------------------------------------------------
+// Variable definitions
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Function definitions
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+//
+// Algorithms namespace
+//
+//------------------------------------------------------------------------------
+namespace algorithm
+{
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type, class graph_type>
+    parallel_bfs<id_type, graph_type>::parallel_bfs(const graph_type* pGraph,
+                                                    int threads) : parallel_bfs(list_type(*pGraph), threads)
+    {
+        pGraph_ = pGraph;
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type, class graph_type>
+    parallel_bfs<id_type, graph_type>::parallel_bfs(
+            typename parallel_bfs<id_type, graph_type>::list_type snapshot,
+            int threads) : snapshot_(std::move(snapshot)),
+                           threads_(0),
+                           deterministic_(false),
+                           structureValid_(false),
+                           pGraph_(nullptr)
+    {
+        set_threads(threads);
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type, class graph_type>
+    void
+    parallel_bfs<id_type, graph_type>::set_threads(int threads)
+    {
+        if (threads < 0)
+        {
+            throw std::invalid_argument("Thread count must not be negative");
+        }
+
+        threads_ = (threads == 0) ?
+            std::max(1, static_cast<int>(std::thread::hardware_concurrency())) : threads;
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type, class graph_type>
+    void
+    parallel_bfs<id_type, graph_type>::set_deterministic(bool deterministic)
+    {
+        deterministic_ = deterministic;
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type, class graph_type>
+    void
+    parallel_bfs<id_type, graph_type>::run(
+            const typename parallel_bfs<id_type, graph_type>::vertex_type& root)
+    {
+        int rootHandle = snapshot_.GetHandle(root);
+
+        // no point in more threads than vertices
+        int threads = std::max(1, std::min(threads_, snapshot_.Size()));
+        expand(rootHandle, threads);
+
+        structureValid_ = false;
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type, class graph_type>
+    const typename parallel_bfs<id_type, graph_type>::parent_structure&
+    parallel_bfs<id_type, graph_type>::get() const
+    {
+        if (!structureValid_)
+        {
+            to_parent_structure(snapshot_, parents_, structure_);
+            structureValid_ = true;
+        }
+
+        return structure_;
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type, class graph_type>
+    const std::vector<int>&
+    parallel_bfs<id_type, graph_type>::get_parents() const
+    {
+        return parents_;
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type, class graph_type>
+    const typename parallel_bfs<id_type, graph_type>::list_type&
+    parallel_bfs<id_type, graph_type>::get_snapshot() const
+    {
+        return snapshot_;
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type, class graph_type>
+    const graph_type*
+    parallel_bfs<id_type, graph_type>::get_graph() const
+    {
+        return pGraph_;
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type, class graph_type>
+    utility::memory_usage
+    parallel_bfs<id_type, graph_type>::MemoryUsage() const
+    {
+        utility::memory_usage usage;
+        usage.auxiliary = snapshot_.MemoryUsage().total() +
+                          utility::vector_bytes(parents_) +
+                          structure_.get_allocator().allocated();
+
+        return usage;
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  Every level takes four barrier phases:
+    //      1. expand frontier chunks into thread local buffers;
+    //      2. thread 0 computes buffer offsets in the next frontier;
+    //      3. buffers are copied into the next frontier;
+    //      4. thread 0 swaps frontiers (deterministic mode: sorts the next
+    //      frontier and resolves parents from lowest frontier positions).
+    //  Calling thread is thread 0 of the team.
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type, class graph_type>
+    void
+    parallel_bfs<id_type, graph_type>::expand(int root,
+                                              int threads)
+    {
+        const int size = snapshot_.Size();
+        const bool deterministic = deterministic_;
+
+        // parent handle; deterministic mode claims by depth and ranks parents
+        std::vector<std::atomic<int>> parent(size);
+        std::vector<std::atomic<int>> depth(deterministic ? size : 0);
+        std::vector<std::atomic<int>> rank(deterministic ? size : 0);
+        for (int current = 0; current < size; ++current)
+        {
+            parent[current].store(-1, std::memory_order_relaxed);
+        }
+        for (int current = 0; deterministic && current < size; ++current)
+        {
+            depth[current].store(-1, std::memory_order_relaxed);
+            rank[current].store(std::numeric_limits<int>::max(), std::memory_order_relaxed);
+        }
+
+        parent[root].store(root, std::memory_order_relaxed);
+        if (deterministic)
+        {
+            depth[root].store(0, std::memory_order_relaxed);
+        }
+
+        std::vector<int> frontier(1, root);
+        std::vector<int> next;
+        std::vector<std::vector<int>> buffers(threads);
+        std::vector<std::size_t> offsets(threads + 1, 0);
+        std::atomic<std::size_t> cursor(0);
+        int level = 0;
+        utility::barrier sync(threads);
+
+        auto worker = [&](int thread)
+        {
+            auto& local = buffers[thread];
+
+            while (!frontier.empty())
+            {
+                // 1. expand
+                local.clear();
+                for (;;)
+                {
+                    std::size_t begin = cursor.fetch_add(chunk_, std::memory_order_relaxed);
+                    if (begin >= frontier.size())
+                    {
+                        break;
+                    }
+                    std::size_t end = std::min(begin + chunk_, frontier.size());
+
+                    for (std::size_t position = begin; position < end; ++position)
+                    {
+                        int current = frontier[position];
+                        for (int arc = snapshot_.Begin(current); arc < snapshot_.End(current); ++arc)
+                        {
+                            int target = snapshot_.Target(arc);
+
+                            if (deterministic)
+                            {
+                                int expected = -1;
+                                if (depth[target].load(std::memory_order_relaxed) == -1 &&
+                                    depth[target].compare_exchange_strong(expected, level + 1,
+                                                                          std::memory_order_relaxed))
+                                {
+                                    local.push_back(target);
+                                }
+                                if (depth[target].load(std::memory_order_relaxed) == level + 1)
+                                {
+                                    fetch_min(rank[target], static_cast<int>(position));
+                                }
+                            }
+                            else
+                            {
+                                int expected = -1;
+                                if (parent[target].load(std::memory_order_relaxed) == -1 &&
+                                    parent[target].compare_exchange_strong(expected, current,
+                                                                           std::memory_order_relaxed))
+                                {
+                                    local.push_back(target);
+                                }
+                            }
+                        }
+                    }
+                }
+                sync.arrive_and_wait();
+
+                // 2. offsets
+                if (thread == 0)
+                {
+                    for (int other = 0; other < threads; ++other)
+                    {
+                        offsets[other + 1] = offsets[other] + buffers[other].size();
+                    }
+                    next.resize(offsets[threads]);
+                }
+                sync.arrive_and_wait();
+
+                // 3. concatenate
+                std::copy(local.begin(), local.end(), next.begin() + offsets[thread]);
+                sync.arrive_and_wait();
+
+                // 4. swap
+                if (thread == 0)
+                {
+                    if (deterministic)
+                    {
+                        std::sort(next.begin(), next.end());
+                        for (auto target : next)
+                        {
+                            parent[target].store(frontier[rank[target].load(std::memory_order_relaxed)],
+                                                 std::memory_order_relaxed);
+                        }
+                    }
+                    frontier.swap(next);
+                    cursor.store(0, std::memory_order_relaxed);
+                    ++level;
+                }
+                sync.arrive_and_wait();
+            }
+        };
+
+        std::vector<std::thread> team;
+        for (int thread = 1; thread < threads; ++thread)
+        {
+            team.emplace_back(worker, thread);
+        }
+        worker(0);
+        for (auto& member : team)
+        {
+            member.join();
+        }
+
+        parents_.resize(size);
+        for (int current = 0; current < size; ++current)
+        {
+            parents_[current] = parent[current].load(std::memory_order_relaxed);
+        }
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type, class graph_type>
+    void
+    parallel_bfs<id_type, graph_type>::fetch_min(std::atomic<int>& value,
+                                                 int candidate)
+    {
+        int current = value.load(std::memory_order_relaxed);
+        while (candidate < current &&
+               !value.compare_exchange_weak(current, candidate, std::memory_order_relaxed))
+        {   }
+    }
+
+} // namespace algorithm
+
+
+
+#endif // GRAPH_LIB_ALGORITHM_TRAVERSAL_PARALLEL_BFS_HPP
+//==============================================================================
+// End of parallel-bfs.hpp
+// (note: the newline at the end of the file is intentional)
+//==============================================================================
@@ -0,0 +1,156 @@
+//==============================================================================
+///
+/// @file parent-structure.hpp
+///
+/// @brief Parent structure compatibility adaptor.
+///
+/// Traversal algorithms keep their results in dense arrays indexed by
+/// CompressedList handles: parent handle, distance from root and discovery
+/// order, all -1 for undiscovered vertices. The parent structure - dictionary
+/// of child-parent vertex pairs used by printing utilities and older code - is
+/// derived from the dense parent array on demand by this adaptor.
+///
+/// The documentation is available on the following website:
+/// <website>
+///
+/// Support email: <email>
+///
+//==============================================================================
+
+//==============================================================================
+// Include only once
+//
+#ifndef GRAPH_LIB_ALGORITHM_TRAVERSAL_PARENT_STRUCTURE_HPP
+#define GRAPH_LIB_ALGORITHM_TRAVERSAL_PARENT_STRUCTURE_HPP
+
+
+//------------------------------------------------------------------------------
+// Include files
+//------------------------------------------------------------------------------
+// System
+// e.g.: #include <iostream>        // stdout
+#include <map>
+#include <vector>
+
+// Project
+// e.g.: #include "IncludeFile.h"   // MyType_t
+#include "graph-lib/component/vertex.hpp"                   // component::Vertex
+#include "graph-lib/component/vertex-support.hpp"           // component::support::vertex_less
+#include "graph-lib/implementation/compressed-list.hpp"     // implementation::CompressedList
+#include "graph-lib/utility/memory.hpp"                     // utility::counting_allocator
+
+
+//------------------------------------------------------------------------------
+// Global references
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Constants
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Macros
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Forward declarations
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Data types
+//------------------------------------------------------------------------------
+namespace algorithm
+{
+    //------------------------------------------------------------------------------
+    /// @brief Child-parent vertex dictionary.
+    ///
+    /// Undiscovered vertices are mapped to Vertex::invalidInstance_, root is
+    /// mapped to itself.
+    //------------------------------------------------------------------------------
+    template<class id_type>
+    using parent_structure = std::map<component::Vertex<id_type>,
+                                      component::Vertex<id_type>,
+                                      component::support::vertex_less<id_type>,
+                                      utility::counting_allocator<
+                                            std::pair<const component::Vertex<id_type>,
+                                                      component::Vertex<id_type>>>>;
+
+} // namespace algorithm
+
+
+//------------------------------------------------------------------------------
+// Function declarations
+//------------------------------------------------------------------------------
+namespace algorithm
+{
+    //------------------------------------------------------------------------------
+    /// @brief Fill parent structure from dense parent array.
+    ///
+    /// @param[in] list Snapshot defining handles.
+    ///
+    /// @param[in] parents Parent handle per handle, -1 if undiscovered.
+    ///
+    /// @param[out] structure Parent structure, previous content is dropped.
+    ///
+    //------------------------------------------------------------------------------
+    template<class id_type>
+    void
+    to_parent_structure(const implementation::CompressedList<id_type>& list,
+                        const std::vector<int>& parents,
+                        parent_structure<id_type>& structure);
+
+} // namespace algorithm
+
+
+//------------------------------------------------------------------------------
+// Variable definitions
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Function definitions
+//------------------------------------------------------------------------------
+namespace algorithm
+{
+    //------------------------------------------------------------------------------
+    //
+    //  Snapshots of graph::Graph list vertices in id order, so hinted insertion
+    //  at the end is amortized O(1) per vertex.
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type>
+    void
+    to_parent_structure(const implementation::CompressedList<id_type>& list,
+                        const std::vector<int>& parents,
+                        parent_structure<id_type>& structure)
+    {
+        structure.clear();
+
+        for (int current = 0; current < list.Size(); ++current)
+        {
+            structure.emplace_hint(structure.end(),
+                list.GetVertex(current),
+                (parents[current] == -1) ?
+                    component::Vertex<id_type>::invalidInstance_ :
+                    list.GetVertex(parents[current]));
+        }
+    }
+
+} // namespace algorithm
+
+
+
+#endif // GRAPH_LIB_ALGORITHM_TRAVERSAL_PARENT_STRUCTURE_HPP
+//==============================================================================
+// End of parent-structure.hpp
+// (note: the newline at the end of the file is intentional)
+//==============================================================================
@@ -0,0 +1,228 @@
+//==============================================================================
+///
+/// @file traversal-policy.hpp
+///
+/// @brief Compile time policies of traversal algorithms.
+///
+/// Traversals (bfs, dfs) are parametrized by three policies instead of
+/// runtime mode switches:
+///     - edge filter decides which arcs may be followed. Filters with
+///       reads_edges == false are called with snapshot and arc index and
+///       never touch the graph; filters with reads_edges == true are called
+///       with the graph edge of the arc, for state that lives in graph
+///       edges only (e.g. flow). Searches walking a view in place have no
+///       arc indices and call filters with the view's edge; filters without
+///       an edge overload make them snapshot the view's arcs first;
+///     - visitor receives discover(handle), examine(source, arc, target) for
+///       every followed arc and finish(handle) once all arcs of a vertex were
+///       scanned; arc is -1 for searches walking a view in place;
+///     - terminator is asked after every discovery whether search may stop.
+/// Policies are plain function objects, so every combination is a separate
+/// instantiation with empty defaults compiled away.
+///
+/// The documentation is available on the following website:
+/// <website>
+///
+/// Support email: <email>
+///
+//==============================================================================
+
+//==============================================================================
+// Include only once
+//
+#ifndef GRAPH_LIB_ALGORITHM_TRAVERSAL_TRAVERSAL_POLICY_HPP
+#define GRAPH_LIB_ALGORITHM_TRAVERSAL_TRAVERSAL_POLICY_HPP
+
+
+//------------------------------------------------------------------------------
+// Include files
+//------------------------------------------------------------------------------
+// System
+// e.g.: #include <iostream>        // stdout
+#include <type_traits>              // std::is_invocable_r_v
+
+// Project
+// e.g.: #include "IncludeFile.h"   // MyType_t
+
+
+//------------------------------------------------------------------------------
+// Global references
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Constants
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Macros
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Forward declarations
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Data types
+//------------------------------------------------------------------------------
+namespace algorithm
+{
+    //------------------------------------------------------------------------------
+    /// @brief Traversal policies.
+    //------------------------------------------------------------------------------
+    namespace policy
+    {
+        //------------------------------------------------------------------------------
+        /// @brief Edge filter following every arc.
+        ///
+        //------------------------------------------------------------------------------
+        struct all_arcs
+        {
+            static constexpr bool reads_edges = false;
+
+            template<class list_type>
+            bool
+            operator()(const list_type&, int) const
+            {
+                return true;
+            }
+
+            template<class edge_type>
+            bool
+            operator()(const edge_type&) const
+            {
+                return true;
+            }
+        };
+
+        //------------------------------------------------------------------------------
+        /// @brief Edge filter following arcs with positive snapshot capacity.
+        ///
+        //------------------------------------------------------------------------------
+        struct positive_capacity
+        {
+            static constexpr bool reads_edges = false;
+
+            template<class list_type>
+            bool
+            operator()(const list_type& list, int arc) const
+            {
+                return list.Capacity(arc) > 0;
+            }
+
+            template<class edge_type>
+            bool
+            operator()(const edge_type& edge) const
+            {
+                return edge.GetCapacity() > 0;
+            }
+        };
+
+        //------------------------------------------------------------------------------
+        /// @brief Edge filter following edges able to carry more flow.
+        ///
+        //------------------------------------------------------------------------------
+        struct residual_capacity
+        {
+            static constexpr bool reads_edges = true;
+
+            template<class edge_type>
+            bool
+            operator()(const edge_type& edge) const
+            {
+                return edge.GetCapacity() > edge.GetFlow();
+            }
+        };
+
+        //------------------------------------------------------------------------------
+        /// @brief Filter can judge a graph edge: reads edges or has an edge overload.
+        ///
+        //------------------------------------------------------------------------------
+        template<class filter_type,
+                 class edge_type>
+        constexpr bool judges_edges = std::is_invocable_r_v<bool, const filter_type&, const edge_type&>;
+
+        //------------------------------------------------------------------------------
+        /// @brief Visitor ignoring every event.
+        ///
+        //------------------------------------------------------------------------------
+        struct null_visitor
+        {
+            void
+            discover(int)
+            {   }
+
+            void
+            examine(int, int, int)
+            {   }
+
+            void
+            finish(int)
+            {   }
+        };
+
+        //------------------------------------------------------------------------------
+        /// @brief Terminator letting search run to completion.
+        ///
+        //------------------------------------------------------------------------------
+        struct never_stop
+        {
+            bool
+            operator()(int) const
+            {
+                return false;
+            }
+        };
+
+        //------------------------------------------------------------------------------
+        /// @brief Terminator stopping search once target is discovered.
+        ///
+        //------------------------------------------------------------------------------
+        struct stop_at
+        {
+            /// @brief Target handle.
+            int target;
+
+            bool
+            operator()(int handle) const
+            {
+                return handle == target;
+            }
+        };
+
+    } // namespace policy
+
+} // namespace algorithm
+
+
+//------------------------------------------------------------------------------
+// Function declarations
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Variable definitions
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Function definitions
+//------------------------------------------------------------------------------
+// (none)
+
+
+
+#endif // GRAPH_LIB_ALGORITHM_TRAVERSAL_TRAVERSAL_POLICY_HPP
+//==============================================================================
+// End of traversal-policy.hpp
+// (note: the newline at the end of the file is intentional)
+//==============================================================================
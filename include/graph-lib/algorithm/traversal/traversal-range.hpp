@@ -0,0 +1,277 @@
+//==============================================================================
+///
+/// @file traversal-range.hpp
+///
+/// @brief Lazy traversal ranges.
+///
+/// A traversal range is an input range over the vertices of a traversal in
+/// visit order, yielding (vertex, parent, depth) snapshot handles. The range
+/// drives its traversal object one step at a time: a vertex is expanded only
+/// when the iterator moves past it, so a consumer that stops after k
+/// vertices, or once a predicate matches, pays only for the arcs of vertices
+/// it has already seen.
+/// Range state lives in the traversal object's workspace: dense arrays of
+/// the traversal reflect the vertices discovered so far, and starting a run
+/// or another range on the same object invalidates the range.
+///
+/// Traversal type must provide (usually privately, befriending the range):
+///     - step_start(int root) - reset workspace and discover root;
+///     - step_next(filter) - advance to next vertex, false when exhausted;
+///     - step_current() - traversal_step of current vertex.
+///
+/// The documentation is available on the following website:
+/// <website>
+///
+/// Support email: <email>
+///
+//==============================================================================
+
+//==============================================================================
+// Include only once
+//
+#ifndef GRAPH_LIB_ALGORITHM_TRAVERSAL_TRAVERSAL_RANGE_HPP
+#define GRAPH_LIB_ALGORITHM_TRAVERSAL_TRAVERSAL_RANGE_HPP
+
+
+//------------------------------------------------------------------------------
+// Include files
+//------------------------------------------------------------------------------
+// System
+// e.g.: #include <iostream>        // stdout
+#include <cstddef>                  // std::ptrdiff_t
+#include <iterator>                 // std::input_iterator_tag
+
+// Project
+// e.g.: #include "IncludeFile.h"   // MyType_t
+
+
+//------------------------------------------------------------------------------
+// Global references
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Constants
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Macros
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Forward declarations
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Data types
+//------------------------------------------------------------------------------
+namespace algorithm
+{
+    //------------------------------------------------------------------------------
+    /// @brief Vertex visited by a traversal.
+    ///
+    //------------------------------------------------------------------------------
+    struct traversal_step
+    {
+        /// @brief Vertex handle.
+        int vertex;
+
+        /// @brief Parent handle, vertex itself for root.
+        int parent;
+
+        /// @brief Depth in traversal tree.
+        int depth;
+    };
+
+    //------------------------------------------------------------------------------
+    /// @brief Lazy input range over a traversal.
+    ///
+    //------------------------------------------------------------------------------
+    template<class traversal_type,
+             class filter_type>
+    class traversal_range
+    {
+    public:
+
+        //------------------------------------------------------------------------------
+        /// @brief Single pass iterator, equal to end() once traversal is exhausted.
+        ///
+        //------------------------------------------------------------------------------
+        class iterator
+        {
+        public:
+
+            using iterator_category = std::input_iterator_tag;
+            using value_type        = traversal_step;
+            using difference_type   = std::ptrdiff_t;
+            using pointer           = const traversal_step*;
+            using reference         = const traversal_step&;
+
+            //------------------------------------------------------------------------------
+            /// @brief Default constructor, end iterator.
+            ///
+            //------------------------------------------------------------------------------
+            iterator() : pRange_(nullptr)
+            {   }
+
+            //------------------------------------------------------------------------------
+            /// @brief Value constructor.
+            ///
+            /// @param[in] pRange Range driven by iterator, nullptr for end.
+            ///
+            //------------------------------------------------------------------------------
+            explicit iterator(traversal_range* pRange) : pRange_(pRange)
+            {   }
+
+            reference
+            operator*() const
+            {
+                return pRange_->step_;
+            }
+
+            pointer
+            operator->() const
+            {
+                return &pRange_->step_;
+            }
+
+            iterator&
+            operator++()
+            {
+                pRange_->advance();
+                if (pRange_->done_)
+                {
+                    pRange_ = nullptr;
+                }
+                return *this;
+            }
+
+            void
+            operator++(int)
+            {
+                ++*this;
+            }
+
+            bool
+            operator==(const iterator& other) const
+            {
+                return pRange_ == other.pRange_;
+            }
+
+            bool
+            operator!=(const iterator& other) const
+            {
+                return pRange_ != other.pRange_;
+            }
+
+        private:
+
+            /// @brief Driven range.
+            traversal_range* pRange_;
+        };
+
+        //------------------------------------------------------------------------------
+        /// @brief Value constructor, discovers root.
+        ///
+        /// @param[in] pTraversal Traversal object, its workspace holds range state.
+        ///
+        /// @param[in] root Root handle.
+        ///
+        /// @param[in] filter Edge filter.
+        ///
+        //------------------------------------------------------------------------------
+        traversal_range(traversal_type* pTraversal,
+                        int root,
+                        const filter_type& filter) : pTraversal_(pTraversal),
+                                                     filter_(filter),
+                                                     done_(false)
+        {
+            pTraversal_->step_start(root);
+            step_ = pTraversal_->step_current();
+        }
+
+        //------------------------------------------------------------------------------
+        /// @brief Iterator at current vertex.
+        ///
+        //------------------------------------------------------------------------------
+        iterator
+        begin()
+        {
+            return iterator(done_ ? nullptr : this);
+        }
+
+        //------------------------------------------------------------------------------
+        /// @brief Past the last vertex.
+        ///
+        //------------------------------------------------------------------------------
+        iterator
+        end()
+        {
+            return iterator();
+        }
+
+    private:
+
+        //------------------------------------------------------------------------------
+        /// @brief Move traversal to next vertex.
+        ///
+        //------------------------------------------------------------------------------
+        void
+        advance()
+        {
+            done_ = !pTraversal_->step_next(filter_);
+            if (!done_)
+            {
+                step_ = pTraversal_->step_current();
+            }
+        }
+
+    private:
+
+        /// @brief Traversal object.
+        traversal_type* pTraversal_;
+
+        /// @brief Edge filter.
+        filter_type filter_;
+
+        /// @brief Current vertex.
+        traversal_step step_;
+
+        /// @brief Traversal exhausted.
+        bool done_;
+    };
+
+} // namespace algorithm
+
+
+//------------------------------------------------------------------------------
+// Function declarations
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Variable definitions
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Function definitions
+//------------------------------------------------------------------------------
+// (none)
+
+
+
+#endif // GRAPH_LIB_ALGORITHM_TRAVERSAL_TRAVERSAL_RANGE_HPP
+//==============================================================================
+// End of traversal-range.hpp
+// (note: the newline at the end of the file is intentional)
+//==============================================================================
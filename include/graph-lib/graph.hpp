@@ -40,6 +40,7 @@
 // Project
 // e.g.: #include "IncludeFile.h"   // MyType_t
 #include "graph-lib/implementation/adjacency-list.hpp"
+#include "graph-lib/utility/memory.hpp"               // utility::memory_usage
 
 
 //------------------------------------------------------------------------------
@@ -407,6 +408,15 @@ namespace graph
         int
         Size() const;
 
+        //------------------------------------------------------------------------------
+        /// @brief Heap memory used by a graph.
+        ///
+        /// @return Implementation memory usage report.
+        ///
+        //------------------------------------------------------------------------------
+        utility::memory_usage
+        MemoryUsage() const;
+
 
     private:
 
@@ -821,6 +831,19 @@ namespace graph
         return implementation_.Size();
     }
 
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type,
+             typename implementation_type>
+    utility::memory_usage
+    Graph<id_type, implementation_type>::MemoryUsage() const
+    {
+        return implementation_.MemoryUsage();
+    }
+
     //------------------------------------------------------------------------------
     //
     //  <Design related information>
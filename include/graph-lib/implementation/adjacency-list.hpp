@@ -31,12 +31,14 @@
 #include <list>
 #include <map>
 #include <algorithm>                // std::for_each, std::find
+#include <utility>                  // std::move
 #include <iostream>                 // Debug
 
 // Project
 // e.g.: #include "IncludeFile.h"   // MyType_t
 #include "graph-lib/component/edge.hpp"
 #include "graph-lib/implementation/implementation-support.hpp"
+#include "graph-lib/utility/memory.hpp"       // utility::counting_allocator
 
 
 //------------------------------------------------------------------------------
@@ -77,14 +79,17 @@ namespace implementation
     
     public:
 
-        using edge_container        = std::list<edge_type>;
+        using edge_container        = std::list<edge_type,
+                                                utility::counting_allocator<edge_type>>;
 
 
     private:
 
         using map_type              = std::map<vertex_type,
                                                edge_container,
-                                               component::support::vertex_less<id_type>>;
+                                               component::support::vertex_less<id_type>,
+                                               utility::counting_allocator<
+                                                    std::pair<const vertex_type, edge_container>>>;
         using vertex_init_type      = id_type;
         using edge_init_type        = std::tuple<id_type,
                                                  id_type,
@@ -118,6 +123,49 @@ namespace implementation
         AdjacencyList(vertex_init_container& vertexList,
                       edge_init_container& edgeList);
 
+        //------------------------------------------------------------------------------
+        /// @brief Copy constructor.
+        ///
+        /// Copy counts its memory with its own allocators, the original's
+        /// usage is unchanged.
+        ///
+        /// @param[in] other Adjacency list to copy.
+        ///
+        //------------------------------------------------------------------------------
+        AdjacencyList(const AdjacencyList& other);
+
+        //------------------------------------------------------------------------------
+        /// @brief Move constructor.
+        ///
+        /// Moved-from list is left empty, with allocators of its own.
+        ///
+        /// @param[in,out] other Adjacency list to move.
+        ///
+        //------------------------------------------------------------------------------
+        AdjacencyList(AdjacencyList&& other);
+
+        //------------------------------------------------------------------------------
+        /// @brief Copy assignment, same accounting as copy constructor.
+        ///
+        /// @param[in] other Adjacency list to copy.
+        ///
+        /// @return This adjacency list.
+        ///
+        //------------------------------------------------------------------------------
+        AdjacencyList&
+        operator=(const AdjacencyList& other);
+
+        //------------------------------------------------------------------------------
+        /// @brief Move assignment, same accounting as move constructor.
+        ///
+        /// @param[in,out] other Adjacency list to move.
+        ///
+        /// @return This adjacency list.
+        ///
+        //------------------------------------------------------------------------------
+        AdjacencyList&
+        operator=(AdjacencyList&& other);
+
         //------------------------------------------------------------------------------
         /// @brief Add vertex to adjacency list.
         ///
@@ -307,6 +355,18 @@ namespace implementation
         int
         Size() const;
 
+        //------------------------------------------------------------------------------
+        /// @brief Heap memory used by adjacency list.
+        ///
+        /// Vertices - map nodes without embedded edge containers, edge
+        /// containers - list headers, edges - list nodes holding edges.
+        ///
+        /// @return Memory usage report.
+        ///
+        //------------------------------------------------------------------------------
+        utility::memory_usage
+        MemoryUsage() const;
+
 
     private:
 
@@ -351,6 +411,9 @@ namespace implementation
 
         /// @brief Adjacency list container.
         map_type list_;
+
+        /// @brief Allocator shared by all edge containers.
+        utility::counting_allocator<edge_type> edgeAllocator_;
     };
 
 } // namespace implementation
@@ -380,7 +443,8 @@ namespace implementation
     //  
     //------------------------------------------------------------------------------
     template<class id_type>
-    AdjacencyList<id_type>::AdjacencyList() : list_()
+    AdjacencyList<id_type>::AdjacencyList() : list_(),
+                                              edgeAllocator_()
     {   }
 
 
@@ -392,7 +456,8 @@ namespace implementation
     template<class id_type>
     AdjacencyList<id_type>::AdjacencyList(
             typename AdjacencyList<id_type>::vertex_init_container& vertexList,
-            typename AdjacencyList<id_type>::edge_init_container& edgeList)
+            typename AdjacencyList<id_type>::edge_init_container& edgeList) : list_(),
+                                                                              edgeAllocator_()
     {
         // insert vertices
         std::for_each(vertexList.begin(), vertexList.end(),
@@ -417,7 +482,85 @@ namespace implementation
 
     //------------------------------------------------------------------------------
     //
-    //  Push empty edge container.
+    //  Edge containers are rebuilt on this object's edge allocator; copying
+    //  them as map values would give every one a counter of its own.
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type>
+    AdjacencyList<id_type>::AdjacencyList(const AdjacencyList<id_type>& other) : list_(),
+                                                                                 edgeAllocator_()
+    {
+        for (const auto& tuple : other.list_)
+        {
+            list_.emplace_hint(list_.end(),
+                tuple.first,
+                typename AdjacencyList<id_type>::edge_container(tuple.second.begin(),
+                                                                tuple.second.end(),
+                                                                edgeAllocator_));
+        }
+    }
+
+
+    //------------------------------------------------------------------------------
+    //
+    //  Moved allocators share counters with the source, so the source gets
+    //  fresh ones: its later allocations must not report into this list.
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type>
+    AdjacencyList<id_type>::AdjacencyList(AdjacencyList<id_type>&& other) :
+                                    list_(std::move(other.list_)),
+                                    edgeAllocator_(other.edgeAllocator_)
+    {
+        other.list_ = map_type();
+        other.edgeAllocator_ = utility::counting_allocator<edge_type>();
+    }
+
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type>
+    AdjacencyList<id_type>&
+    AdjacencyList<id_type>::operator=(AdjacencyList<id_type>&& other)
+    {
+        if (this != &other)
+        {
+            list_ = std::move(other.list_);
+            edgeAllocator_ = other.edgeAllocator_;
+
+            other.list_ = map_type();
+            other.edgeAllocator_ = utility::counting_allocator<edge_type>();
+        }
+
+        return *this;
+    }
+
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type>
+    AdjacencyList<id_type>&
+    AdjacencyList<id_type>::operator=(const AdjacencyList<id_type>& other)
+    {
+        if (this != &other)
+        {
+            AdjacencyList<id_type> copy(other);
+            *this = std::move(copy);
+        }
+
+        return *this;
+    }
+
+
+    //------------------------------------------------------------------------------
+    //
+    //  Push empty edge container sharing edge allocator counter.
     //  
     //------------------------------------------------------------------------------
     template<class id_type>
@@ -425,11 +568,8 @@ namespace implementation
     AdjacencyList<id_type>::AddVertex(
             const typename AdjacencyList<id_type>::vertex_type& vertex)
     {
-        //DEBUG
-        std::cout << "Adding vertex with id " << vertex.Id() << std::endl;
-        //DEBUG
-
-        list_[vertex] = typename AdjacencyList<id_type>::edge_container();
+        list_.insert_or_assign(vertex,
+            typename AdjacencyList<id_type>::edge_container(edgeAllocator_));
     }
 
     //------------------------------------------------------------------------------
@@ -481,10 +621,6 @@ namespace implementation
     AdjacencyList<id_type>::RemoveVertex(
         const typename AdjacencyList<id_type>::vertex_type& vertex)
     {
-        //DEBUG
-        std::cout << "Remove vertex with id " << vertex.Id() << "):" << '\n';
-        //DEBUG
-
         // erase all edges which contain this vertex
         // iterate over <vertex, edge_list> pairs
         std::for_each(list_.begin(), list_.end(),
@@ -518,10 +654,6 @@ namespace implementation
             int capacity,
             int flow)
     {
-        //DEBUG
-        std::cout << "Add edge e=( " << vertex1.Id() << ", " << vertex2.Id() << ")\n";
-        //DEBUG
-
         list_.at(vertex1).push_back(
             typename AdjacencyList<id_type>::edge_type(vertex1, vertex2,
                                                        direction, weight,
@@ -530,10 +662,6 @@ namespace implementation
         // undirected case: push reversed
         if (direction == component::traits::edge_direction::none)
         {
-            //DEBUG
-            std::cout << "  Undirected edge case" << '\n';
-            //DEBUG
-            
             list_.at(vertex2).push_back(
                 typename AdjacencyList<id_type>::edge_type(vertex2, vertex1,
                                                            direction, weight,
@@ -650,10 +778,6 @@ namespace implementation
         // undirected case: erase reversed
         if (direction == component::traits::edge_direction::none)
         {
-            //DEBUG
-            std::cout << "  Undirected edge case" << '\n';
-            //DEBUG
-
             auto candidateReverse = std::find_if(list_.at(vertex2).begin(), list_.at(vertex2).end(),
                 [&vertex1, &direction, &weight](const auto& edge)
                 {
@@ -755,6 +879,27 @@ namespace implementation
         return list_.size();
     }
 
+    //------------------------------------------------------------------------------
+    //
+    //  Map and list allocators count exact node sizes; edge container headers
+    //  live inside map nodes, so they are moved from vertices to their own
+    //  category.
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type>
+    utility::memory_usage
+    AdjacencyList<id_type>::MemoryUsage() const
+    {
+        utility::memory_usage usage;
+
+        usage.edge_containers = list_.size() *
+            sizeof(typename AdjacencyList<id_type>::edge_container);
+        usage.vertices = list_.get_allocator().allocated() - usage.edge_containers;
+        usage.edges = edgeAllocator_.allocated();
+
+        return usage;
+    }
+
     //------------------------------------------------------------------------------
     //
     //  <Design related information>
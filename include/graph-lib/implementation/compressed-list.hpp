@@ -0,0 +1,762 @@
+//==============================================================================
+///
+/// @file compressed-list.hpp
+///
+/// @brief Compact read-optimized graph representation.
+///
+/// Compressed list is a compressed sparse row (CSR) snapshot of a graph:
+/// vertices are numbered by dense handles 0..V-1 and all outgoing connections
+/// are stored in contiguous arrays, so that neighbours of a vertex occupy one
+/// consecutive range of arcs. Snapshot keeps a copy of every vertex, therefore
+/// handle -> vertex id mapping is always available for output.
+/// Handle order is either the one of the source graph or an arbitrary
+/// permutation (see reordering.hpp).
+/// Vertex -> handle index is one array of handles sorted by vertex id, looked
+/// up by binary search. Graphs and views yield vertices in id order, so for
+/// snapshots taken from them the index is filled in O(V) without sorting.
+///
+/// The documentation is available on the following website:
+/// <website>
+///
+/// Support email: <email>
+///
+//==============================================================================
+
+//==============================================================================
+// Include only once
+//
+#ifndef GRAPH_LIB_IMPLEMENTATION_COMPRESSED_LIST_HPP
+#define GRAPH_LIB_IMPLEMENTATION_COMPRESSED_LIST_HPP
+
+
+//------------------------------------------------------------------------------
+// Include files
+//------------------------------------------------------------------------------
+// System
+// e.g.: #include <iostream>        // stdout
+#include <vector>
+#include <algorithm>                // std::is_sorted, std::stable_sort, std::lower_bound
+#include <numeric>                  // std::iota
+#include <stdexcept>                // std::out_of_range, std::invalid_argument
+#include <utility>                  // std::move
+
+// Project
+// e.g.: #include "IncludeFile.h"   // MyType_t
+#include "graph-lib/component/edge.hpp"
+#include "graph-lib/implementation/implementation-support.hpp"
+#include "graph-lib/utility/memory.hpp"       // utility::memory_usage
+#include "graph-lib/utility/prefetch.hpp"     // utility::prefetch
+
+
+//------------------------------------------------------------------------------
+// Constants
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Macros
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Forward declarations
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Data types
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+/// @brief Implementation related classes and functions.
+//------------------------------------------------------------------------------
+namespace implementation
+{
+    //------------------------------------------------------------------------------
+    /// @brief Compressed sparse row graph snapshot.
+    ///
+    /// Arc with index a, Begin(v) <= a < End(v), connects vertex v with
+    /// vertex Target(a).
+    //------------------------------------------------------------------------------
+    template<class id_type>
+    class CompressedList
+    {
+        using vertex_type           = component::Vertex<id_type>;
+        using edge_type             = component::Edge<id_type>;
+        using less_type             = component::support::vertex_less<id_type>;
+
+    public:
+
+        using handle_type           = int;
+        using order_type            = std::vector<handle_type>;
+
+    public:
+
+        //------------------------------------------------------------------------------
+        /// @brief Default constructor.
+        ///
+        /// Creates an empty snapshot.
+        //------------------------------------------------------------------------------
+        CompressedList();
+
+        //------------------------------------------------------------------------------
+        /// @brief Snapshot constructor.
+        ///
+        /// Handles follow source graph vertex iteration order.
+        ///
+        /// @param[in] graph Source graph (graph::Graph or any view exposing
+        ///                  the same cbegin()/cend()/GetNeighbours() interface).
+        ///
+        //------------------------------------------------------------------------------
+        template<class graph_type>
+        explicit CompressedList(const graph_type& graph);
+
+        //------------------------------------------------------------------------------
+        /// @brief Snapshot of vertices only.
+        ///
+        /// Handles follow source graph vertex iteration order, as with the
+        /// snapshot constructor, but no arcs are taken: every vertex has degree 0.
+        ///
+        /// @param[in] graph Source graph or view.
+        ///
+        /// @return Snapshot holding vertices and their index.
+        ///
+        //------------------------------------------------------------------------------
+        template<class graph_type>
+        static CompressedList
+        VerticesOf(const graph_type& graph);
+
+        //------------------------------------------------------------------------------
+        /// @brief Reordering constructor.
+        ///
+        /// @param[in] list Source snapshot.
+        ///
+        /// @param[in] order Permutation: order[newHandle] = handle in list.
+        ///
+        //------------------------------------------------------------------------------
+        CompressedList(const CompressedList& list,
+                       const order_type& order);
+
+        //------------------------------------------------------------------------------
+        /// @brief Array constructor.
+        ///
+        /// Takes ownership of already built CSR arrays.
+        ///
+        /// @param[in] vertices Handle -> vertex.
+        ///
+        /// @param[in] offsets Arc offsets, vertices.size() + 1 entries.
+        ///
+        /// @param[in] targets Arc end vertices.
+        ///
+        /// @param[in] weights Arc weights.
+        ///
+        /// @param[in] capacities Arc capacities.
+        ///
+        //------------------------------------------------------------------------------
+        CompressedList(std::vector<vertex_type> vertices,
+                       std::vector<int> offsets,
+                       std::vector<handle_type> targets,
+                       std::vector<int> weights,
+                       std::vector<int> capacities);
+
+        //------------------------------------------------------------------------------
+        /// @brief Get vertex by handle.
+        ///
+        /// @param[in] handle Vertex handle.
+        ///
+        /// @return Vertex copy stored in the snapshot.
+        ///
+        //------------------------------------------------------------------------------
+        const vertex_type&
+        GetVertex(handle_type handle) const;
+
+        //------------------------------------------------------------------------------
+        /// @brief Get handle of a vertex.
+        ///
+        /// @param[in] vertex Input vertex.
+        ///
+        /// @return Vertex handle.
+        ///
+        //------------------------------------------------------------------------------
+        handle_type
+        GetHandle(const vertex_type& vertex) const;
+
+        //------------------------------------------------------------------------------
+        /// @brief Check if snapshot contains vertex.
+        ///
+        /// @param[in] vertex Input vertex.
+        ///
+        /// @retval True If vertex is present.
+        /// @retval False Otherwise.
+        ///
+        //------------------------------------------------------------------------------
+        bool
+        ContainsVertex(const vertex_type& vertex) const;
+
+        //------------------------------------------------------------------------------
+        /// @brief First outgoing arc of a vertex.
+        ///
+        /// @param[in] handle Vertex handle.
+        ///
+        /// @return Arc index.
+        ///
+        //------------------------------------------------------------------------------
+        int
+        Begin(handle_type handle) const;
+
+        //------------------------------------------------------------------------------
+        /// @brief One past the last outgoing arc of a vertex.
+        ///
+        /// @param[in] handle Vertex handle.
+        ///
+        /// @return Arc index.
+        ///
+        //------------------------------------------------------------------------------
+        int
+        End(handle_type handle) const;
+
+        //------------------------------------------------------------------------------
+        /// @brief Number of outgoing arcs of a vertex.
+        ///
+        /// @param[in] handle Vertex handle.
+        ///
+        /// @return Out degree.
+        ///
+        //------------------------------------------------------------------------------
+        int
+        Degree(handle_type handle) const;
+
+        //------------------------------------------------------------------------------
+        /// @brief Arc end vertex.
+        ///
+        /// @param[in] arc Arc index.
+        ///
+        /// @return Target vertex handle.
+        ///
+        //------------------------------------------------------------------------------
+        handle_type
+        Target(int arc) const;
+
+        //------------------------------------------------------------------------------
+        /// @brief Arc weight.
+        ///
+        /// @param[in] arc Arc index.
+        ///
+        /// @return Weight of the edge the arc was built from.
+        ///
+        //------------------------------------------------------------------------------
+        int
+        Weight(int arc) const;
+
+        //------------------------------------------------------------------------------
+        /// @brief Arc capacity.
+        ///
+        /// @param[in] arc Arc index.
+        ///
+        /// @return Capacity of the edge the arc was built from.
+        ///
+        //------------------------------------------------------------------------------
+        int
+        Capacity(int arc) const;
+
+        //------------------------------------------------------------------------------
+        /// @brief Number of vertices.
+        ///
+        /// @return Vertex count.
+        ///
+        //------------------------------------------------------------------------------
+        int
+        Size() const;
+
+        //------------------------------------------------------------------------------
+        /// @brief Number of arcs.
+        ///
+        /// @return Arc count.
+        ///
+        //------------------------------------------------------------------------------
+        int
+        EdgeCount() const;
+
+        //------------------------------------------------------------------------------
+        /// @brief Prefetch arc offsets of a vertex.
+        ///
+        /// @param[in] handle Vertex handle.
+        ///
+        //------------------------------------------------------------------------------
+        void
+        PrefetchHeader(handle_type handle) const;
+
+        //------------------------------------------------------------------------------
+        /// @brief Prefetch first arc targets of a vertex.
+        ///
+        /// Reads arc offsets, so they should have been prefetched before.
+        ///
+        /// @param[in] handle Vertex handle.
+        ///
+        //------------------------------------------------------------------------------
+        void
+        PrefetchArcs(handle_type handle) const;
+
+        //------------------------------------------------------------------------------
+        /// @brief Heap memory used by the snapshot.
+        ///
+        /// Vertices - vertex array and id index, edge containers - offsets,
+        /// edges - arc arrays.
+        ///
+        /// @return Memory usage report.
+        ///
+        //------------------------------------------------------------------------------
+        utility::memory_usage
+        MemoryUsage() const;
+
+
+    private:
+
+        //------------------------------------------------------------------------------
+        /// @brief Rebuild vertex -> handle index from vertices_.
+        ///
+        //------------------------------------------------------------------------------
+        void
+        BuildIndex();
+
+        //------------------------------------------------------------------------------
+        /// @brief Look vertex up in index.
+        ///
+        /// @param[in] vertex Input vertex.
+        ///
+        /// @return Vertex handle, -1 if not present.
+        ///
+        //------------------------------------------------------------------------------
+        handle_type
+        FindHandle(const vertex_type& vertex) const;
+
+
+    private:
+
+        /// @brief Handle -> vertex.
+        std::vector<vertex_type> vertices_;
+
+        /// @brief Handles sorted by vertex, equal vertices by handle.
+        std::vector<handle_type> index_;
+
+        /// @brief Arcs of vertex v are [offsets_[v], offsets_[v + 1]).
+        std::vector<int> offsets_;
+
+        /// @brief Arc end vertices.
+        std::vector<handle_type> targets_;
+
+        /// @brief Arc weights.
+        std::vector<int> weights_;
+
+        /// @brief Arc capacities.
+        std::vector<int> capacities_;
+    };
+
+} // namespace implementation
+
+
+
+//------------------------------------------------------------------------------
+// Global references
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Variable definitions
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Function definitions
+//------------------------------------------------------------------------------
+namespace implementation
+{
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type>
+    CompressedList<id_type>::CompressedList() : offsets_(1, 0)
+    {   }
+
+    //------------------------------------------------------------------------------
+    //
+    //  Two passes over the source: first assigns handles, second fills arcs.
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type>
+    template<class graph_type>
+    CompressedList<id_type>::CompressedList(const graph_type& graph)
+    {
+        // assign handles in iteration order
+        for (auto it = graph.cbegin(); it != graph.cend(); ++it)
+        {
+            vertices_.push_back((*it).first);
+        }
+        BuildIndex();
+
+        // fill arcs
+        offsets_.reserve(vertices_.size() + 1);
+        offsets_.push_back(0);
+        for (auto it = graph.cbegin(); it != graph.cend(); ++it)
+        {
+            for (const auto& edge : graph.GetNeighbours((*it).first))
+            {
+                targets_.push_back(GetHandle(edge.GetVertex(1)));
+                weights_.push_back(edge.GetWeight());
+                capacities_.push_back(edge.GetCapacity());
+            }
+            offsets_.push_back(static_cast<int>(targets_.size()));
+        }
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type>
+    template<class graph_type>
+    CompressedList<id_type>
+    CompressedList<id_type>::VerticesOf(const graph_type& graph)
+    {
+        std::vector<vertex_type> vertices;
+        for (auto it = graph.cbegin(); it != graph.cend(); ++it)
+        {
+            vertices.push_back((*it).first);
+        }
+
+        std::vector<int> offsets(vertices.size() + 1, 0);
+
+        return CompressedList(std::move(vertices), std::move(offsets), {}, {}, {});
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  Arcs of each vertex keep their relative order, only handles change.
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type>
+    CompressedList<id_type>::CompressedList(
+            const CompressedList<id_type>& list,
+            const typename CompressedList<id_type>::order_type& order)
+    {
+        if (static_cast<int>(order.size()) != list.Size())
+        {
+            throw std::invalid_argument("Order is not a permutation of graph vertices");
+        }
+
+        // inverse permutation: old handle -> new handle
+        std::vector<handle_type> position(order.size(), -1);
+        for (int i = 0; i < static_cast<int>(order.size()); ++i)
+        {
+            if (order[i] < 0 || order[i] >= list.Size() || position[order[i]] != -1)
+            {
+                throw std::invalid_argument("Order is not a permutation of graph vertices");
+            }
+            position[order[i]] = i;
+        }
+
+        vertices_.reserve(order.size());
+        offsets_.reserve(order.size() + 1);
+        targets_.reserve(list.targets_.size());
+        weights_.reserve(list.weights_.size());
+        capacities_.reserve(list.capacities_.size());
+
+        offsets_.push_back(0);
+        for (auto oldHandle : order)
+        {
+            vertices_.push_back(list.vertices_[oldHandle]);
+
+            for (int arc = list.Begin(oldHandle); arc < list.End(oldHandle); ++arc)
+            {
+                targets_.push_back(position[list.targets_[arc]]);
+                weights_.push_back(list.weights_[arc]);
+                capacities_.push_back(list.capacities_[arc]);
+            }
+            offsets_.push_back(static_cast<int>(targets_.size()));
+        }
+
+        BuildIndex();
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type>
+    CompressedList<id_type>::CompressedList(
+            std::vector<typename CompressedList<id_type>::vertex_type> vertices,
+            std::vector<int> offsets,
+            std::vector<typename CompressedList<id_type>::handle_type> targets,
+            std::vector<int> weights,
+            std::vector<int> capacities) : vertices_(std::move(vertices)),
+                                           offsets_(std::move(offsets)),
+                                           targets_(std::move(targets)),
+                                           weights_(std::move(weights)),
+                                           capacities_(std::move(capacities))
+    {
+        if ( (offsets_.size() != vertices_.size() + 1) ||
+             (weights_.size() != targets_.size()) ||
+             (capacities_.size() != targets_.size()) ||
+             (offsets_.back() != static_cast<int>(targets_.size())) )
+        {
+            throw std::invalid_argument("Inconsistent compressed list arrays");
+        }
+
+        BuildIndex();
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type>
+    const typename CompressedList<id_type>::vertex_type&
+    CompressedList<id_type>::GetVertex(
+            typename CompressedList<id_type>::handle_type handle) const
+    {
+        return vertices_.at(handle);
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type>
+    typename CompressedList<id_type>::handle_type
+    CompressedList<id_type>::GetHandle(
+            const typename CompressedList<id_type>::vertex_type& vertex) const
+    {
+        handle_type handle = FindHandle(vertex);
+
+        if (handle != -1)
+        {
+            return handle;
+        }
+
+        throw std::out_of_range("Graph contains no such vertex");
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type>
+    bool
+    CompressedList<id_type>::ContainsVertex(
+            const typename CompressedList<id_type>::vertex_type& vertex) const
+    {
+        return FindHandle(vertex) != -1;
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type>
+    int
+    CompressedList<id_type>::Begin(
+            typename CompressedList<id_type>::handle_type handle) const
+    {
+        return offsets_[handle];
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type>
+    int
+    CompressedList<id_type>::End(
+            typename CompressedList<id_type>::handle_type handle) const
+    {
+        return offsets_[handle + 1];
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type>
+    int
+    CompressedList<id_type>::Degree(
+            typename CompressedList<id_type>::handle_type handle) const
+    {
+        return offsets_[handle + 1] - offsets_[handle];
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type>
+    typename CompressedList<id_type>::handle_type
+    CompressedList<id_type>::Target(int arc) const
+    {
+        return targets_[arc];
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type>
+    int
+    CompressedList<id_type>::Weight(int arc) const
+    {
+        return weights_[arc];
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type>
+    int
+    CompressedList<id_type>::Capacity(int arc) const
+    {
+        return capacities_[arc];
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type>
+    int
+    CompressedList<id_type>::Size() const
+    {
+        return static_cast<int>(vertices_.size());
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type>
+    int
+    CompressedList<id_type>::EdgeCount() const
+    {
+        return static_cast<int>(targets_.size());
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type>
+    void
+    CompressedList<id_type>::PrefetchHeader(
+            typename CompressedList<id_type>::handle_type handle) const
+    {
+        utility::prefetch(offsets_.data() + handle);
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  Hardware prefetcher follows the rest of the arc run.
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type>
+    void
+    CompressedList<id_type>::PrefetchArcs(
+            typename CompressedList<id_type>::handle_type handle) const
+    {
+        utility::prefetch(targets_.data() + offsets_[handle]);
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type>
+    utility::memory_usage
+    CompressedList<id_type>::MemoryUsage() const
+    {
+        utility::memory_usage usage;
+
+        usage.vertices = utility::vector_bytes(vertices_) + utility::vector_bytes(index_);
+        usage.edge_containers = utility::vector_bytes(offsets_);
+        usage.edges = utility::vector_bytes(targets_) +
+                      utility::vector_bytes(weights_) +
+                      utility::vector_bytes(capacities_);
+
+        return usage;
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type>
+    void
+    CompressedList<id_type>::BuildIndex()
+    {
+        index_.resize(vertices_.size());
+        std::iota(index_.begin(), index_.end(), 0);
+
+        if (!std::is_sorted(vertices_.begin(), vertices_.end(), less_type()))
+        {
+            std::stable_sort(index_.begin(), index_.end(),
+                [this](handle_type lhs, handle_type rhs)
+                {
+                    return less_type()(vertices_[lhs], vertices_[rhs]);
+                });
+        }
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  First of equal vertices wins, as the first handle stored for them.
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type>
+    typename CompressedList<id_type>::handle_type
+    CompressedList<id_type>::FindHandle(
+            const typename CompressedList<id_type>::vertex_type& vertex) const
+    {
+        auto candidate = std::lower_bound(index_.begin(), index_.end(), vertex,
+            [this](handle_type handle, const vertex_type& value)
+            {
+                return less_type()(vertices_[handle], value);
+            });
+
+        if (candidate != index_.end() && !less_type()(vertex, vertices_[*candidate]))
+        {
+            return *candidate;
+        }
+
+        return -1;
+    }
+
+} //    namespace implementation
+
+
+
+#endif // GRAPH_LIB_IMPLEMENTATION_COMPRESSED_LIST_HPP
+//==============================================================================
+// End of compressed-list.hpp
+// (note: the newline at the end of the file is intentional)
+//==============================================================================
@@ -0,0 +1,1234 @@
+//==============================================================================
+///
+/// @file dynamic-list.hpp
+///
+/// @brief Write-optimized dynamic graph representation.
+///
+/// Dynamic list is organized in a log-structured (LSM-like) way:
+///     - base - immutable CompressedList snapshot, read at CSR speed.
+///     - delta - per vertex buckets of appended mutations: inserted arcs and
+///     tombstones of removed arcs.
+/// Edge insertion and removal only append to the delta, reads combine base and
+/// delta on the fly. Once delta grows over a threshold, it is frozen and
+/// merged with the base into a new snapshot by a background thread, while new
+/// mutations keep going to a fresh delta. Tombstones of a delta refer to arcs
+/// of all older layers.
+///
+/// All public methods are thread safe: mutations take exclusive lock for the
+/// duration of an append, reads take shared lock.
+///
+/// The documentation is available on the following website:
+/// <website>
+///
+/// Support email: <email>
+///
+//==============================================================================
+
+//==============================================================================
+// Include only once
+//
+#ifndef GRAPH_LIB_IMPLEMENTATION_DYNAMIC_LIST_HPP
+#define GRAPH_LIB_IMPLEMENTATION_DYNAMIC_LIST_HPP
+
+
+//------------------------------------------------------------------------------
+// Include files
+//------------------------------------------------------------------------------
+// System
+// e.g.: #include <iostream>        // stdout
+#include <vector>
+#include <deque>
+#include <map>
+#include <unordered_map>
+#include <algorithm>                // std::sort, std::lower_bound
+#include <cstdint>                  // std::uint64_t
+#include <utility>                  // std::pair
+#include <memory>                   // std::shared_ptr
+#include <mutex>                    // std::unique_lock
+#include <shared_mutex>             // std::shared_mutex
+#include <thread>
+#include <condition_variable>       // std::condition_variable_any
+#include <stdexcept>                // std::out_of_range
+
+// Project
+// e.g.: #include "IncludeFile.h"   // MyType_t
+#include "graph-lib/implementation/compressed-list.hpp"
+#include "graph-lib/utility/memory.hpp"       // utility::memory_usage
+
+
+//------------------------------------------------------------------------------
+// Constants
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Macros
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Forward declarations
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Data types
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+/// @brief Implementation related classes and functions.
+//------------------------------------------------------------------------------
+namespace implementation
+{
+    //------------------------------------------------------------------------------
+    /// @brief Dynamic graph: compact base plus delta log.
+    ///
+    /// Vertices get dense handles in insertion order, handles are preserved by
+    /// compaction. Vertices can not be removed.
+    //------------------------------------------------------------------------------
+    template<class id_type>
+    class DynamicList
+    {
+        using vertex_type           = component::Vertex<id_type>;
+        using base_type             = CompressedList<id_type>;
+        using base_ptr              = std::shared_ptr<const base_type>;
+        using index_type            = std::map<vertex_type,
+                                               int,
+                                               component::support::vertex_less<id_type>>;
+
+        //------------------------------------------------------------------------------
+        /// @brief Delta log entry of a single vertex.
+        //------------------------------------------------------------------------------
+        struct delta_arc
+        {
+            /// @brief Arc end vertex.
+            int target;
+
+            /// @brief Arc weight.
+            int weight;
+
+            /// @brief Arc capacity.
+            int capacity;
+
+            /// @brief True for tombstone, false for inserted arc.
+            bool removed;
+
+            /// @brief Inserted arc was removed before reaching base.
+            bool cancelled;
+        };
+
+        using bucket_type           = std::vector<delta_arc>;
+        using delta_type            = std::vector<bucket_type>;
+
+        //------------------------------------------------------------------------------
+        /// @brief Removal bookkeeping of a vertex in active delta.
+        ///
+        /// Built on first removal at the vertex, then kept up with the bucket
+        /// incrementally, so each removal is O(1) expected.
+        //------------------------------------------------------------------------------
+        struct removal_index
+        {
+            /// @brief Bucket entries accounted for.
+            std::size_t scanned = 0;
+
+            /// @brief Positions of live inserted arcs, by arc key.
+            std::unordered_map<std::uint64_t, std::vector<int>> inserted;
+
+            /// @brief Arcs of older layers not hidden yet, by arc key.
+            std::unordered_map<std::uint64_t, int> visible;
+        };
+
+    public:
+
+        using handle_type           = int;
+
+    public:
+
+        //------------------------------------------------------------------------------
+        /// @brief Default constructor.
+        ///
+        /// Creates an empty graph.
+        //------------------------------------------------------------------------------
+        DynamicList();
+
+        //------------------------------------------------------------------------------
+        /// @brief Snapshot constructor.
+        ///
+        /// @param[in] graph Source graph used as initial base.
+        ///
+        //------------------------------------------------------------------------------
+        template<class graph_type>
+        explicit DynamicList(const graph_type& graph);
+
+        //------------------------------------------------------------------------------
+        /// @brief Destructor.
+        ///
+        /// Waits for running compaction.
+        //------------------------------------------------------------------------------
+        ~DynamicList();
+
+        DynamicList(const DynamicList&) = delete;
+
+        DynamicList&
+        operator=(const DynamicList&) = delete;
+
+        //------------------------------------------------------------------------------
+        /// @brief Add vertex.
+        ///
+        /// @param[in] vertex Vertex.
+        ///
+        //------------------------------------------------------------------------------
+        void
+        AddVertex(const vertex_type& vertex);
+
+        //------------------------------------------------------------------------------
+        /// @brief Get vertex by handle.
+        ///
+        /// @param[in] handle Vertex handle.
+        ///
+        /// @return Vertex.
+        ///
+        //------------------------------------------------------------------------------
+        const vertex_type&
+        GetVertex(handle_type handle) const;
+
+        //------------------------------------------------------------------------------
+        /// @brief Get handle of a vertex.
+        ///
+        /// @param[in] vertex Input vertex.
+        ///
+        /// @return Vertex handle.
+        ///
+        //------------------------------------------------------------------------------
+        handle_type
+        GetHandle(const vertex_type& vertex) const;
+
+        //------------------------------------------------------------------------------
+        /// @brief Check if graph contains vertex.
+        ///
+        /// @param[in] vertex Input vertex.
+        ///
+        /// @retval True If vertex is present.
+        /// @retval False Otherwise.
+        ///
+        //------------------------------------------------------------------------------
+        bool
+        ContainsVertex(const vertex_type& vertex) const;
+
+        //------------------------------------------------------------------------------
+        /// @brief Append edge insertion to delta.
+        ///
+        /// @param[in] vertex1 First vertex.
+        ///
+        /// @param[in] vertex2 Second vertex.
+        ///
+        /// @param[in] direction How vertices are connected.
+        ///
+        /// @param[in] weight Edge weight.
+        ///
+        /// @param[in] capacity Edge flow capacity.
+        ///
+        //------------------------------------------------------------------------------
+        void
+        AddEdge(const vertex_type& vertex1,
+                const vertex_type& vertex2,
+                component::traits::edge_direction direction = component::traits::edge_direction::none,
+                int weight = 0,
+                int capacity = 0);
+
+        //------------------------------------------------------------------------------
+        /// @brief Append edge removal to delta.
+        ///
+        /// Removes one edge with given vertices and weight, if present.
+        ///
+        /// @param[in] vertex1 First vertex.
+        ///
+        /// @param[in] vertex2 Second vertex.
+        ///
+        /// @param[in] direction How vertices are connected.
+        ///
+        /// @param[in] weight Edge weight.
+        ///
+        //------------------------------------------------------------------------------
+        void
+        RemoveEdge(const vertex_type& vertex1,
+                   const vertex_type& vertex2,
+                   component::traits::edge_direction direction = component::traits::edge_direction::none,
+                   int weight = 0);
+
+        //------------------------------------------------------------------------------
+        /// @brief Visit outgoing arcs of a vertex.
+        ///
+        /// Visitor runs under shared lock and must not modify the graph.
+        ///
+        /// @param[in] handle Vertex handle.
+        ///
+        /// @param[in] visitor Callable: visitor(target, weight, capacity).
+        ///
+        //------------------------------------------------------------------------------
+        template<typename visitor_type>
+        void
+        ForEachNeighbour(handle_type handle,
+                         visitor_type visitor) const;
+
+        //------------------------------------------------------------------------------
+        /// @brief Number of outgoing arcs of a vertex.
+        ///
+        /// @param[in] handle Vertex handle.
+        ///
+        /// @return Out degree.
+        ///
+        //------------------------------------------------------------------------------
+        int
+        Degree(handle_type handle) const;
+
+        //------------------------------------------------------------------------------
+        /// @brief Number of vertices.
+        ///
+        /// @return Vertex count.
+        ///
+        //------------------------------------------------------------------------------
+        int
+        Size() const;
+
+        //------------------------------------------------------------------------------
+        /// @brief Number of delta entries not merged into base yet.
+        ///
+        /// @return Delta entry count.
+        ///
+        //------------------------------------------------------------------------------
+        std::size_t
+        DeltaSize() const;
+
+        //------------------------------------------------------------------------------
+        /// @brief Set delta size triggering background compaction.
+        ///
+        /// @param[in] threshold Delta entry count, 0 disables automatic compaction.
+        ///
+        //------------------------------------------------------------------------------
+        void
+        SetCompactionThreshold(std::size_t threshold);
+
+        //------------------------------------------------------------------------------
+        /// @brief Merge whole delta into base synchronously.
+        ///
+        //------------------------------------------------------------------------------
+        void
+        Compact();
+
+        //------------------------------------------------------------------------------
+        /// @brief Compact and return read-optimized snapshot.
+        ///
+        /// Snapshot stays valid and unchanged after further mutations.
+        ///
+        /// @return Current base.
+        ///
+        //------------------------------------------------------------------------------
+        base_ptr
+        Snapshot();
+
+        //------------------------------------------------------------------------------
+        /// @brief Heap memory used by the graph.
+        ///
+        /// Base is reported as vertices/edge containers/edges, delta as
+        /// auxiliary.
+        ///
+        /// @return Memory usage report.
+        ///
+        //------------------------------------------------------------------------------
+        utility::memory_usage
+        MemoryUsage() const;
+
+
+    private:
+
+        //------------------------------------------------------------------------------
+        /// @brief Tombstone matcher.
+        ///
+        /// Each tombstone of a bucket hides exactly one matching arc of older
+        /// layers. Tombstones are counted per arc key once, sorted, so each
+        /// check is a binary search.
+        //------------------------------------------------------------------------------
+        class tombstone_filter
+        {
+        public:
+
+            explicit tombstone_filter(const bucket_type* bucket);
+
+            //------------------------------------------------------------------------------
+            /// @brief Consume matching tombstone.
+            ///
+            /// @retval True If arc is hidden by a tombstone.
+            /// @retval False Otherwise.
+            ///
+            //------------------------------------------------------------------------------
+            bool
+            hides(int target,
+                  int weight);
+
+        private:
+
+            /// @brief Arc keys of tombstones and unmatched tombstone counts, sorted.
+            std::vector<std::pair<std::uint64_t, int>> tombstones_;
+        };
+
+        //------------------------------------------------------------------------------
+        /// @brief Arc key of target and weight.
+        ///
+        //------------------------------------------------------------------------------
+        static std::uint64_t
+        ArcKey(int target,
+               int weight);
+
+        //------------------------------------------------------------------------------
+        /// @brief Removal index of a vertex, brought up to date with its bucket.
+        ///
+        /// Caller must hold exclusive lock.
+        ///
+        //------------------------------------------------------------------------------
+        removal_index&
+        Removals(handle_type source);
+
+        //------------------------------------------------------------------------------
+        /// @brief Visit arcs of a vertex in base and frozen delta.
+        ///
+        /// Caller must hold a lock.
+        ///
+        //------------------------------------------------------------------------------
+        template<typename visitor_type>
+        void
+        VisitMerged(const base_type& base,
+                    const delta_type& frozen,
+                    handle_type handle,
+                    visitor_type visitor) const;
+
+        //------------------------------------------------------------------------------
+        /// @brief Visit arcs of a vertex in all layers.
+        ///
+        /// Caller must hold a lock.
+        ///
+        //------------------------------------------------------------------------------
+        template<typename visitor_type>
+        void
+        VisitAll(handle_type handle,
+                 visitor_type visitor) const;
+
+        //------------------------------------------------------------------------------
+        /// @brief Append single arc removal.
+        ///
+        /// Caller must hold exclusive lock.
+        ///
+        //------------------------------------------------------------------------------
+        void
+        RemoveArc(handle_type source,
+                  handle_type target,
+                  int weight);
+
+        //------------------------------------------------------------------------------
+        /// @brief Freeze active delta and start background merge.
+        ///
+        /// Caller must hold exclusive lock.
+        ///
+        //------------------------------------------------------------------------------
+        void
+        StartCompaction();
+
+        //------------------------------------------------------------------------------
+        /// @brief Move active delta to frozen one.
+        ///
+        /// Caller must hold exclusive lock, no compaction may be running.
+        ///
+        //------------------------------------------------------------------------------
+        void
+        FreezeActive();
+
+        //------------------------------------------------------------------------------
+        /// @brief Merge frozen delta into a new base.
+        ///
+        //------------------------------------------------------------------------------
+        void
+        MergeFrozen();
+
+        //------------------------------------------------------------------------------
+        /// @brief Wait for background compaction thread.
+        ///
+        //------------------------------------------------------------------------------
+        void
+        JoinCompaction();
+
+
+    private:
+
+        /// @brief Guards all state below.
+        mutable std::shared_mutex mutex_;
+
+        /// @brief Handle -> vertex (deque keeps references stable).
+        std::deque<vertex_type> vertices_;
+
+        /// @brief Vertex -> handle.
+        index_type index_;
+
+        /// @brief Read-optimized base.
+        base_ptr base_;
+
+        /// @brief Delta being merged by compaction thread (immutable meanwhile).
+        delta_type frozen_;
+
+        /// @brief Delta receiving new mutations.
+        delta_type active_;
+
+        /// @brief Removal indices of active delta vertices, by handle.
+        std::unordered_map<int, removal_index> removals_;
+
+        /// @brief Entries in active delta.
+        std::size_t activeSize_;
+
+        /// @brief Entries in frozen delta.
+        std::size_t frozenSize_;
+
+        /// @brief Automatic compaction threshold.
+        std::size_t threshold_;
+
+        /// @brief Compaction is running.
+        bool compacting_;
+
+        /// @brief Signals compaction end.
+        std::condition_variable_any compacted_;
+
+        /// @brief Background compaction thread.
+        std::thread compactor_;
+    };
+
+} // namespace implementation
+
+
+
+//------------------------------------------------------------------------------
+// Global references
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Variable definitions
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Function definitions
+//------------------------------------------------------------------------------
+namespace implementation
+{
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type>
+    DynamicList<id_type>::DynamicList() : base_(std::make_shared<const base_type>()),
+                                          activeSize_(0),
+                                          frozenSize_(0),
+                                          threshold_(1 << 20),
+                                          compacting_(false)
+    {   }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type>
+    template<class graph_type>
+    DynamicList<id_type>::DynamicList(const graph_type& graph) :
+                            base_(std::make_shared<const base_type>(graph)),
+                            activeSize_(0),
+                            frozenSize_(0),
+                            threshold_(1 << 20),
+                            compacting_(false)
+    {
+        for (int handle = 0; handle < base_->Size(); ++handle)
+        {
+            vertices_.push_back(base_->GetVertex(handle));
+            index_.emplace(vertices_.back(), handle);
+        }
+
+        active_.resize(vertices_.size());
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type>
+    DynamicList<id_type>::~DynamicList()
+    {
+        JoinCompaction();
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  Existing vertex is left untouched.
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type>
+    void
+    DynamicList<id_type>::AddVertex(
+            const typename DynamicList<id_type>::vertex_type& vertex)
+    {
+        std::unique_lock<std::shared_mutex> lock(mutex_);
+
+        if (index_.find(vertex) != index_.end())
+        {
+            return;
+        }
+
+        vertices_.push_back(vertex);
+        index_.emplace(vertex, static_cast<int>(vertices_.size()) - 1);
+        active_.emplace_back();
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type>
+    const typename DynamicList<id_type>::vertex_type&
+    DynamicList<id_type>::GetVertex(
+            typename DynamicList<id_type>::handle_type handle) const
+    {
+        std::shared_lock<std::shared_mutex> lock(mutex_);
+
+        return vertices_.at(handle);
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type>
+    typename DynamicList<id_type>::handle_type
+    DynamicList<id_type>::GetHandle(
+            const typename DynamicList<id_type>::vertex_type& vertex) const
+    {
+        std::shared_lock<std::shared_mutex> lock(mutex_);
+
+        auto candidate = index_.find(vertex);
+
+        if (candidate != index_.end())
+        {
+            return candidate->second;
+        }
+
+        throw std::out_of_range("Graph contains no such vertex");
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type>
+    bool
+    DynamicList<id_type>::ContainsVertex(
+            const typename DynamicList<id_type>::vertex_type& vertex) const
+    {
+        std::shared_lock<std::shared_mutex> lock(mutex_);
+
+        return index_.find(vertex) != index_.end();
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  Undirected edge is appended as two arcs, like in AdjacencyList.
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type>
+    void
+    DynamicList<id_type>::AddEdge(
+            const typename DynamicList<id_type>::vertex_type& vertex1,
+            const typename DynamicList<id_type>::vertex_type& vertex2,
+            component::traits::edge_direction direction,
+            int weight,
+            int capacity)
+    {
+        std::unique_lock<std::shared_mutex> lock(mutex_);
+
+        int source = index_.at(vertex1);
+        int target = index_.at(vertex2);
+
+        active_[source].push_back({target, weight, capacity, false, false});
+        ++activeSize_;
+
+        if (direction == component::traits::edge_direction::none)
+        {
+            active_[target].push_back({source, weight, capacity, false, false});
+            ++activeSize_;
+        }
+
+        if (threshold_ != 0 && activeSize_ >= threshold_ && !compacting_)
+        {
+            StartCompaction();
+        }
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type>
+    void
+    DynamicList<id_type>::RemoveEdge(
+            const typename DynamicList<id_type>::vertex_type& vertex1,
+            const typename DynamicList<id_type>::vertex_type& vertex2,
+            component::traits::edge_direction direction,
+            int weight)
+    {
+        std::unique_lock<std::shared_mutex> lock(mutex_);
+
+        int source = index_.at(vertex1);
+        int target = index_.at(vertex2);
+
+        RemoveArc(source, target, weight);
+
+        if (direction == component::traits::edge_direction::none)
+        {
+            RemoveArc(target, source, weight);
+        }
+
+        if (threshold_ != 0 && activeSize_ >= threshold_ && !compacting_)
+        {
+            StartCompaction();
+        }
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type>
+    template<typename visitor_type>
+    void
+    DynamicList<id_type>::ForEachNeighbour(
+            typename DynamicList<id_type>::handle_type handle,
+            visitor_type visitor) const
+    {
+        std::shared_lock<std::shared_mutex> lock(mutex_);
+
+        VisitAll(handle, visitor);
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type>
+    int
+    DynamicList<id_type>::Degree(
+            typename DynamicList<id_type>::handle_type handle) const
+    {
+        int degree = 0;
+
+        ForEachNeighbour(handle,
+            [&degree](int, int, int)
+            {
+                ++degree;
+            });
+
+        return degree;
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type>
+    int
+    DynamicList<id_type>::Size() const
+    {
+        std::shared_lock<std::shared_mutex> lock(mutex_);
+
+        return static_cast<int>(vertices_.size());
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type>
+    std::size_t
+    DynamicList<id_type>::DeltaSize() const
+    {
+        std::shared_lock<std::shared_mutex> lock(mutex_);
+
+        return activeSize_ + frozenSize_;
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type>
+    void
+    DynamicList<id_type>::SetCompactionThreshold(std::size_t threshold)
+    {
+        std::unique_lock<std::shared_mutex> lock(mutex_);
+
+        threshold_ = threshold;
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  Wait for running background merge first, then merge the rest in the
+    //  calling thread.
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type>
+    void
+    DynamicList<id_type>::Compact()
+    {
+        {
+            std::unique_lock<std::shared_mutex> lock(mutex_);
+            compacted_.wait(lock, [this] { return !compacting_; });
+
+            if (activeSize_ == 0)
+            {
+                return;
+            }
+
+            FreezeActive();
+        }
+
+        MergeFrozen();
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type>
+    typename DynamicList<id_type>::base_ptr
+    DynamicList<id_type>::Snapshot()
+    {
+        Compact();
+
+        std::shared_lock<std::shared_mutex> lock(mutex_);
+
+        return base_;
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type>
+    utility::memory_usage
+    DynamicList<id_type>::MemoryUsage() const
+    {
+        std::shared_lock<std::shared_mutex> lock(mutex_);
+
+        utility::memory_usage usage = base_->MemoryUsage();
+
+        for (const auto* delta : {&active_, &frozen_})
+        {
+            usage.auxiliary += utility::vector_bytes(*delta);
+            for (const auto& bucket : *delta)
+            {
+                usage.auxiliary += utility::vector_bytes(bucket);
+            }
+        }
+
+        return usage;
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type>
+    DynamicList<id_type>::tombstone_filter::tombstone_filter(
+            const typename DynamicList<id_type>::bucket_type* bucket)
+    {
+        if (bucket == nullptr)
+        {
+            return;
+        }
+
+        for (const auto& entry : *bucket)
+        {
+            if (entry.removed)
+            {
+                tombstones_.emplace_back(ArcKey(entry.target, entry.weight), 1);
+            }
+        }
+
+        if (tombstones_.empty())
+        {
+            return;
+        }
+
+        // merge equal keys into counts
+        std::sort(tombstones_.begin(), tombstones_.end());
+        std::size_t unique = 0;
+        for (std::size_t i = 1; i < tombstones_.size(); ++i)
+        {
+            if (tombstones_[i].first == tombstones_[unique].first)
+            {
+                ++tombstones_[unique].second;
+            }
+            else
+            {
+                tombstones_[++unique] = tombstones_[i];
+            }
+        }
+        tombstones_.resize(unique + 1);
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type>
+    bool
+    DynamicList<id_type>::tombstone_filter::hides(int target,
+                                                  int weight)
+    {
+        if (tombstones_.empty())
+        {
+            return false;
+        }
+
+        std::uint64_t key = ArcKey(target, weight);
+        auto match = std::lower_bound(tombstones_.begin(), tombstones_.end(),
+                                      std::make_pair(key, 0));
+
+        if (match != tombstones_.end() && match->first == key && match->second > 0)
+        {
+            --match->second;
+            return true;
+        }
+
+        return false;
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type>
+    std::uint64_t
+    DynamicList<id_type>::ArcKey(int target,
+                                 int weight)
+    {
+        return (static_cast<std::uint64_t>(static_cast<std::uint32_t>(target)) << 32) |
+               static_cast<std::uint32_t>(weight);
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  Base arcs hidden by frozen tombstones are skipped, followed by live
+    //  frozen insertions.
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type>
+    template<typename visitor_type>
+    void
+    DynamicList<id_type>::VisitMerged(
+            const typename DynamicList<id_type>::base_type& base,
+            const typename DynamicList<id_type>::delta_type& frozen,
+            typename DynamicList<id_type>::handle_type handle,
+            visitor_type visitor) const
+    {
+        const bucket_type* bucket = (handle < static_cast<int>(frozen.size())) ?
+                                        &frozen[handle] : nullptr;
+
+        if (handle < base.Size())
+        {
+            // fast path: no delta for this vertex
+            if (bucket == nullptr || bucket->empty())
+            {
+                for (int arc = base.Begin(handle); arc < base.End(handle); ++arc)
+                {
+                    visitor(base.Target(arc), base.Weight(arc), base.Capacity(arc));
+                }
+                return;
+            }
+
+            tombstone_filter filter(bucket);
+            for (int arc = base.Begin(handle); arc < base.End(handle); ++arc)
+            {
+                if (!filter.hides(base.Target(arc), base.Weight(arc)))
+                {
+                    visitor(base.Target(arc), base.Weight(arc), base.Capacity(arc));
+                }
+            }
+        }
+
+        if (bucket != nullptr)
+        {
+            for (const auto& entry : *bucket)
+            {
+                if (!entry.removed && !entry.cancelled)
+                {
+                    visitor(entry.target, entry.weight, entry.capacity);
+                }
+            }
+        }
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  Active tombstones hide arcs of base and frozen delta.
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type>
+    template<typename visitor_type>
+    void
+    DynamicList<id_type>::VisitAll(
+            typename DynamicList<id_type>::handle_type handle,
+            visitor_type visitor) const
+    {
+        const bucket_type& bucket = active_[handle];
+
+        if (bucket.empty())
+        {
+            VisitMerged(*base_, frozen_, handle, visitor);
+            return;
+        }
+
+        tombstone_filter filter(&bucket);
+        VisitMerged(*base_, frozen_, handle,
+            [&filter, &visitor](int target, int weight, int capacity)
+            {
+                if (!filter.hides(target, weight))
+                {
+                    visitor(target, weight, capacity);
+                }
+            });
+
+        for (const auto& entry : bucket)
+        {
+            if (!entry.removed && !entry.cancelled)
+            {
+                visitor(entry.target, entry.weight, entry.capacity);
+            }
+        }
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  Older layers of the vertex are counted once, when its index is created;
+    //  bucket entries appended since the last call are then accounted for:
+    //  insertions are recorded, tombstones hide one visible arc each.
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type>
+    typename DynamicList<id_type>::removal_index&
+    DynamicList<id_type>::Removals(
+            typename DynamicList<id_type>::handle_type source)
+    {
+        auto candidate = removals_.find(source);
+
+        if (candidate == removals_.end())
+        {
+            candidate = removals_.emplace(source, removal_index()).first;
+            auto& visible = candidate->second.visible;
+            VisitMerged(*base_, frozen_, source,
+                [&visible](int target, int weight, int)
+                {
+                    ++visible[ArcKey(target, weight)];
+                });
+        }
+
+        removal_index& removals = candidate->second;
+        const bucket_type& bucket = active_[source];
+
+        for (; removals.scanned < bucket.size(); ++removals.scanned)
+        {
+            const auto& entry = bucket[removals.scanned];
+            std::uint64_t key = ArcKey(entry.target, entry.weight);
+            if (entry.removed)
+            {
+                --removals.visible[key];
+            }
+            else if (!entry.cancelled)
+            {
+                removals.inserted[key].push_back(static_cast<int>(removals.scanned));
+            }
+        }
+
+        return removals;
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  Arc inserted into active delta is cancelled in place, latest first; arc
+    //  of older layers gets a tombstone, but only if it is still visible.
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type>
+    void
+    DynamicList<id_type>::RemoveArc(
+            typename DynamicList<id_type>::handle_type source,
+            typename DynamicList<id_type>::handle_type target,
+            int weight)
+    {
+        removal_index& removals = Removals(source);
+        std::uint64_t key = ArcKey(target, weight);
+        auto& bucket = active_[source];
+
+        auto inserted = removals.inserted.find(key);
+        if (inserted != removals.inserted.end() && !inserted->second.empty())
+        {
+            bucket[inserted->second.back()].cancelled = true;
+            inserted->second.pop_back();
+            return;
+        }
+
+        auto visible = removals.visible.find(key);
+        if (visible != removals.visible.end() && visible->second > 0)
+        {
+            bucket.push_back({target, weight, 0, true, false});
+            ++activeSize_;
+        }
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type>
+    void
+    DynamicList<id_type>::StartCompaction()
+    {
+        // previous thread has already finished (compacting_ is false)
+        if (compactor_.joinable())
+        {
+            compactor_.join();
+        }
+
+        FreezeActive();
+
+        compactor_ = std::thread(&DynamicList<id_type>::MergeFrozen, this);
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type>
+    void
+    DynamicList<id_type>::FreezeActive()
+    {
+        frozen_.swap(active_);
+        active_.assign(vertices_.size(), bucket_type());
+        removals_.clear();
+        frozenSize_ = activeSize_;
+        activeSize_ = 0;
+        compacting_ = true;
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  Base and frozen delta are immutable while compacting_ is set, so the
+    //  merge itself runs without lock. Only vertex copies and the final swap
+    //  are done under lock.
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type>
+    void
+    DynamicList<id_type>::MergeFrozen()
+    {
+        base_ptr base;
+        std::vector<vertex_type> vertices;
+        {
+            std::shared_lock<std::shared_mutex> lock(mutex_);
+            base = base_;
+            vertices.assign(vertices_.begin(), vertices_.end());
+        }
+
+        int vertexCount = static_cast<int>(vertices.size());
+        std::vector<int> offsets;
+        std::vector<int> targets;
+        std::vector<int> weights;
+        std::vector<int> capacities;
+
+        offsets.reserve(vertexCount + 1);
+        targets.reserve(base->EdgeCount() + frozenSize_);
+        weights.reserve(base->EdgeCount() + frozenSize_);
+        capacities.reserve(base->EdgeCount() + frozenSize_);
+
+        offsets.push_back(0);
+        for (int handle = 0; handle < vertexCount; ++handle)
+        {
+            VisitMerged(*base, frozen_, handle,
+                [&targets, &weights, &capacities](int target, int weight, int capacity)
+                {
+                    targets.push_back(target);
+                    weights.push_back(weight);
+                    capacities.push_back(capacity);
+                });
+            offsets.push_back(static_cast<int>(targets.size()));
+        }
+
+        auto merged = std::make_shared<const base_type>(std::move(vertices),
+                                                        std::move(offsets),
+                                                        std::move(targets),
+                                                        std::move(weights),
+                                                        std::move(capacities));
+
+        {
+            std::unique_lock<std::shared_mutex> lock(mutex_);
+            base_ = merged;
+            frozen_.clear();
+            frozenSize_ = 0;
+            compacting_ = false;
+        }
+
+        compacted_.notify_all();
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  Thread object is only replaced under exclusive lock in StartCompaction,
+    //  which is never called concurrently with destructor.
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type>
+    void
+    DynamicList<id_type>::JoinCompaction()
+    {
+        if (compactor_.joinable())
+        {
+            compactor_.join();
+        }
+    }
+
+} //    namespace implementation
+
+
+
+#endif // GRAPH_LIB_IMPLEMENTATION_DYNAMIC_LIST_HPP
+//==============================================================================
+// End of dynamic-list.hpp
+// (note: the newline at the end of the file is intentional)
+//==============================================================================
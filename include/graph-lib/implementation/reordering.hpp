@@ -0,0 +1,304 @@
+//==============================================================================
+///
+/// @file reordering.hpp
+///
+/// @brief Locality-improving vertex reordering.
+///
+/// Vertex order of graph::Graph is defined by std::map id ordering, which has
+/// nothing in common with graph structure. Reordering computes a permutation
+/// of CompressedList handles placing vertices, that are visited together,
+/// close to each other in memory, and rebuilds the snapshot in that order.
+/// Supported orders:
+///     - degree - descending out degree, hubs are packed together.
+///     - bfs - breadth first discovery order, component by component.
+///     - reverse Cuthill-McKee - bandwidth reducing order, each component is
+///     started from a minimum degree vertex and neighbours are visited in
+///     ascending degree order.
+/// Only outgoing arcs are followed; undirected edges are stored in both
+/// directions, so for undirected graphs the orders are the classic ones.
+/// Algorithms built from a snapshot (bfs, dfs, flow engines, partitioner, ...)
+/// accept a reordered one as is; their results are indexed by its handles,
+/// and GetVertex() maps a handle back to the graph vertex.
+///
+/// The documentation is available on the following website:
+/// <website>
+///
+/// Support email: <email>
+///
+//==============================================================================
+
+//==============================================================================
+// Include only once
+//
+#ifndef GRAPH_LIB_IMPLEMENTATION_REORDERING_HPP
+#define GRAPH_LIB_IMPLEMENTATION_REORDERING_HPP
+
+
+//------------------------------------------------------------------------------
+// Include files
+//------------------------------------------------------------------------------
+// System
+// e.g.: #include <iostream>        // stdout
+#include <vector>
+#include <numeric>                  // std::iota
+#include <algorithm>                // std::stable_sort, std::reverse
+
+// Project
+// e.g.: #include "IncludeFile.h"   // MyType_t
+#include "graph-lib/implementation/compressed-list.hpp"
+
+
+//------------------------------------------------------------------------------
+// Constants
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Macros
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Forward declarations
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Data types
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+/// @brief Implementation related classes and functions.
+//------------------------------------------------------------------------------
+namespace implementation
+{
+    //------------------------------------------------------------------------------
+    /// @brief Implementation traits.
+    //------------------------------------------------------------------------------
+    namespace traits
+    {
+        //------------------------------------------------------------------------------
+        /// @brief Encapsulates vertex reordering strategies.
+        //------------------------------------------------------------------------------
+        enum class vertex_order
+        {
+            /// @brief Keep source order.
+            natural,
+            /// @brief Descending out degree.
+            degree,
+            /// @brief Breadth first discovery order.
+            bfs,
+            /// @brief Reverse Cuthill-McKee order.
+            reverse_cuthill_mckee
+        };
+
+    } // namespace traits
+
+} // namespace implementation
+
+
+//------------------------------------------------------------------------------
+// Function declarations
+//------------------------------------------------------------------------------
+namespace implementation
+{
+    //------------------------------------------------------------------------------
+    /// @brief Compute permutation of snapshot handles.
+    ///
+    /// @param[in] list Input snapshot.
+    ///
+    /// @param[in] strategy Reordering strategy.
+    ///
+    /// @return Permutation: result[newHandle] = handle in list.
+    ///
+    //------------------------------------------------------------------------------
+    template<class id_type>
+    std::vector<int>
+    compute_order(const CompressedList<id_type>& list,
+                  traits::vertex_order strategy);
+
+    //------------------------------------------------------------------------------
+    /// @brief Rebuild snapshot in the order computed by given strategy.
+    ///
+    /// @param[in] list Input snapshot.
+    ///
+    /// @param[in] strategy Reordering strategy.
+    ///
+    /// @return Reordered snapshot.
+    ///
+    //------------------------------------------------------------------------------
+    template<class id_type>
+    CompressedList<id_type>
+    reorder(const CompressedList<id_type>& list,
+            traits::vertex_order strategy);
+
+} // namespace implementation
+
+
+//------------------------------------------------------------------------------
+// Variable definitions
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Function definitions
+//------------------------------------------------------------------------------
+namespace implementation
+{
+    //------------------------------------------------------------------------------
+    /// @brief Reordering helpers.
+    //------------------------------------------------------------------------------
+    namespace detail
+    {
+        //------------------------------------------------------------------------------
+        //
+        //  Stable sort keeps source order among vertices with equal degree.
+        //
+        //------------------------------------------------------------------------------
+        template<class id_type>
+        std::vector<int>
+        degree_order(const CompressedList<id_type>& list)
+        {
+            std::vector<int> order(list.Size());
+            std::iota(order.begin(), order.end(), 0);
+
+            std::stable_sort(order.begin(), order.end(),
+                [&list](int lhs, int rhs)
+                {
+                    return list.Degree(lhs) > list.Degree(rhs);
+                });
+
+            return order;
+        }
+
+        //------------------------------------------------------------------------------
+        //
+        //  The order vector itself is used as BFS queue: vertices are appended
+        //  when discovered and head index walks over it.
+        //  Component roots are picked by rootLess, neighbours of a vertex are
+        //  appended in the order defined by neighbourLess (if any).
+        //
+        //------------------------------------------------------------------------------
+        template<class id_type,
+                 typename root_compare,
+                 typename neighbour_compare>
+        std::vector<int>
+        breadth_first_order(const CompressedList<id_type>& list,
+                            root_compare rootLess,
+                            neighbour_compare neighbourLess,
+                            bool sortNeighbours)
+        {
+            std::vector<int> order;
+            order.reserve(list.Size());
+            std::vector<char> discovered(list.Size(), 0);
+
+            // component roots candidates
+            std::vector<int> roots(list.Size());
+            std::iota(roots.begin(), roots.end(), 0);
+            std::stable_sort(roots.begin(), roots.end(), rootLess);
+
+            std::vector<int> children;
+            for (auto root : roots)
+            {
+                if (discovered[root])
+                {
+                    continue;
+                }
+
+                discovered[root] = 1;
+                order.push_back(root);
+
+                for (std::size_t head = order.size() - 1; head < order.size(); ++head)
+                {
+                    int current = order[head];
+
+                    children.clear();
+                    for (int arc = list.Begin(current); arc < list.End(current); ++arc)
+                    {
+                        int target = list.Target(arc);
+                        if (!discovered[target])
+                        {
+                            discovered[target] = 1;
+                            children.push_back(target);
+                        }
+                    }
+
+                    if (sortNeighbours)
+                    {
+                        std::stable_sort(children.begin(), children.end(), neighbourLess);
+                    }
+
+                    order.insert(order.end(), children.begin(), children.end());
+                }
+            }
+
+            return order;
+        }
+
+    } // namespace detail
+
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type>
+    std::vector<int>
+    compute_order(const CompressedList<id_type>& list,
+                  traits::vertex_order strategy)
+    {
+        auto byHandle = [](int lhs, int rhs) { return lhs < rhs; };
+        auto byDegree = [&list](int lhs, int rhs) { return list.Degree(lhs) < list.Degree(rhs); };
+
+        switch (strategy)
+        {
+            case traits::vertex_order::degree:
+                return detail::degree_order(list);
+
+            case traits::vertex_order::bfs:
+                return detail::breadth_first_order(list, byHandle, byHandle, false);
+
+            case traits::vertex_order::reverse_cuthill_mckee:
+            {
+                auto order = detail::breadth_first_order(list, byDegree, byDegree, true);
+                std::reverse(order.begin(), order.end());
+                return order;
+            }
+
+            case traits::vertex_order::natural:
+            default:
+            {
+                std::vector<int> order(list.Size());
+                std::iota(order.begin(), order.end(), 0);
+                return order;
+            }
+        }
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class id_type>
+    CompressedList<id_type>
+    reorder(const CompressedList<id_type>& list,
+            traits::vertex_order strategy)
+    {
+        return CompressedList<id_type>(list, compute_order(list, strategy));
+    }
+
+} //    namespace implementation
+
+
+
+#endif // GRAPH_LIB_IMPLEMENTATION_REORDERING_HPP
+//==============================================================================
+// End of reordering.hpp
+// (note: the newline at the end of the file is intentional)
+//==============================================================================
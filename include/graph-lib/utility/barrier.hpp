@@ -0,0 +1,158 @@
+//==============================================================================
+///
+/// @file barrier.hpp
+///
+/// @brief Reusable thread barrier.
+///
+/// C++17 has no std::barrier. Threads of level synchronous algorithms meet at
+/// the barrier between phases; the barrier resets itself once all threads
+/// arrived, so one object serves every phase of a run.
+///
+/// The documentation is available on the following website:
+/// <website>
+///
+/// Support email: <email>
+///
+//==============================================================================
+
+//==============================================================================
+// Include only once
+//
+#ifndef GRAPH_LIB_UTILITY_BARRIER_HPP
+#define GRAPH_LIB_UTILITY_BARRIER_HPP
+
+
+//------------------------------------------------------------------------------
+// Include files
+//------------------------------------------------------------------------------
+// System
+// e.g.: #include <iostream>        // stdout
+#include <mutex>
+#include <condition_variable>
+
+// Project
+// e.g.: #include "IncludeFile.h"   // MyType_t
+
+
+//------------------------------------------------------------------------------
+// Global references
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Constants
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Macros
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Forward declarations
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Data types
+//------------------------------------------------------------------------------
+namespace utility
+{
+    //------------------------------------------------------------------------------
+    /// @brief Reusable thread barrier.
+    ///
+    /// Memory writes made before arrive_and_wait() are visible to all threads
+    /// after it returns.
+    //------------------------------------------------------------------------------
+    class barrier
+    {
+    public:
+
+        //------------------------------------------------------------------------------
+        /// @brief Value constructor.
+        ///
+        /// @param[in] count Number of participating threads.
+        ///
+        //------------------------------------------------------------------------------
+        explicit barrier(int count) : count_(count),
+                                      arrived_(0),
+                                      generation_(0)
+        {   }
+
+        barrier(const barrier&) = delete;
+
+        barrier&
+        operator=(const barrier&) = delete;
+
+        //------------------------------------------------------------------------------
+        /// @brief Block until all threads arrive.
+        ///
+        //------------------------------------------------------------------------------
+        void
+        arrive_and_wait()
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            unsigned long generation = generation_;
+
+            if (++arrived_ == count_)
+            {
+                arrived_ = 0;
+                ++generation_;
+                released_.notify_all();
+            }
+            else
+            {
+                released_.wait(lock, [this, generation] { return generation != generation_; });
+            }
+        }
+
+    private:
+
+        /// @brief Number of participating threads.
+        const int count_;
+
+        /// @brief Threads arrived in current generation.
+        int arrived_;
+
+        /// @brief Completed phases.
+        unsigned long generation_;
+
+        /// @brief Protects counters.
+        std::mutex mutex_;
+
+        /// @brief Signals phase completion.
+        std::condition_variable released_;
+    };
+
+} // namespace utility
+
+
+//------------------------------------------------------------------------------
+// Function declarations
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Variable definitions
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Function definitions
+//------------------------------------------------------------------------------
+// (none)
+
+
+
+#endif // GRAPH_LIB_UTILITY_BARRIER_HPP
+//==============================================================================
+// End of barrier.hpp
+// (note: the newline at the end of the file is intentional)
+//==============================================================================
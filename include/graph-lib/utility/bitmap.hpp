@@ -0,0 +1,285 @@
+//==============================================================================
+///
+/// @file bitmap.hpp
+///
+/// @brief Dense bit set.
+///
+/// Fixed size bit set over 64 bit words, indexed by vertex handle. Used for
+/// traversal frontiers and visited sets, where it is 8 times denser than
+/// std::vector<char> and can be cleared and scanned a word at a time.
+///
+/// The documentation is available on the following website:
+/// <website>
+///
+/// Support email: <email>
+///
+//==============================================================================
+
+//==============================================================================
+// Include only once
+//
+#ifndef GRAPH_LIB_UTILITY_BITMAP_HPP
+#define GRAPH_LIB_UTILITY_BITMAP_HPP
+
+
+//------------------------------------------------------------------------------
+// Include files
+//------------------------------------------------------------------------------
+// System
+// e.g.: #include <iostream>        // stdout
+#include <cstdint>                  // std::uint64_t
+#include <cstddef>                  // std::size_t
+#include <vector>
+#include <algorithm>                // std::fill
+#include <utility>                  // std::swap
+
+// Project
+// e.g.: #include "IncludeFile.h"   // MyType_t
+#include "graph-lib/utility/memory.hpp"     // utility::vector_bytes
+
+
+//------------------------------------------------------------------------------
+// Global references
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Constants
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Macros
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Forward declarations
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Data types
+//------------------------------------------------------------------------------
+namespace utility
+{
+    //------------------------------------------------------------------------------
+    /// @brief Dense bit set.
+    ///
+    //------------------------------------------------------------------------------
+    class bitmap
+    {
+    public:
+
+        using word_type = std::uint64_t;
+
+        /// @brief Bits per word.
+        static constexpr int word_bits = 64;
+
+    public:
+
+        //------------------------------------------------------------------------------
+        /// @brief Value constructor.
+        ///
+        /// @param[in] size Number of bits, all cleared.
+        ///
+        //------------------------------------------------------------------------------
+        explicit bitmap(int size = 0) : size_(size),
+                                        words_((size + word_bits - 1) / word_bits, 0)
+        {   }
+
+        //------------------------------------------------------------------------------
+        /// @brief Set bit.
+        ///
+        /// @param[in] index Bit index.
+        ///
+        //------------------------------------------------------------------------------
+        void
+        set(int index)
+        {
+            words_[index / word_bits] |= word_type(1) << (index % word_bits);
+        }
+
+        //------------------------------------------------------------------------------
+        /// @brief Clear bit.
+        ///
+        /// @param[in] index Bit index.
+        ///
+        //------------------------------------------------------------------------------
+        void
+        reset(int index)
+        {
+            words_[index / word_bits] &= ~(word_type(1) << (index % word_bits));
+        }
+
+        //------------------------------------------------------------------------------
+        /// @brief Test bit.
+        ///
+        /// @param[in] index Bit index.
+        ///
+        /// @return Bit value.
+        ///
+        //------------------------------------------------------------------------------
+        bool
+        test(int index) const
+        {
+            return (words_[index / word_bits] >> (index % word_bits)) & 1;
+        }
+
+        //------------------------------------------------------------------------------
+        /// @brief Clear all bits.
+        ///
+        //------------------------------------------------------------------------------
+        void
+        clear()
+        {
+            std::fill(words_.begin(), words_.end(), 0);
+        }
+
+        //------------------------------------------------------------------------------
+        /// @brief Number of set bits.
+        ///
+        /// @return Set bit count.
+        ///
+        //------------------------------------------------------------------------------
+        int
+        count() const
+        {
+            int result = 0;
+            for (auto word : words_)
+            {
+                result += popcount(word);
+            }
+
+            return result;
+        }
+
+        //------------------------------------------------------------------------------
+        /// @brief Number of bits.
+        ///
+        /// @return Bit count.
+        ///
+        //------------------------------------------------------------------------------
+        int
+        size() const
+        {
+            return size_;
+        }
+
+        //------------------------------------------------------------------------------
+        /// @brief Word storage, for word at a time scans.
+        ///
+        /// @return Words, bit i is bit (i % 64) of word (i / 64).
+        ///
+        //------------------------------------------------------------------------------
+        const std::vector<word_type>&
+        words() const
+        {
+            return words_;
+        }
+
+        //------------------------------------------------------------------------------
+        /// @brief Exchange contents.
+        ///
+        /// @param[in] other Bitmap to swap with.
+        ///
+        //------------------------------------------------------------------------------
+        void
+        swap(bitmap& other)
+        {
+            std::swap(size_, other.size_);
+            words_.swap(other.words_);
+        }
+
+        //------------------------------------------------------------------------------
+        /// @brief Heap bytes used.
+        ///
+        /// @return Byte count.
+        ///
+        //------------------------------------------------------------------------------
+        std::size_t
+        memory() const
+        {
+            return vector_bytes(words_);
+        }
+
+        //------------------------------------------------------------------------------
+        /// @brief Number of set bits in a word.
+        ///
+        /// @param[in] word Input word.
+        ///
+        /// @return Set bit count.
+        ///
+        //------------------------------------------------------------------------------
+        static int
+        popcount(word_type word)
+        {
+#if defined(__GNUC__) || defined(__clang__)
+            return __builtin_popcountll(word);
+#else
+            word = word - ((word >> 1) & 0x5555555555555555ull);
+            word = (word & 0x3333333333333333ull) + ((word >> 2) & 0x3333333333333333ull);
+            word = (word + (word >> 4)) & 0x0f0f0f0f0f0f0f0full;
+            return static_cast<int>((word * 0x0101010101010101ull) >> 56);
+#endif
+        }
+
+        //------------------------------------------------------------------------------
+        /// @brief Index of the lowest set bit.
+        ///
+        /// @param[in] word Input word, must not be 0.
+        ///
+        /// @return Bit index.
+        ///
+        //------------------------------------------------------------------------------
+        static int
+        lowest_bit(word_type word)
+        {
+#if defined(__GNUC__) || defined(__clang__)
+            return __builtin_ctzll(word);
+#else
+            // bits below the lowest set one
+            return popcount((word & (~word + 1)) - 1);
+#endif
+        }
+
+    private:
+
+        /// @brief Number of bits.
+        int size_;
+
+        /// @brief Bit storage.
+        std::vector<word_type> words_;
+    };
+
+} // namespace utility
+
+
+//------------------------------------------------------------------------------
+// Function declarations
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Variable definitions
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Function definitions
+//------------------------------------------------------------------------------
+// (none)
+
+
+
+#endif // GRAPH_LIB_UTILITY_BITMAP_HPP
+//==============================================================================
+// End of bitmap.hpp
+// (note: the newline at the end of the file is intentional)
+//==============================================================================
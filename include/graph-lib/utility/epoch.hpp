@@ -0,0 +1,212 @@
+//==============================================================================
+///
+/// @file epoch.hpp
+///
+/// @brief Epoch stamped marks.
+///
+/// Algorithm workspaces reused across runs must forget marks of the previous
+/// run. Instead of clearing, every slot stores the epoch it was marked in and
+/// counts as marked only while that epoch is current, so reset is a counter
+/// increment. Stamps are cleared for real only when the counter wraps.
+///
+/// The documentation is available on the following website:
+/// <website>
+///
+/// Support email: <email>
+///
+//==============================================================================
+
+//==============================================================================
+// Include only once
+//
+#ifndef GRAPH_LIB_UTILITY_EPOCH_HPP
+#define GRAPH_LIB_UTILITY_EPOCH_HPP
+
+
+//------------------------------------------------------------------------------
+// Include files
+//------------------------------------------------------------------------------
+// System
+// e.g.: #include <iostream>        // stdout
+#include <cstddef>                  // std::size_t
+#include <vector>
+#include <algorithm>                // std::fill
+
+// Project
+// e.g.: #include "IncludeFile.h"   // MyType_t
+#include "graph-lib/utility/memory.hpp"     // utility::vector_bytes
+#include "graph-lib/utility/prefetch.hpp"   // utility::prefetch
+
+
+//------------------------------------------------------------------------------
+// Global references
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Constants
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Macros
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Forward declarations
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Data types
+//------------------------------------------------------------------------------
+namespace utility
+{
+    //------------------------------------------------------------------------------
+    /// @brief Marks with O(1) reset.
+    ///
+    //------------------------------------------------------------------------------
+    class epoch_marks
+    {
+    public:
+
+        //------------------------------------------------------------------------------
+        /// @brief Value constructor.
+        ///
+        /// @param[in] size Number of slots, all unmarked.
+        ///
+        //------------------------------------------------------------------------------
+        explicit epoch_marks(int size = 0) : stamps_(size, 0),
+                                             epoch_(1)
+        {   }
+
+        //------------------------------------------------------------------------------
+        /// @brief Change number of slots, all unmarked.
+        ///
+        /// @param[in] size Number of slots.
+        ///
+        //------------------------------------------------------------------------------
+        void
+        resize(int size)
+        {
+            stamps_.assign(size, 0);
+            epoch_ = 1;
+        }
+
+        //------------------------------------------------------------------------------
+        /// @brief Unmark all slots.
+        ///
+        //------------------------------------------------------------------------------
+        void
+        reset()
+        {
+            if (++epoch_ == 0)
+            {
+                std::fill(stamps_.begin(), stamps_.end(), 0);
+                epoch_ = 1;
+            }
+        }
+
+        //------------------------------------------------------------------------------
+        /// @brief Mark slot.
+        ///
+        /// @param[in] index Slot index.
+        ///
+        //------------------------------------------------------------------------------
+        void
+        set(int index)
+        {
+            stamps_[index] = epoch_;
+        }
+
+        //------------------------------------------------------------------------------
+        /// @brief Test slot.
+        ///
+        /// @param[in] index Slot index.
+        ///
+        /// @return True if slot was marked since last reset.
+        ///
+        //------------------------------------------------------------------------------
+        bool
+        test(int index) const
+        {
+            return stamps_[index] == epoch_;
+        }
+
+        //------------------------------------------------------------------------------
+        /// @brief Prefetch slot.
+        ///
+        /// @param[in] index Slot index.
+        ///
+        //------------------------------------------------------------------------------
+        void
+        prefetch(int index) const
+        {
+            utility::prefetch(stamps_.data() + index);
+        }
+
+        //------------------------------------------------------------------------------
+        /// @brief Number of slots.
+        ///
+        /// @return Slot count.
+        ///
+        //------------------------------------------------------------------------------
+        int
+        size() const
+        {
+            return static_cast<int>(stamps_.size());
+        }
+
+        //------------------------------------------------------------------------------
+        /// @brief Heap bytes used.
+        ///
+        /// @return Byte count.
+        ///
+        //------------------------------------------------------------------------------
+        std::size_t
+        memory() const
+        {
+            return vector_bytes(stamps_);
+        }
+
+    private:
+
+        /// @brief Epoch each slot was marked in.
+        std::vector<unsigned> stamps_;
+
+        /// @brief Current epoch, never 0.
+        unsigned epoch_;
+    };
+
+} // namespace utility
+
+
+//------------------------------------------------------------------------------
+// Function declarations
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Variable definitions
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Function definitions
+//------------------------------------------------------------------------------
+// (none)
+
+
+
+#endif // GRAPH_LIB_UTILITY_EPOCH_HPP
+//==============================================================================
+// End of epoch.hpp
+// (note: the newline at the end of the file is intentional)
+//==============================================================================
@@ -0,0 +1,331 @@
+//==============================================================================
+///
+/// @file memory.hpp
+///
+/// @brief Memory accounting support.
+///
+/// Contains memory usage report returned by MemoryUsage() methods of graph
+/// implementations and algorithms, and counting allocator used by node based
+/// containers (std::map, std::list) to measure exact number of bytes they
+/// request from the heap, including per node bookkeeping.
+///
+/// The documentation is available on the following website:
+/// <website>
+///
+/// Support email: <email>
+///
+//==============================================================================
+
+//==============================================================================
+// Include only once
+//
+#ifndef GRAPH_LIB_UTILITY_MEMORY_HPP
+#define GRAPH_LIB_UTILITY_MEMORY_HPP
+
+
+//------------------------------------------------------------------------------
+// Include files
+//------------------------------------------------------------------------------
+// System
+// e.g.: #include <iostream>        // stdout
+#include <cstddef>                  // std::size_t
+#include <memory>                   // std::shared_ptr
+#include <new>                      // ::operator new
+#include <vector>
+#include <type_traits>              // std::true_type, std::false_type
+
+// Project
+// e.g.: #include "IncludeFile.h"   // MyType_t
+
+
+//------------------------------------------------------------------------------
+// Global references
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Constants
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Macros
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Forward declarations
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Data types
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+/// @brief Library utilities.
+//------------------------------------------------------------------------------
+namespace utility
+{
+    //------------------------------------------------------------------------------
+    /// @brief Memory usage report.
+    ///
+    /// All values are in bytes of heap memory.
+    //------------------------------------------------------------------------------
+    struct memory_usage
+    {
+        /// @brief Vertex storage (map nodes, vertex arrays, indices).
+        std::size_t vertices = 0;
+
+        /// @brief Per vertex edge containers (list headers, offsets).
+        std::size_t edge_containers = 0;
+
+        /// @brief Edge objects (list nodes, arc arrays).
+        std::size_t edges = 0;
+
+        /// @brief Auxiliary structures (algorithm state, caches).
+        std::size_t auxiliary = 0;
+
+        //------------------------------------------------------------------------------
+        /// @brief Sum of all categories.
+        ///
+        /// @return Total bytes.
+        ///
+        //------------------------------------------------------------------------------
+        std::size_t
+        total() const
+        {
+            return vertices + edge_containers + edges + auxiliary;
+        }
+
+        //------------------------------------------------------------------------------
+        /// @brief Accumulate another report.
+        ///
+        /// @param[in] other Report to add.
+        ///
+        /// @return Reference to itself.
+        ///
+        //------------------------------------------------------------------------------
+        memory_usage&
+        operator+=(const memory_usage& other)
+        {
+            vertices += other.vertices;
+            edge_containers += other.edge_containers;
+            edges += other.edges;
+            auxiliary += other.auxiliary;
+
+            return *this;
+        }
+    };
+
+    //------------------------------------------------------------------------------
+    /// @brief Allocator counting bytes it hands out.
+    ///
+    /// Counter is shared by all copies and rebinds of the allocator, so a
+    /// container and all its nodes report into the same counter. Container
+    /// copies and copy assignments take a fresh counter, so a copy never
+    /// reports into the original. Moving an allocator copies the counter
+    /// pointer: a moved-from container still allocates through its
+    /// allocator, which must never be left without a counter. Counter is not
+    /// atomic: a counter belongs to one container and is synchronized with it.
+    //------------------------------------------------------------------------------
+    template<class T>
+    class counting_allocator
+    {
+        template<class U>
+        friend class counting_allocator;
+
+    public:
+
+        using value_type                                = T;
+        using propagate_on_container_copy_assignment    = std::false_type;
+        using propagate_on_container_move_assignment    = std::true_type;
+        using propagate_on_container_swap               = std::true_type;
+
+    public:
+
+        //------------------------------------------------------------------------------
+        /// @brief Default constructor.
+        ///
+        /// Creates allocator with its own counter.
+        //------------------------------------------------------------------------------
+        counting_allocator() : counter_(std::make_shared<std::size_t>(0))
+        {   }
+
+        //------------------------------------------------------------------------------
+        /// @brief Copy constructor.
+        ///
+        /// @param[in] other Allocator to share counter with.
+        ///
+        //------------------------------------------------------------------------------
+        counting_allocator(const counting_allocator& other) = default;
+
+        //------------------------------------------------------------------------------
+        /// @brief Move constructor, shares counter like a copy.
+        ///
+        /// @param[in] other Allocator to share counter with.
+        ///
+        //------------------------------------------------------------------------------
+        counting_allocator(counting_allocator&& other) noexcept : counter_(other.counter_)
+        {   }
+
+        //------------------------------------------------------------------------------
+        /// @brief Copy assignment.
+        ///
+        /// @param[in] other Allocator to share counter with.
+        ///
+        /// @return This allocator.
+        ///
+        //------------------------------------------------------------------------------
+        counting_allocator&
+        operator=(const counting_allocator& other) = default;
+
+        //------------------------------------------------------------------------------
+        /// @brief Move assignment, shares counter like a copy.
+        ///
+        /// @param[in] other Allocator to share counter with.
+        ///
+        /// @return This allocator.
+        ///
+        //------------------------------------------------------------------------------
+        counting_allocator&
+        operator=(counting_allocator&& other) noexcept
+        {
+            counter_ = other.counter_;
+            return *this;
+        }
+
+        //------------------------------------------------------------------------------
+        /// @brief Rebind constructor.
+        ///
+        /// @param[in] other Allocator to share counter with.
+        ///
+        //------------------------------------------------------------------------------
+        template<class U>
+        counting_allocator(const counting_allocator<U>& other) : counter_(other.counter_)
+        {   }
+
+        //------------------------------------------------------------------------------
+        /// @brief Allocator of a container copy.
+        ///
+        /// @return Allocator with its own counter.
+        ///
+        //------------------------------------------------------------------------------
+        counting_allocator
+        select_on_container_copy_construction() const
+        {
+            return counting_allocator();
+        }
+
+        //------------------------------------------------------------------------------
+        /// @brief Allocate storage for n objects.
+        ///
+        /// @param[in] n Object count.
+        ///
+        /// @return Pointer to storage.
+        ///
+        //------------------------------------------------------------------------------
+        T*
+        allocate(std::size_t n)
+        {
+            *counter_ += n * sizeof(T);
+            return static_cast<T*>(::operator new(n * sizeof(T)));
+        }
+
+        //------------------------------------------------------------------------------
+        /// @brief Release storage for n objects.
+        ///
+        /// @param[in] p Pointer to storage.
+        ///
+        /// @param[in] n Object count.
+        ///
+        //------------------------------------------------------------------------------
+        void
+        deallocate(T* p,
+                   std::size_t n)
+        {
+            *counter_ -= n * sizeof(T);
+            ::operator delete(p);
+        }
+
+        //------------------------------------------------------------------------------
+        /// @brief Bytes currently allocated through this counter.
+        ///
+        /// @return Byte count.
+        ///
+        //------------------------------------------------------------------------------
+        std::size_t
+        allocated() const
+        {
+            return *counter_;
+        }
+
+        //------------------------------------------------------------------------------
+        /// @brief Allocators are equal if they share a counter.
+        ///
+        //------------------------------------------------------------------------------
+        template<class U>
+        bool
+        operator==(const counting_allocator<U>& other) const
+        {
+            return counter_ == other.counter_;
+        }
+
+        template<class U>
+        bool
+        operator!=(const counting_allocator<U>& other) const
+        {
+            return counter_ != other.counter_;
+        }
+
+    private:
+
+        /// @brief Shared byte counter.
+        std::shared_ptr<std::size_t> counter_;
+    };
+
+} // namespace utility
+
+
+//------------------------------------------------------------------------------
+// Function declarations
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Variable definitions
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Function definitions
+//------------------------------------------------------------------------------
+namespace utility
+{
+    //------------------------------------------------------------------------------
+    //
+    //  Heap bytes owned by a vector: reserved, not only used, capacity.
+    //
+    //------------------------------------------------------------------------------
+    template<class T, class allocator_type>
+    std::size_t
+    vector_bytes(const std::vector<T, allocator_type>& container)
+    {
+        return container.capacity() * sizeof(T);
+    }
+
+} // namespace utility
+
+
+
+#endif // GRAPH_LIB_UTILITY_MEMORY_HPP
+//==============================================================================
+// End of memory.hpp
+// (note: the newline at the end of the file is intentional)
+//==============================================================================
@@ -0,0 +1,117 @@
+//==============================================================================
+///
+/// @file prefetch.hpp
+///
+/// @brief Software prefetch hint.
+///
+/// Traversals know which adjacency headers, arcs and marks they touch a few
+/// vertices ahead, while hardware prefetchers only follow sequential runs.
+/// Hint asks for the cache line holding an address without waiting for it;
+/// it never faults and compiles to nothing where the builtin is missing.
+///
+/// The documentation is available on the following website:
+/// <website>
+///
+/// Support email: <email>
+///
+//==============================================================================
+
+//==============================================================================
+// Include only once
+//
+#ifndef GRAPH_LIB_UTILITY_PREFETCH_HPP
+#define GRAPH_LIB_UTILITY_PREFETCH_HPP
+
+
+//------------------------------------------------------------------------------
+// Include files
+//------------------------------------------------------------------------------
+// System
+// e.g.: #include <iostream>        // stdout
+
+// Project
+// e.g.: #include "IncludeFile.h"   // MyType_t
+
+
+//------------------------------------------------------------------------------
+// Global references
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Constants
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Macros
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Forward declarations
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Data types
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Function declarations
+//------------------------------------------------------------------------------
+namespace utility
+{
+    //------------------------------------------------------------------------------
+    /// @brief Hint that address will be read soon.
+    ///
+    /// @param[in] address Any address, need not be dereferenceable.
+    ///
+    //------------------------------------------------------------------------------
+    inline void
+    prefetch(const void* address);
+
+} // namespace utility
+
+
+//------------------------------------------------------------------------------
+// Variable definitions
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Function definitions
+//------------------------------------------------------------------------------
+namespace utility
+{
+    //------------------------------------------------------------------------------
+    //
+    //  Read access, keep in all cache levels.
+    //
+    //------------------------------------------------------------------------------
+    inline void
+    prefetch(const void* address)
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        __builtin_prefetch(address, 0, 3);
+#else
+        (void)address;
+#endif
+    }
+
+} // namespace utility
+
+
+
+#endif // GRAPH_LIB_UTILITY_PREFETCH_HPP
+//==============================================================================
+// End of prefetch.hpp
+// (note: the newline at the end of the file is intentional)
+//==============================================================================
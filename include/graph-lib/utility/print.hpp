@@ -80,7 +80,7 @@
 //------------------------------------------------------------------------------
 
 // Create string representation of edge direction type
-std::string
+inline std::string
 direction_to_string(component::traits::edge_direction direction)
 {
     return direction == component::traits::edge_direction::none ? "---" : "-->";
@@ -118,12 +118,14 @@ print_edge(const component::Edge<id_type>& edge)
 }
 
 // print traversal algorithm results to stdout
-template<class id_type>
+template<class id_type,
+         class allocator_type>
 void
 print_traversal_result(
         const std::map<component::Vertex<id_type>,
                        component::Vertex<id_type>,
-                       component::support::vertex_less<id_type>>& container)
+                       component::support::vertex_less<id_type>,
+                       allocator_type>& container)
 {
     std::cout << "Algorithm structure:\n";
 
@@ -139,12 +141,14 @@ print_traversal_result(
 }
 
 // print Dinic algorithm level structure to stdout
-template<class id_type>
+template<class id_type,
+         class allocator_type>
 void
 print_level_structure(
         const std::map<component::Vertex<id_type>,
                        int,
-                       component::support::vertex_less<id_type>>& container)
+                       component::support::vertex_less<id_type>,
+                       allocator_type>& container)
 {
     std::cout << "Algorithm structure:\n";
 
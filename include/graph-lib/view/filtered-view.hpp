@@ -0,0 +1,343 @@
+//==============================================================================
+///
+/// @file filtered-view.hpp
+///
+/// @brief Edge-filtered graph view.
+///
+/// FilteredView exposes all vertices of an underlying graph and only those
+/// edges accepted by an edge predicate, e.g. edges with positive capacity.
+/// Neighbour lists are filtered lazily while being iterated, nothing is
+/// copied. The underlying graph and predicate state must outlive the view.
+/// bfs and dfs walk the view in place, calling the predicate only on edges
+/// of vertices they expand; flow engines and other algorithms snapshot it.
+///
+/// The documentation is available on the following website:
+/// <website>
+///
+/// Support email: <email>
+///
+//==============================================================================
+
+//==============================================================================
+// Include only once
+//
+#ifndef GRAPH_LIB_VIEW_FILTERED_VIEW_HPP
+#define GRAPH_LIB_VIEW_FILTERED_VIEW_HPP
+
+
+//------------------------------------------------------------------------------
+// Include files
+//------------------------------------------------------------------------------
+// System
+// e.g.: #include <iostream>        // stdout
+
+// Project
+// e.g.: #include "IncludeFile.h"   // MyType_t
+#include "graph-lib/view/view-support.hpp"      // view::support::filter_iterator
+#include "graph-lib/utility/memory.hpp"         // utility::memory_usage
+
+
+//------------------------------------------------------------------------------
+// Global references
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Constants
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Macros
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Forward declarations
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Data types
+//------------------------------------------------------------------------------
+namespace view
+{
+    //------------------------------------------------------------------------------
+    /// @brief Edge-filtered view.
+    ///
+    /// predicate_type is callable as bool(const edge_type&).
+    //------------------------------------------------------------------------------
+    template<class graph_type,
+             class predicate_type>
+    class FilteredView
+    {
+        using vertex_type           = support::vertex_of<graph_type>;
+        using base_neighbours       = decltype(std::declval<const graph_type&>().GetNeighbours(
+                                                    std::declval<const vertex_type&>()));
+        using base_edge_iterator    = decltype(std::declval<base_neighbours>().begin());
+
+        //------------------------------------------------------------------------------
+        /// @brief Forwards to the view predicate.
+        //------------------------------------------------------------------------------
+        struct edge_filter
+        {
+            const predicate_type* pPredicate;
+
+            template<class edge_type>
+            bool
+            operator()(const edge_type& edge) const
+            {
+                return (*pPredicate)(edge);
+            }
+        };
+
+    public:
+
+        using const_iterator        = decltype(std::declval<const graph_type&>().cbegin());
+        using edge_range            = support::iterator_range<
+                                        support::filter_iterator<base_edge_iterator, edge_filter>>;
+
+    public:
+
+        //------------------------------------------------------------------------------
+        /// @brief Value constructor.
+        ///
+        /// @param[in] graph Underlying graph.
+        ///
+        /// @param[in] predicate Edge predicate.
+        ///
+        //------------------------------------------------------------------------------
+        FilteredView(const graph_type& graph,
+                     predicate_type predicate);
+
+        //------------------------------------------------------------------------------
+        /// @brief Get accepted edges of a vertex.
+        ///
+        /// @param[in] vertex Input vertex.
+        ///
+        /// @return Lazily filtered range of underlying edges.
+        ///
+        //------------------------------------------------------------------------------
+        edge_range
+        GetNeighbours(const vertex_type& vertex) const;
+
+        //------------------------------------------------------------------------------
+        /// @brief Get iterator to the first vertex.
+        ///
+        /// @return Underlying graph iterator.
+        ///
+        //------------------------------------------------------------------------------
+        const_iterator
+        cbegin() const;
+
+        //------------------------------------------------------------------------------
+        /// @brief Get iterator past the last vertex.
+        ///
+        /// @return Underlying graph iterator.
+        ///
+        //------------------------------------------------------------------------------
+        const_iterator
+        cend() const;
+
+        //------------------------------------------------------------------------------
+        /// @brief Get number of vertices.
+        ///
+        /// @return Vertex count.
+        ///
+        //------------------------------------------------------------------------------
+        int
+        Size() const;
+
+        //------------------------------------------------------------------------------
+        /// @brief Heap memory owned by the view.
+        ///
+        /// @return Empty report, the view owns nothing.
+        ///
+        //------------------------------------------------------------------------------
+        utility::memory_usage
+        MemoryUsage() const;
+
+        //------------------------------------------------------------------------------
+        /// @brief Get underlying graph.
+        ///
+        /// @return Reference to underlying graph.
+        ///
+        //------------------------------------------------------------------------------
+        const graph_type&
+        GetGraph() const;
+
+    private:
+
+        /// @brief Underlying graph.
+        const graph_type* pGraph_;
+
+        /// @brief Edge predicate.
+        predicate_type predicate_;
+    };
+
+    namespace support
+    {
+        template<class graph_type,
+                 class predicate_type>
+        struct is_view<FilteredView<graph_type, predicate_type>> : std::true_type
+        {   };
+
+    } // namespace support
+
+} // namespace view
+
+
+//------------------------------------------------------------------------------
+// Function declarations
+//------------------------------------------------------------------------------
+namespace view
+{
+    //------------------------------------------------------------------------------
+    /// @brief Create edge-filtered view.
+    ///
+    /// @param[in] graph Underlying graph.
+    ///
+    /// @param[in] predicate Edge predicate.
+    ///
+    /// @return View.
+    ///
+    //------------------------------------------------------------------------------
+    template<class graph_type,
+             class predicate_type>
+    FilteredView<graph_type, predicate_type>
+    make_filtered_view(const graph_type& graph,
+                       predicate_type predicate);
+
+} // namespace view
+
+
+//------------------------------------------------------------------------------
+// Variable definitions
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Function definitions
+//------------------------------------------------------------------------------
+namespace view
+{
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class graph_type, class predicate_type>
+    FilteredView<graph_type, predicate_type>::FilteredView(
+            const graph_type& graph,
+            predicate_type predicate) : pGraph_(&graph),
+                                        predicate_(predicate)
+    {   }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class graph_type, class predicate_type>
+    typename FilteredView<graph_type, predicate_type>::edge_range
+    FilteredView<graph_type, predicate_type>::GetNeighbours(
+            const typename FilteredView<graph_type, predicate_type>::vertex_type& vertex) const
+    {
+        const auto& neighbours = pGraph_->GetNeighbours(vertex);
+        edge_filter filter{&predicate_};
+
+        return edge_range(
+            support::filter_iterator<base_edge_iterator, edge_filter>(
+                neighbours.begin(), neighbours.end(), filter),
+            support::filter_iterator<base_edge_iterator, edge_filter>(
+                neighbours.end(), neighbours.end(), filter));
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class graph_type, class predicate_type>
+    typename FilteredView<graph_type, predicate_type>::const_iterator
+    FilteredView<graph_type, predicate_type>::cbegin() const
+    {
+        return pGraph_->cbegin();
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class graph_type, class predicate_type>
+    typename FilteredView<graph_type, predicate_type>::const_iterator
+    FilteredView<graph_type, predicate_type>::cend() const
+    {
+        return pGraph_->cend();
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class graph_type, class predicate_type>
+    int
+    FilteredView<graph_type, predicate_type>::Size() const
+    {
+        return static_cast<int>(pGraph_->Size());
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class graph_type, class predicate_type>
+    utility::memory_usage
+    FilteredView<graph_type, predicate_type>::MemoryUsage() const
+    {
+        return utility::memory_usage();
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class graph_type, class predicate_type>
+    const graph_type&
+    FilteredView<graph_type, predicate_type>::GetGraph() const
+    {
+        return *pGraph_;
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class graph_type,
+             class predicate_type>
+    FilteredView<graph_type, predicate_type>
+    make_filtered_view(const graph_type& graph,
+                       predicate_type predicate)
+    {
+        return FilteredView<graph_type, predicate_type>(graph, predicate);
+    }
+
+} // namespace view
+
+
+
+#endif // GRAPH_LIB_VIEW_FILTERED_VIEW_HPP
+//==============================================================================
+// End of filtered-view.hpp
+// (note: the newline at the end of the file is intentional)
+//==============================================================================
@@ -0,0 +1,456 @@
+//==============================================================================
+///
+/// @file induced-view.hpp
+///
+/// @brief Induced subgraph view.
+///
+/// InducedView exposes vertices of an underlying graph accepted by a vertex
+/// predicate and the edges between them. Nothing is copied: vertex iteration
+/// and neighbour lists are filtered lazily while being iterated, so the view
+/// costs a predicate call per inspected vertex/edge and no memory.
+/// The underlying graph and predicate state must outlive the view.
+/// bfs and dfs walk the view in place and keep only a handle per accepted
+/// vertex; flow engines and other algorithms snapshot it at construction.
+///
+/// The documentation is available on the following website:
+/// <website>
+///
+/// Support email: <email>
+///
+//==============================================================================
+
+//==============================================================================
+// Include only once
+//
+#ifndef GRAPH_LIB_VIEW_INDUCED_VIEW_HPP
+#define GRAPH_LIB_VIEW_INDUCED_VIEW_HPP
+
+
+//------------------------------------------------------------------------------
+// Include files
+//------------------------------------------------------------------------------
+// System
+// e.g.: #include <iostream>        // stdout
+#include <set>
+#include <stdexcept>                // std::out_of_range
+
+// Project
+// e.g.: #include "IncludeFile.h"   // MyType_t
+#include "graph-lib/view/view-support.hpp"      // view::support::filter_iterator
+#include "graph-lib/utility/memory.hpp"         // utility::memory_usage
+
+
+//------------------------------------------------------------------------------
+// Global references
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Constants
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Macros
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Forward declarations
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Data types
+//------------------------------------------------------------------------------
+namespace view
+{
+    //------------------------------------------------------------------------------
+    /// @brief Induced subgraph view.
+    ///
+    /// predicate_type is callable as bool(const vertex_type&).
+    //------------------------------------------------------------------------------
+    template<class graph_type,
+             class predicate_type>
+    class InducedView
+    {
+        using vertex_type           = support::vertex_of<graph_type>;
+        using base_iterator         = decltype(std::declval<const graph_type&>().cbegin());
+        using base_neighbours       = decltype(std::declval<const graph_type&>().GetNeighbours(
+                                                    std::declval<const vertex_type&>()));
+        using base_edge_iterator    = decltype(std::declval<base_neighbours>().begin());
+
+        //------------------------------------------------------------------------------
+        /// @brief Accepts vertex entries by vertex.
+        //------------------------------------------------------------------------------
+        struct vertex_filter
+        {
+            const predicate_type* pPredicate;
+
+            template<class entry_type>
+            bool
+            operator()(const entry_type& entry) const
+            {
+                return (*pPredicate)(entry.first);
+            }
+        };
+
+        //------------------------------------------------------------------------------
+        /// @brief Accepts edges by second endpoint.
+        //------------------------------------------------------------------------------
+        struct edge_filter
+        {
+            const predicate_type* pPredicate;
+
+            template<class edge_type>
+            bool
+            operator()(const edge_type& edge) const
+            {
+                return (*pPredicate)(edge.GetVertex(1));
+            }
+        };
+
+    public:
+
+        using const_iterator        = support::filter_iterator<base_iterator, vertex_filter>;
+        using edge_range            = support::iterator_range<
+                                        support::filter_iterator<base_edge_iterator, edge_filter>>;
+
+    public:
+
+        //------------------------------------------------------------------------------
+        /// @brief Value constructor.
+        ///
+        /// @param[in] graph Underlying graph.
+        ///
+        /// @param[in] predicate Vertex predicate.
+        ///
+        //------------------------------------------------------------------------------
+        InducedView(const graph_type& graph,
+                    predicate_type predicate);
+
+        //------------------------------------------------------------------------------
+        /// @brief Get edges leading to vertices of the view.
+        ///
+        /// @param[in] vertex Vertex of the view.
+        ///
+        /// @return Lazily filtered range of underlying edges.
+        ///
+        //------------------------------------------------------------------------------
+        edge_range
+        GetNeighbours(const vertex_type& vertex) const;
+
+        //------------------------------------------------------------------------------
+        /// @brief Get iterator to the first vertex of the view.
+        ///
+        /// @return Iterator over underlying vertex entries.
+        ///
+        //------------------------------------------------------------------------------
+        const_iterator
+        cbegin() const;
+
+        //------------------------------------------------------------------------------
+        /// @brief Get iterator past the last vertex of the view.
+        ///
+        /// @return Iterator over underlying vertex entries.
+        ///
+        //------------------------------------------------------------------------------
+        const_iterator
+        cend() const;
+
+        //------------------------------------------------------------------------------
+        /// @brief Check if vertex belongs to the view.
+        ///
+        /// @param[in] vertex Input vertex.
+        ///
+        /// @retval True If predicate accepts vertex.
+        /// @retval False otherwise.
+        ///
+        //------------------------------------------------------------------------------
+        bool
+        ContainsVertex(const vertex_type& vertex) const;
+
+        //------------------------------------------------------------------------------
+        /// @brief Get number of vertices, O(V).
+        ///
+        /// @return Vertex count.
+        ///
+        //------------------------------------------------------------------------------
+        int
+        Size() const;
+
+        //------------------------------------------------------------------------------
+        /// @brief Heap memory owned by the view.
+        ///
+        /// @return Empty report, the view owns nothing.
+        ///
+        //------------------------------------------------------------------------------
+        utility::memory_usage
+        MemoryUsage() const;
+
+        //------------------------------------------------------------------------------
+        /// @brief Get underlying graph.
+        ///
+        /// @return Reference to underlying graph.
+        ///
+        //------------------------------------------------------------------------------
+        const graph_type&
+        GetGraph() const;
+
+    private:
+
+        /// @brief Underlying graph.
+        const graph_type* pGraph_;
+
+        /// @brief Vertex predicate.
+        predicate_type predicate_;
+    };
+
+    //------------------------------------------------------------------------------
+    /// @brief Vertex set membership predicate.
+    ///
+    /// References the set, which must outlive the view.
+    //------------------------------------------------------------------------------
+    template<class set_type>
+    struct vertex_set_predicate
+    {
+        const set_type* pSet;
+
+        template<class vertex_type>
+        bool
+        operator()(const vertex_type& vertex) const
+        {
+            return pSet->count(vertex) != 0;
+        }
+    };
+
+    namespace support
+    {
+        template<class graph_type,
+                 class predicate_type>
+        struct is_view<InducedView<graph_type, predicate_type>> : std::true_type
+        {   };
+
+    } // namespace support
+
+} // namespace view
+
+
+//------------------------------------------------------------------------------
+// Function declarations
+//------------------------------------------------------------------------------
+namespace view
+{
+    //------------------------------------------------------------------------------
+    /// @brief Create view induced by vertex predicate.
+    ///
+    /// @param[in] graph Underlying graph.
+    ///
+    /// @param[in] predicate Vertex predicate.
+    ///
+    /// @return View.
+    ///
+    //------------------------------------------------------------------------------
+    template<class graph_type,
+             class predicate_type>
+    InducedView<graph_type, predicate_type>
+    make_induced_view(const graph_type& graph,
+                      predicate_type predicate);
+
+    //------------------------------------------------------------------------------
+    /// @brief Create view induced by vertex set.
+    ///
+    /// @param[in] graph Underlying graph.
+    ///
+    /// @param[in] vertices Vertex set, referenced by the view.
+    ///
+    /// @return View.
+    ///
+    //------------------------------------------------------------------------------
+    template<class graph_type,
+             class vertex_type,
+             class compare_type,
+             class allocator_type>
+    InducedView<graph_type,
+                vertex_set_predicate<std::set<vertex_type, compare_type, allocator_type>>>
+    make_induced_view(const graph_type& graph,
+                      const std::set<vertex_type, compare_type, allocator_type>& vertices);
+
+} // namespace view
+
+
+//------------------------------------------------------------------------------
+// Variable definitions
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Function definitions
+//------------------------------------------------------------------------------
+namespace view
+{
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class graph_type, class predicate_type>
+    InducedView<graph_type, predicate_type>::InducedView(
+            const graph_type& graph,
+            predicate_type predicate) : pGraph_(&graph),
+                                        predicate_(predicate)
+    {   }
+
+    //------------------------------------------------------------------------------
+    //
+    //  Underlying neighbour container is referenced, not copied: the range
+    //  holds its iterators only.
+    //
+    //------------------------------------------------------------------------------
+    template<class graph_type, class predicate_type>
+    typename InducedView<graph_type, predicate_type>::edge_range
+    InducedView<graph_type, predicate_type>::GetNeighbours(
+            const typename InducedView<graph_type, predicate_type>::vertex_type& vertex) const
+    {
+        if (!predicate_(vertex))
+        {
+            throw std::out_of_range("Graph contains no such vertex");
+        }
+
+        const auto& neighbours = pGraph_->GetNeighbours(vertex);
+        edge_filter filter{&predicate_};
+
+        return edge_range(
+            support::filter_iterator<base_edge_iterator, edge_filter>(
+                neighbours.begin(), neighbours.end(), filter),
+            support::filter_iterator<base_edge_iterator, edge_filter>(
+                neighbours.end(), neighbours.end(), filter));
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class graph_type, class predicate_type>
+    typename InducedView<graph_type, predicate_type>::const_iterator
+    InducedView<graph_type, predicate_type>::cbegin() const
+    {
+        return const_iterator(pGraph_->cbegin(), pGraph_->cend(), vertex_filter{&predicate_});
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class graph_type, class predicate_type>
+    typename InducedView<graph_type, predicate_type>::const_iterator
+    InducedView<graph_type, predicate_type>::cend() const
+    {
+        return const_iterator(pGraph_->cend(), pGraph_->cend(), vertex_filter{&predicate_});
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class graph_type, class predicate_type>
+    bool
+    InducedView<graph_type, predicate_type>::ContainsVertex(
+            const typename InducedView<graph_type, predicate_type>::vertex_type& vertex) const
+    {
+        return predicate_(vertex);
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class graph_type, class predicate_type>
+    int
+    InducedView<graph_type, predicate_type>::Size() const
+    {
+        int size = 0;
+        for (auto it = cbegin(); it != cend(); ++it)
+        {
+            ++size;
+        }
+
+        return size;
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class graph_type, class predicate_type>
+    utility::memory_usage
+    InducedView<graph_type, predicate_type>::MemoryUsage() const
+    {
+        return utility::memory_usage();
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class graph_type, class predicate_type>
+    const graph_type&
+    InducedView<graph_type, predicate_type>::GetGraph() const
+    {
+        return *pGraph_;
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class graph_type,
+             class predicate_type>
+    InducedView<graph_type, predicate_type>
+    make_induced_view(const graph_type& graph,
+                      predicate_type predicate)
+    {
+        return InducedView<graph_type, predicate_type>(graph, predicate);
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class graph_type,
+             class vertex_type,
+             class compare_type,
+             class allocator_type>
+    InducedView<graph_type,
+                vertex_set_predicate<std::set<vertex_type, compare_type, allocator_type>>>
+    make_induced_view(const graph_type& graph,
+                      const std::set<vertex_type, compare_type, allocator_type>& vertices)
+    {
+        using set_type = std::set<vertex_type, compare_type, allocator_type>;
+
+        return InducedView<graph_type, vertex_set_predicate<set_type>>(
+            graph, vertex_set_predicate<set_type>{&vertices});
+    }
+
+} // namespace view
+
+
+
+#endif // GRAPH_LIB_VIEW_INDUCED_VIEW_HPP
+//==============================================================================
+// End of induced-view.hpp
+// (note: the newline at the end of the file is intentional)
+//==============================================================================
@@ -0,0 +1,480 @@
+//==============================================================================
+///
+/// @file transposed-view.hpp
+///
+/// @brief Transposed graph view.
+///
+/// TransposedView exposes an underlying graph with every edge reversed.
+/// Incoming edges are not stored by the graph, so the view builds an index of
+/// pointers to underlying edges grouped by second endpoint once, at
+/// construction, and yields lightweight reversed edge proxies - edges
+/// themselves are never copied. Underlying graph must outlive the view and
+/// must not change while the view is used, since index would become stale.
+/// Underlying neighbour lists must yield addressable edges, so a transposed
+/// view cannot wrap another transposed view.
+/// bfs and dfs walk the view in place over this index; flow engines and
+/// other algorithms snapshot it, so index and snapshot both exist then.
+///
+/// The documentation is available on the following website:
+/// <website>
+///
+/// Support email: <email>
+///
+//==============================================================================
+
+//==============================================================================
+// Include only once
+//
+#ifndef GRAPH_LIB_VIEW_TRANSPOSED_VIEW_HPP
+#define GRAPH_LIB_VIEW_TRANSPOSED_VIEW_HPP
+
+
+//------------------------------------------------------------------------------
+// Include files
+//------------------------------------------------------------------------------
+// System
+// e.g.: #include <iostream>        // stdout
+#include <map>
+#include <vector>
+#include <iterator>                 // std::forward_iterator_tag
+#include <type_traits>              // std::is_lvalue_reference
+
+// Project
+// e.g.: #include "IncludeFile.h"   // MyType_t
+#include "graph-lib/view/view-support.hpp"      // view::support::iterator_range
+#include "graph-lib/utility/memory.hpp"         // utility::memory_usage
+
+
+//------------------------------------------------------------------------------
+// Global references
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Constants
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Macros
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Forward declarations
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Data types
+//------------------------------------------------------------------------------
+namespace view
+{
+    namespace support
+    {
+        //------------------------------------------------------------------------------
+        /// @brief Reversed edge proxy.
+        ///
+        /// Exposes read interface of an edge with endpoints swapped.
+        //------------------------------------------------------------------------------
+        template<class edge_type>
+        class reversed_edge
+        {
+        public:
+
+            //------------------------------------------------------------------------------
+            /// @brief Value constructor.
+            ///
+            /// @param[in] pEdge Underlying edge.
+            ///
+            //------------------------------------------------------------------------------
+            explicit reversed_edge(const edge_type* pEdge) : pEdge_(pEdge)
+            {   }
+
+            decltype(auto)
+            GetVertex(int index) const
+            {
+                return pEdge_->GetVertex(1 - index);
+            }
+
+            decltype(auto)
+            GetDirection() const
+            {
+                return pEdge_->GetDirection();
+            }
+
+            int
+            GetWeight() const
+            {
+                return pEdge_->GetWeight();
+            }
+
+            int
+            GetCapacity() const
+            {
+                return pEdge_->GetCapacity();
+            }
+
+            int
+            GetFlow() const
+            {
+                return pEdge_->GetFlow();
+            }
+
+            //------------------------------------------------------------------------------
+            /// @brief Get underlying edge.
+            ///
+            /// @return Reference to underlying edge.
+            ///
+            //------------------------------------------------------------------------------
+            const edge_type&
+            GetEdge() const
+            {
+                return *pEdge_;
+            }
+
+        private:
+
+            /// @brief Underlying edge.
+            const edge_type* pEdge_;
+        };
+
+        //------------------------------------------------------------------------------
+        /// @brief Iterator yielding reversed edge proxies by value.
+        ///
+        //------------------------------------------------------------------------------
+        template<class edge_type>
+        class reversed_iterator
+        {
+            using base_iterator         = typename std::vector<const edge_type*>::const_iterator;
+
+        public:
+
+            using iterator_category     = std::forward_iterator_tag;
+            using value_type            = reversed_edge<edge_type>;
+            using difference_type       = std::ptrdiff_t;
+            using pointer               = void;
+            using reference             = value_type;
+
+        public:
+
+            explicit reversed_iterator(base_iterator current) : current_(current)
+            {   }
+
+            reference
+            operator*() const
+            {
+                return value_type(*current_);
+            }
+
+            reversed_iterator&
+            operator++()
+            {
+                ++current_;
+                return *this;
+            }
+
+            reversed_iterator
+            operator++(int)
+            {
+                reversed_iterator previous = *this;
+                ++current_;
+                return previous;
+            }
+
+            bool
+            operator==(const reversed_iterator& other) const
+            {
+                return current_ == other.current_;
+            }
+
+            bool
+            operator!=(const reversed_iterator& other) const
+            {
+                return current_ != other.current_;
+            }
+
+        private:
+
+            /// @brief Current position.
+            base_iterator current_;
+        };
+
+    } // namespace support
+
+    //------------------------------------------------------------------------------
+    /// @brief Transposed view.
+    ///
+    //------------------------------------------------------------------------------
+    template<class graph_type>
+    class TransposedView
+    {
+        using vertex_type           = support::vertex_of<graph_type>;
+        using edge_type             = support::edge_of<graph_type>;
+        using incoming_container    = std::vector<const edge_type*>;
+        using incoming_structure    = std::map<vertex_type,
+                                               incoming_container,
+                                               typename support::vertex_traits<vertex_type>::less_type,
+                                               utility::counting_allocator<
+                                                    std::pair<const vertex_type, incoming_container>>>;
+
+        static_assert(std::is_lvalue_reference<decltype(
+                          *std::declval<const graph_type&>().GetNeighbours(
+                              std::declval<const vertex_type&>()).begin())>::value,
+                      "Transposed view requires addressable underlying edges");
+
+    public:
+
+        using const_iterator        = decltype(std::declval<const graph_type&>().cbegin());
+        using edge_range            = support::iterator_range<support::reversed_iterator<edge_type>>;
+
+    public:
+
+        //------------------------------------------------------------------------------
+        /// @brief Value constructor.
+        ///
+        /// Builds incoming edge index, O(V + E).
+        ///
+        /// @param[in] graph Underlying graph.
+        ///
+        //------------------------------------------------------------------------------
+        explicit TransposedView(const graph_type& graph);
+
+        //------------------------------------------------------------------------------
+        /// @brief Get reversed incoming edges of a vertex.
+        ///
+        /// @param[in] vertex Input vertex.
+        ///
+        /// @return Range of reversed edge proxies.
+        ///
+        //------------------------------------------------------------------------------
+        edge_range
+        GetNeighbours(const vertex_type& vertex) const;
+
+        //------------------------------------------------------------------------------
+        /// @brief Get iterator to the first vertex.
+        ///
+        /// @return Underlying graph iterator.
+        ///
+        //------------------------------------------------------------------------------
+        const_iterator
+        cbegin() const;
+
+        //------------------------------------------------------------------------------
+        /// @brief Get iterator past the last vertex.
+        ///
+        /// @return Underlying graph iterator.
+        ///
+        //------------------------------------------------------------------------------
+        const_iterator
+        cend() const;
+
+        //------------------------------------------------------------------------------
+        /// @brief Get number of vertices.
+        ///
+        /// @return Vertex count.
+        ///
+        //------------------------------------------------------------------------------
+        int
+        Size() const;
+
+        //------------------------------------------------------------------------------
+        /// @brief Heap memory owned by the view.
+        ///
+        /// @return Memory usage report, incoming edge index is auxiliary.
+        ///
+        //------------------------------------------------------------------------------
+        utility::memory_usage
+        MemoryUsage() const;
+
+        //------------------------------------------------------------------------------
+        /// @brief Get underlying graph.
+        ///
+        /// @return Reference to underlying graph.
+        ///
+        //------------------------------------------------------------------------------
+        const graph_type&
+        GetGraph() const;
+
+    private:
+
+        /// @brief Underlying graph.
+        const graph_type* pGraph_;
+
+        /// @brief Incoming edges by second endpoint.
+        incoming_structure incoming_;
+    };
+
+    namespace support
+    {
+        template<class graph_type>
+        struct is_view<TransposedView<graph_type>> : std::true_type
+        {   };
+
+    } // namespace support
+
+} // namespace view
+
+
+//------------------------------------------------------------------------------
+// Function declarations
+//------------------------------------------------------------------------------
+namespace view
+{
+    //------------------------------------------------------------------------------
+    /// @brief Create transposed view.
+    ///
+    /// @param[in] graph Underlying graph.
+    ///
+    /// @return View.
+    ///
+    //------------------------------------------------------------------------------
+    template<class graph_type>
+    TransposedView<graph_type>
+    make_transposed_view(const graph_type& graph);
+
+} // namespace view
+
+
+//------------------------------------------------------------------------------
+// Variable definitions
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Function definitions
+//------------------------------------------------------------------------------
+namespace view
+{
+    //------------------------------------------------------------------------------
+    //
+    //  Every vertex gets an entry, so vertices without incoming edges yield
+    //  empty ranges rather than throw.
+    //
+    //------------------------------------------------------------------------------
+    template<class graph_type>
+    TransposedView<graph_type>::TransposedView(const graph_type& graph) : pGraph_(&graph)
+    {
+        for (auto it = graph.cbegin(); it != graph.cend(); ++it)
+        {
+            incoming_.emplace((*it).first, incoming_container());
+        }
+
+        for (auto it = graph.cbegin(); it != graph.cend(); ++it)
+        {
+            for (const auto& edge : graph.GetNeighbours((*it).first))
+            {
+                incoming_.at(edge.GetVertex(1)).push_back(&edge);
+            }
+        }
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class graph_type>
+    typename TransposedView<graph_type>::edge_range
+    TransposedView<graph_type>::GetNeighbours(
+            const typename TransposedView<graph_type>::vertex_type& vertex) const
+    {
+        const auto& incoming = incoming_.at(vertex);
+
+        return edge_range(support::reversed_iterator<edge_type>(incoming.cbegin()),
+                          support::reversed_iterator<edge_type>(incoming.cend()));
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class graph_type>
+    typename TransposedView<graph_type>::const_iterator
+    TransposedView<graph_type>::cbegin() const
+    {
+        return pGraph_->cbegin();
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class graph_type>
+    typename TransposedView<graph_type>::const_iterator
+    TransposedView<graph_type>::cend() const
+    {
+        return pGraph_->cend();
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class graph_type>
+    int
+    TransposedView<graph_type>::Size() const
+    {
+        return static_cast<int>(incoming_.size());
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class graph_type>
+    utility::memory_usage
+    TransposedView<graph_type>::MemoryUsage() const
+    {
+        utility::memory_usage usage;
+        usage.auxiliary = incoming_.get_allocator().allocated();
+        for (const auto& entry : incoming_)
+        {
+            usage.auxiliary += utility::vector_bytes(entry.second);
+        }
+
+        return usage;
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class graph_type>
+    const graph_type&
+    TransposedView<graph_type>::GetGraph() const
+    {
+        return *pGraph_;
+    }
+
+    //------------------------------------------------------------------------------
+    //
+    //  <Design related information>
+    //
+    //------------------------------------------------------------------------------
+    template<class graph_type>
+    TransposedView<graph_type>
+    make_transposed_view(const graph_type& graph)
+    {
+        return TransposedView<graph_type>(graph);
+    }
+
+} // namespace view
+
+
+
+#endif // GRAPH_LIB_VIEW_TRANSPOSED_VIEW_HPP
+//==============================================================================
+// End of transposed-view.hpp
+// (note: the newline at the end of the file is intentional)
+//==============================================================================
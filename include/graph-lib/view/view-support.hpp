@@ -0,0 +1,417 @@
+//==============================================================================
+///
+/// @file view-support.hpp
+///
+/// @brief Graph view support.
+///
+/// Contains type helpers deducing vertex and edge types of graph-like objects,
+/// lazy filtering iterator and iterator range used by views to expose a subset
+/// of vertices and edges of an underlying graph without copying them, and
+/// is_view trait telling traversals to walk a view in place.
+///
+/// The documentation is available on the following website:
+/// <website>
+///
+/// Support email: <email>
+///
+//==============================================================================
+
+//==============================================================================
+// Include only once
+//
+#ifndef GRAPH_LIB_VIEW_VIEW_SUPPORT_HPP
+#define GRAPH_LIB_VIEW_VIEW_SUPPORT_HPP
+
+
+//------------------------------------------------------------------------------
+// Include files
+//------------------------------------------------------------------------------
+// System
+// e.g.: #include <iostream>        // stdout
+#include <iterator>                 // std::iterator_traits
+#include <utility>                  // std::declval
+#include <type_traits>              // std::decay_t, std::false_type
+
+// Project
+// e.g.: #include "IncludeFile.h"   // MyType_t
+#include "graph-lib/component/vertex.hpp"           // component::Vertex
+#include "graph-lib/component/vertex-support.hpp"   // component::support::vertex_less
+#include "graph-lib/component/edge.hpp"             // component::Edge
+
+
+//------------------------------------------------------------------------------
+// Global references
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Constants
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Macros
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Forward declarations
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Data types
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+/// @brief Lightweight graph views.
+///
+/// A view exposes the same read interface as graph::Graph - cbegin()/cend()
+/// vertex iteration, GetNeighbours() and Size() - over another graph-like
+/// object it references, so views can be consumed by algorithms and nested.
+//------------------------------------------------------------------------------
+namespace view
+{
+    //------------------------------------------------------------------------------
+    /// @brief View support classes.
+    //------------------------------------------------------------------------------
+    namespace support
+    {
+        //------------------------------------------------------------------------------
+        /// @brief Vertex type of a graph-like object.
+        //------------------------------------------------------------------------------
+        template<class graph_type>
+        using vertex_of = std::decay_t<decltype(
+            (*std::declval<const graph_type&>().cbegin()).first)>;
+
+        //------------------------------------------------------------------------------
+        /// @brief Edge type of a graph-like object.
+        //------------------------------------------------------------------------------
+        template<class graph_type>
+        using edge_of = std::decay_t<decltype(
+            *std::declval<const graph_type&>().GetNeighbours(
+                std::declval<const vertex_of<graph_type>&>()).begin())>;
+
+        //------------------------------------------------------------------------------
+        /// @brief True for view types, specialized by every view.
+        ///
+        //------------------------------------------------------------------------------
+        template<class graph_type>
+        struct is_view : std::false_type
+        {   };
+
+        //------------------------------------------------------------------------------
+        /// @brief Vertex related types.
+        //------------------------------------------------------------------------------
+        template<class vertex_type>
+        struct vertex_traits;
+
+        template<class id_type>
+        struct vertex_traits<component::Vertex<id_type>>
+        {
+            using id_t      = id_type;
+            using less_type = component::support::vertex_less<id_type>;
+        };
+
+        //------------------------------------------------------------------------------
+        /// @brief Iterator skipping elements rejected by a predicate.
+        ///
+        /// Predicate is stored by value, views pass small adaptors referencing
+        /// their own state.
+        //------------------------------------------------------------------------------
+        template<class iterator_type,
+                 class predicate_type>
+        class filter_iterator
+        {
+            using traits_type           = std::iterator_traits<iterator_type>;
+
+        public:
+
+            using iterator_category     = std::forward_iterator_tag;
+            using value_type            = typename traits_type::value_type;
+            using difference_type       = typename traits_type::difference_type;
+            using pointer               = typename traits_type::pointer;
+            using reference             = typename traits_type::reference;
+
+        public:
+
+            //------------------------------------------------------------------------------
+            /// @brief Value constructor.
+            ///
+            /// @param[in] current Start position, moved to first accepted element.
+            ///
+            /// @param[in] end End of underlying sequence.
+            ///
+            /// @param[in] predicate Element filter.
+            ///
+            //------------------------------------------------------------------------------
+            filter_iterator(iterator_type current,
+                            iterator_type end,
+                            predicate_type predicate);
+
+            //------------------------------------------------------------------------------
+            /// @brief Dereference.
+            ///
+            /// @return Underlying element.
+            ///
+            //------------------------------------------------------------------------------
+            reference
+            operator*() const;
+
+            //------------------------------------------------------------------------------
+            /// @brief Member access.
+            ///
+            /// @return Underlying iterator.
+            ///
+            //------------------------------------------------------------------------------
+            iterator_type
+            operator->() const;
+
+            //------------------------------------------------------------------------------
+            /// @brief Advance to next accepted element.
+            ///
+            /// @return Reference to itself.
+            ///
+            //------------------------------------------------------------------------------
+            filter_iterator&
+            operator++();
+
+            //------------------------------------------------------------------------------
+            /// @brief Advance to next accepted element.
+            ///
+            /// @return Previous position.
+            ///
+            //------------------------------------------------------------------------------
+            filter_iterator
+            operator++(int);
+
+            //------------------------------------------------------------------------------
+            /// @brief Position comparison.
+            ///
+            //------------------------------------------------------------------------------
+            bool
+            operator==(const filter_iterator& other) const;
+
+            bool
+            operator!=(const filter_iterator& other) const;
+
+        private:
+
+            //------------------------------------------------------------------------------
+            /// @brief Skip rejected elements.
+            ///
+            //------------------------------------------------------------------------------
+            void
+            Skip();
+
+        private:
+
+            /// @brief Current position.
+            iterator_type current_;
+
+            /// @brief End position.
+            iterator_type end_;
+
+            /// @brief Element filter.
+            predicate_type predicate_;
+        };
+
+        //------------------------------------------------------------------------------
+        /// @brief Iterator pair usable in range based for loops.
+        ///
+        //------------------------------------------------------------------------------
+        template<class iterator_type>
+        class iterator_range
+        {
+        public:
+
+            //------------------------------------------------------------------------------
+            /// @brief Value constructor.
+            ///
+            /// @param[in] first Range begin.
+            ///
+            /// @param[in] last Range end.
+            ///
+            //------------------------------------------------------------------------------
+            iterator_range(iterator_type first,
+                           iterator_type last) : first_(first),
+                                                 last_(last)
+            {   }
+
+            iterator_type
+            begin() const
+            {
+                return first_;
+            }
+
+            iterator_type
+            end() const
+            {
+                return last_;
+            }
+
+            bool
+            empty() const
+            {
+                return first_ == last_;
+            }
+
+        private:
+
+            /// @brief Range begin.
+            iterator_type first_;
+
+            /// @brief Range end.
+            iterator_type last_;
+        };
+
+    } // namespace support
+
+} // namespace view
+
+
+//------------------------------------------------------------------------------
+// Function declarations
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Variable definitions
+//------------------------------------------------------------------------------
+// (none)
+
+
+//------------------------------------------------------------------------------
+// Function definitions
+//------------------------------------------------------------------------------
+namespace view
+{
+    namespace support
+    {
+        //------------------------------------------------------------------------------
+        //
+        //  <Design related information>
+        //
+        //------------------------------------------------------------------------------
+        template<class iterator_type, class predicate_type>
+        filter_iterator<iterator_type, predicate_type>::filter_iterator(
+                iterator_type current,
+                iterator_type end,
+                predicate_type predicate) : current_(current),
+                                            end_(end),
+                                            predicate_(predicate)
+        {
+            Skip();
+        }
+
+        //------------------------------------------------------------------------------
+        //
+        //  <Design related information>
+        //
+        //------------------------------------------------------------------------------
+        template<class iterator_type, class predicate_type>
+        typename filter_iterator<iterator_type, predicate_type>::reference
+        filter_iterator<iterator_type, predicate_type>::operator*() const
+        {
+            return *current_;
+        }
+
+        //------------------------------------------------------------------------------
+        //
+        //  Returning the iterator itself lets operator-> chain to the element.
+        //
+        //------------------------------------------------------------------------------
+        template<class iterator_type, class predicate_type>
+        iterator_type
+        filter_iterator<iterator_type, predicate_type>::operator->() const
+        {
+            return current_;
+        }
+
+        //------------------------------------------------------------------------------
+        //
+        //  <Design related information>
+        //
+        //------------------------------------------------------------------------------
+        template<class iterator_type, class predicate_type>
+        filter_iterator<iterator_type, predicate_type>&
+        filter_iterator<iterator_type, predicate_type>::operator++()
+        {
+            ++current_;
+            Skip();
+
+            return *this;
+        }
+
+        //------------------------------------------------------------------------------
+        //
+        //  <Design related information>
+        //
+        //------------------------------------------------------------------------------
+        template<class iterator_type, class predicate_type>
+        filter_iterator<iterator_type, predicate_type>
+        filter_iterator<iterator_type, predicate_type>::operator++(int)
+        {
+            filter_iterator previous = *this;
+            ++(*this);
+
+            return previous;
+        }
+
+        //------------------------------------------------------------------------------
+        //
+        //  <Design related information>
+        //
+        //------------------------------------------------------------------------------
+        template<class iterator_type, class predicate_type>
+        bool
+        filter_iterator<iterator_type, predicate_type>::operator==(
+                const filter_iterator& other) const
+        {
+            return current_ == other.current_;
+        }
+
+        //------------------------------------------------------------------------------
+        //
+        //  <Design related information>
+        //
+        //------------------------------------------------------------------------------
+        template<class iterator_type, class predicate_type>
+        bool
+        filter_iterator<iterator_type, predicate_type>::operator!=(
+                const filter_iterator& other) const
+        {
+            return current_ != other.current_;
+        }
+
+        //------------------------------------------------------------------------------
+        //
+        //  <Design related information>
+        //
+        //------------------------------------------------------------------------------
+        template<class iterator_type, class predicate_type>
+        void
+        filter_iterator<iterator_type, predicate_type>::Skip()
+        {
+            while (current_ != end_ && !predicate_(*current_))
+            {
+                ++current_;
+            }
+        }
+
+    } // namespace support
+
+} // namespace view
+
+
+
+#endif // GRAPH_LIB_VIEW_VIEW_SUPPORT_HPP
+//==============================================================================
+// End of view-support.hpp
+// (note: the newline at the end of the file is intentional)
+//==============================================================================
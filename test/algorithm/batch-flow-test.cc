@@ -0,0 +1,118 @@
+// Testing of batch flow algorithm
+
+#include "gtest/gtest.h"                                        //gtest
+#include "graph-lib/graph.hpp"                                  // helper component
+#include "graph-lib/algorithm/flow/push-relabel.hpp"            // single pair reference
+#include "graph-lib/algorithm/flow/batch-flow.hpp"              // component to test
+#include "graph-test.hpp"                                       // shared fixture
+//
+#include <random>                                               // std::mt19937
+#include <set>
+#include <stdexcept>                                            // std::out_of_range
+#include <vector>
+
+
+
+
+
+template<   class id_type>
+class BatchFlowTest : public GraphTest<id_type>
+{
+protected:
+    using vertex_type   = component::Vertex<id_type>;
+    using pair_type     = typename algorithm::batch_flow<id_type>::pair_type;
+    using GraphTest<id_type>::id;
+
+    pair_type   pair(int source, int sink)
+    {
+        return pair_type(vertex_type(id(source)), vertex_type(id(sink)));
+    }
+};
+
+
+
+
+
+using testing::Types;
+
+typedef Types<int, char> Implementations;
+
+TYPED_TEST_SUITE(BatchFlowTest, Implementations);
+
+
+
+
+
+TYPED_TEST(BatchFlowTest, SmallNetwork)
+{
+    using vertex_type = typename TestFixture::vertex_type;
+
+    auto graph = TestFixture::small_network();
+
+    const graph::Graph<TypeParam>& shared = graph;
+    algorithm::batch_flow<TypeParam> batch(&shared, 2);
+    batch.run({this->pair(1, 4), this->pair(4, 1), this->pair(2, 2), this->pair(2, 4)}, true);
+    ASSERT_EQ(batch.get(), (std::vector<int>{5, 0, 0, 3}));
+
+    // 2-4 and 2-3 both saturate
+    const auto& cut = batch.get_min_cut(3);
+    ASSERT_EQ(cut.capacity, 3);
+    ASSERT_EQ(cut.source_side, (std::vector<vertex_type>{vertex_type(TestFixture::id(2))}));
+    ASSERT_EQ(cut.edges.size(), 2u);
+    ASSERT_TRUE(batch.get_min_cut(2).source_side.empty());
+
+    batch.run({this->pair(1, 4)});
+    ASSERT_THROW(batch.get_min_cut(0), std::out_of_range);
+    ASSERT_THROW(batch.run({this->pair(1, 9)}), std::out_of_range);
+    ASSERT_THROW(batch.set_threads(-1), std::invalid_argument);
+}
+
+
+
+// Every pair matches a single pair solver, whatever thread takes it
+TYPED_TEST(BatchFlowTest, MatchesSinglePairAcrossThreadCounts)
+{
+    const int size = 60;
+    auto graph = TestFixture::random_network(size, 5 * size, 3);
+
+    std::mt19937 generator(3);
+    std::uniform_int_distribution<int> pick(0, size - 1);
+
+    std::vector<typename TestFixture::pair_type> pairs;
+    std::vector<int> expected;
+    algorithm::push_relabel<TypeParam> single(&graph);
+    for (int index = 0; index < 40; ++index)
+    {
+        pairs.push_back(this->pair(pick(generator), pick(generator)));
+        single.run(pairs.back().first, pairs.back().second);
+        expected.push_back(single.get());
+    }
+
+    algorithm::batch_flow<TypeParam> batch(&graph);
+    for (int threads : {1, 2, 3, 8})
+    {
+        batch.set_threads(threads);
+        batch.run(pairs, true);
+        ASSERT_EQ(batch.get(), expected);
+
+        for (std::size_t index = 0; index < pairs.size(); ++index)
+        {
+            const auto& cut = batch.get_min_cut(index);
+            ASSERT_EQ(cut.capacity, expected[index]);
+
+            if (pairs[index].first == pairs[index].second)
+            {
+                continue;
+            }
+
+            // cut separates the pair
+            std::set<TypeParam> side;
+            for (const auto& vertex : cut.source_side)
+            {
+                side.insert(vertex.Id());
+            }
+            ASSERT_EQ(side.count(pairs[index].first.Id()), 1u);
+            ASSERT_EQ(side.count(pairs[index].second.Id()), 0u);
+        }
+    }
+}
@@ -1,2 +1,434 @@
 // Testing of BFS algorithm
 
+#include "gtest/gtest.h"                                        //gtest
+#include "graph-lib/graph.hpp"                                  // helper component
+#include "graph-lib/implementation/reordering.hpp"              // implementation::reorder
+#include "graph-lib/algorithm/traversal/bfs.hpp"                // component to test
+#include "graph-test.hpp"                                       // shared fixture
+//
+#include <map>                                                  //
+#include <stdexcept>                                            // std::logic_error
+#include <vector>                                               //
+
+
+
+
+
+template<   class id_type>
+class BfsTest : public GraphTest<id_type>
+{
+protected:
+    using vertex_type   = component::Vertex<id_type>;
+    using depth_map     = std::map<id_type, int>;
+    using GraphTest<id_type>::id;
+
+    //required functions
+    void    SetUp()     override
+    {
+        // low diameter graph: ring plus two chords per vertex,
+        // and a directed tail 100 -> 101 -> ... -> 109
+        count_ = 100;
+
+        for (int i = 0; i < count_ + 10; ++i)
+        {
+            graph_.AddVertex(id(i));
+        }
+        for (int i = 0; i < count_; ++i)
+        {
+            graph_.AddEdge(id(i), id((i + 1) % count_));
+            graph_.AddEdge(id(i), id((i * 7 + 3) % count_));
+            graph_.AddEdge(id(i), id((i * 13 + 5) % count_));
+        }
+        graph_.AddEdge(id(42), id(count_),
+                       component::traits::edge_direction::one_two);
+        for (int i = count_; i + 1 < count_ + 10; ++i)
+        {
+            graph_.AddEdge(id(i), id(i + 1),
+                           component::traits::edge_direction::one_two);
+        }
+    }
+
+    void    TearDown()  override
+    {   }
+
+    // depth of every discovered vertex, following parent links
+    depth_map depths(id_type root, algorithm::traits::bfs_mode mode) const
+    {
+        algorithm::bfs<id_type> bfsObj(&graph_);
+        bfsObj.run(vertex_type(root), mode);
+        const auto& parents = bfsObj.get();
+
+        depth_map result;
+        for (const auto& entry : parents)
+        {
+            if (entry.second == vertex_type::invalidInstance_)
+            {
+                continue;
+            }
+
+            // every parent link must be an arc of the graph
+            int depth = 0;
+            vertex_type current = entry.first;
+            while (current.Id() != root)
+            {
+                const auto& parent = parents.at(current);
+                bool isArc = false;
+                for (const auto& edge : graph_.GetNeighbours(parent))
+                {
+                    isArc = isArc || (edge.GetVertex(1) == current);
+                }
+                EXPECT_TRUE(isArc);
+                current = parent;
+                ++depth;
+            }
+            result[entry.first.Id()] = depth;
+        }
+        return result;
+    }
+
+    int count_;
+    graph::Graph<id_type> graph_;
+};
+
+
+
+
+
+using testing::Types;
+
+typedef Types<int, char> Implementations;
+
+TYPED_TEST_SUITE(BfsTest, Implementations);
+
+
+
+
+
+TYPED_TEST(BfsTest, DirectionOptimizingMatchesQueue)
+{
+    auto expected = this->depths(TestFixture::id(0), algorithm::traits::bfs_mode::queue);
+    auto actual = this->depths(TestFixture::id(0), algorithm::traits::bfs_mode::direction_optimizing);
+
+    ASSERT_EQ(expected.size(), static_cast<std::size_t>(this->count_ + 10));
+    ASSERT_EQ(actual, expected);
+}
+
+
+
+TYPED_TEST(BfsTest, DirectionOptimizingFollowsDirection)
+{
+    // tail is not connected back
+    auto actual = this->depths(TestFixture::id(105), algorithm::traits::bfs_mode::direction_optimizing);
+
+    ASSERT_EQ(actual.size(), 5u);
+    ASSERT_EQ(actual.at(TestFixture::id(109)), 4);
+}
+
+
+
+TYPED_TEST(BfsTest, DenseArraysMatchParentStructure)
+{
+    using vertex_type = typename TestFixture::vertex_type;
+
+    algorithm::bfs<TypeParam> bfsObj(&this->graph_);
+    bfsObj.run(vertex_type(TestFixture::id(0)));
+
+    const auto& snapshot = bfsObj.get_snapshot();
+    const auto& parents = bfsObj.get_parents();
+    const auto& distances = bfsObj.get_distances();
+    const auto& order = bfsObj.get_order();
+    auto expected = this->depths(TestFixture::id(0), algorithm::traits::bfs_mode::queue);
+
+    int rootHandle = snapshot.GetHandle(vertex_type(TestFixture::id(0)));
+    ASSERT_EQ(parents[rootHandle], rootHandle);
+    ASSERT_EQ(order[rootHandle], 0);
+
+    std::vector<bool> seen(snapshot.Size(), false);
+    for (int handle = 0; handle < snapshot.Size(); ++handle)
+    {
+        const auto& vertex = snapshot.GetVertex(handle);
+        ASSERT_EQ(distances[handle], expected.at(vertex.Id()));
+
+        // adaptor agrees with dense parent array
+        ASSERT_EQ(bfsObj.get().at(vertex), snapshot.GetVertex(parents[handle]));
+
+        // discovery order is a permutation consistent with distances
+        ASSERT_FALSE(seen[order[handle]]);
+        seen[order[handle]] = true;
+        if (handle != rootHandle)
+        {
+            ASSERT_LT(order[parents[handle]], order[handle]);
+        }
+    }
+
+    // rerun drops previous results
+    bfsObj.run(vertex_type(TestFixture::id(105)));
+    ASSERT_EQ(bfsObj.get_parents()[rootHandle], -1);
+    ASSERT_EQ(bfsObj.get().at(vertex_type(TestFixture::id(0))), vertex_type::invalidInstance_);
+    ASSERT_EQ(bfsObj.get_distances()[snapshot.GetHandle(vertex_type(TestFixture::id(109)))], 4);
+}
+
+
+
+// counts events, checks finish follows discover
+struct counting_visitor
+{
+    void discover(int handle) { discovered.push_back(handle); }
+    void examine(int, int, int) { ++examined; }
+    void finish(int) { ++finished; }
+
+    std::vector<int> discovered;
+    int examined = 0;
+    int finished = 0;
+};
+
+
+
+TYPED_TEST(BfsTest, PoliciesFilterVisitAndStop)
+{
+    using vertex_type = typename TestFixture::vertex_type;
+
+    // capacity 1 on chain 0 -> 1 -> 2 -> 3, capacity 0 on shortcut 0 -> 3
+    graph::Graph<TypeParam> graph;
+    for (int i = 0; i < 4; ++i)
+    {
+        graph.AddVertex(TestFixture::id(i));
+    }
+    const auto one_two = component::traits::edge_direction::one_two;
+    graph.AddEdge(TestFixture::id(0), TestFixture::id(1), one_two, 0, 1);
+    graph.AddEdge(TestFixture::id(1), TestFixture::id(2), one_two, 0, 1);
+    graph.AddEdge(TestFixture::id(2), TestFixture::id(3), one_two, 0, 1);
+    graph.AddEdge(TestFixture::id(0), TestFixture::id(3), one_two, 0, 0);
+
+    algorithm::bfs<TypeParam> bfsObj(&graph);
+    const auto& list = bfsObj.get_snapshot();
+    int last = list.GetHandle(vertex_type(TestFixture::id(3)));
+
+    bfsObj.run(vertex_type(TestFixture::id(0)));
+    ASSERT_EQ(bfsObj.get_distances()[last], 1);
+
+    // snapshot and graph edge filters skip the shortcut
+    counting_visitor visitor;
+    bfsObj.run(vertex_type(TestFixture::id(0)), algorithm::policy::positive_capacity(), visitor);
+    ASSERT_EQ(bfsObj.get_distances()[last], 3);
+    ASSERT_EQ(visitor.discovered, std::vector<int>({0, 1, 2, 3}));
+    ASSERT_EQ(visitor.examined, 3);
+    ASSERT_EQ(visitor.finished, 4);
+
+    bfsObj.run(vertex_type(TestFixture::id(0)), algorithm::policy::residual_capacity());
+    ASSERT_EQ(bfsObj.get_distances()[last], 3);
+
+    // early termination leaves the rest undiscovered
+    int middle = list.GetHandle(vertex_type(TestFixture::id(1)));
+    bfsObj.run(vertex_type(TestFixture::id(0)), algorithm::policy::all_arcs(),
+               algorithm::policy::null_visitor(), algorithm::policy::stop_at{middle});
+    ASSERT_EQ(bfsObj.get_parents()[middle], list.GetHandle(vertex_type(TestFixture::id(0))));
+    ASSERT_EQ(bfsObj.get_parents()[list.GetHandle(vertex_type(TestFixture::id(2)))], -1);
+}
+
+
+
+TYPED_TEST(BfsTest, TargetedSearchesFindShortestPaths)
+{
+    using vertex_type = typename TestFixture::vertex_type;
+
+    algorithm::bfs<TypeParam> full(&this->graph_);
+    algorithm::bfs<TypeParam> targeted(&this->graph_);
+    const auto& list = targeted.get_snapshot();
+
+    for (int from : {0, 17, 42, 101})
+    {
+        full.run(vertex_type(TestFixture::id(from)));
+
+        for (int to = 0; to < this->count_ + 10; to += 7)
+        {
+            int target = list.GetHandle(vertex_type(TestFixture::id(to)));
+            bool reachable = full.get_distances()[target] != -1;
+
+            ASSERT_EQ(targeted.search(vertex_type(TestFixture::id(from)), vertex_type(TestFixture::id(to))),
+                      reachable);
+            if (reachable)
+            {
+                ASSERT_EQ(targeted.get_distances()[target], full.get_distances()[target]);
+            }
+
+            ASSERT_EQ(targeted.search_bidirectional(vertex_type(TestFixture::id(from)), vertex_type(TestFixture::id(to))),
+                      reachable);
+            if (!reachable)
+            {
+                continue;
+            }
+
+            // stitched path follows arcs and has shortest length
+            ASSERT_EQ(targeted.get_distances()[target], full.get_distances()[target]);
+            int length = 0;
+            for (int current = target; targeted.get_parents()[current] != current; current = targeted.get_parents()[current])
+            {
+                int parent = targeted.get_parents()[current];
+                bool isArc = false;
+                for (int arc = list.Begin(parent); arc < list.End(parent); ++arc)
+                {
+                    isArc = isArc || (list.Target(arc) == current);
+                }
+                ASSERT_TRUE(isArc);
+                ++length;
+            }
+            ASSERT_EQ(length, full.get_distances()[target]);
+        }
+    }
+
+    // early exit leaves far vertices undiscovered
+    targeted.search(vertex_type(TestFixture::id(100)), vertex_type(TestFixture::id(101)));
+    ASSERT_EQ(targeted.get_parents()[list.GetHandle(vertex_type(TestFixture::id(105)))], -1);
+}
+
+
+
+// One instance answers many queries; every result matches a fresh object
+TYPED_TEST(BfsTest, ReusedWorkspaceMatchesFreshObject)
+{
+    using vertex_type = typename TestFixture::vertex_type;
+
+    algorithm::bfs<TypeParam> reused(&this->graph_);
+    const auto& list = reused.get_snapshot();
+
+    for (int round = 0; round < 200; ++round)
+    {
+        int from = (round * 37) % (this->count_ + 10);
+        int to = (round * 11 + 5) % (this->count_ + 10);
+
+        algorithm::bfs<TypeParam> fresh(&this->graph_);
+        if (round % 3 == 0)
+        {
+            reused.run(vertex_type(TestFixture::id(from)));
+            fresh.run(vertex_type(TestFixture::id(from)));
+        }
+        else if (round % 3 == 1)
+        {
+            reused.search(vertex_type(TestFixture::id(from)), vertex_type(TestFixture::id(to)));
+            fresh.search(vertex_type(TestFixture::id(from)), vertex_type(TestFixture::id(to)));
+        }
+        else
+        {
+            reused.search_bidirectional(vertex_type(TestFixture::id(from)), vertex_type(TestFixture::id(to)));
+            fresh.search_bidirectional(vertex_type(TestFixture::id(from)), vertex_type(TestFixture::id(to)));
+        }
+
+        // single entry accessors see the current run only
+        for (int handle = 0; handle < list.Size(); ++handle)
+        {
+            ASSERT_EQ(reused.get_parent(handle), fresh.get_parents()[handle]);
+            ASSERT_EQ(reused.get_distance(handle), fresh.get_distances()[handle]);
+        }
+
+        if (round % 10 == 0)
+        {
+            ASSERT_EQ(reused.get_parents(), fresh.get_parents());
+            ASSERT_EQ(reused.get_distances(), fresh.get_distances());
+            ASSERT_EQ(reused.get_order(), fresh.get_order());
+            ASSERT_EQ(reused.get(), fresh.get());
+        }
+    }
+}
+
+
+
+// Lazy range yields queue BFS order and expands only what was consumed
+TYPED_TEST(BfsTest, RangeYieldsDiscoveryOrderLazily)
+{
+    using vertex_type = typename TestFixture::vertex_type;
+
+    algorithm::bfs<TypeParam> full(&this->graph_);
+    full.run(vertex_type(TestFixture::id(42)));
+    const auto& order = full.get_order();
+
+    algorithm::bfs<TypeParam> lazy(&this->graph_);
+    int index = 0;
+    for (const auto& step : lazy.range(vertex_type(TestFixture::id(42))))
+    {
+        ASSERT_EQ(order[step.vertex], index++);
+        ASSERT_EQ(step.parent, full.get_parents()[step.vertex]);
+        ASSERT_EQ(step.depth, full.get_distances()[step.vertex]);
+    }
+    ASSERT_EQ(index, this->count_ + 10);
+
+    // stop after root: only root's children were discovered
+    const auto& list = lazy.get_snapshot();
+    int root = list.GetHandle(vertex_type(TestFixture::id(42)));
+    for (const auto& step : lazy.range(vertex_type(TestFixture::id(42))))
+    {
+        ASSERT_EQ(step.vertex, root);
+        break;
+    }
+    ASSERT_EQ(lazy.get_parent(root), root);
+    for (int handle = 0; handle < list.Size(); ++handle)
+    {
+        ASSERT_EQ(lazy.get_parent(handle) != -1, full.get_distances()[handle] == 0);
+    }
+
+    // explicit filter, directed tail yields one vertex per level
+    int visited = 0;
+    for (const auto& step : lazy.range(vertex_type(TestFixture::id(this->count_ + 5)), algorithm::policy::all_arcs()))
+    {
+        ASSERT_EQ(step.depth, visited++);
+    }
+    ASSERT_EQ(visited, 5);
+}
+
+
+
+// Prefetch lookahead is a hint only, results do not depend on it
+TYPED_TEST(BfsTest, PrefetchDistanceDoesNotChangeResults)
+{
+    using vertex_type = typename TestFixture::vertex_type;
+
+    algorithm::bfs<TypeParam> reference(&this->graph_);
+    algorithm::bfs<TypeParam> tuned(&this->graph_);
+    reference.set_prefetch_distance(0);
+
+    for (int distance : {1, 3, 64})
+    {
+        tuned.set_prefetch_distance(distance);
+        for (auto mode : {algorithm::traits::bfs_mode::queue,
+                          algorithm::traits::bfs_mode::direction_optimizing})
+        {
+            reference.run(vertex_type(TestFixture::id(7)), mode);
+            tuned.run(vertex_type(TestFixture::id(7)), mode);
+
+            ASSERT_EQ(tuned.get_parents(), reference.get_parents());
+            ASSERT_EQ(tuned.get_order(), reference.get_order());
+        }
+    }
+}
+
+
+
+// Searches run on a reordered snapshot; depths follow vertices, not handles
+TYPED_TEST(BfsTest, ReorderedSnapshotMatchesGraph)
+{
+    using vertex_type = typename TestFixture::vertex_type;
+
+    algorithm::bfs<TypeParam> reference(&this->graph_);
+    reference.run(vertex_type(TestFixture::id(3)));
+    const auto& list = reference.get_snapshot();
+
+    for (auto strategy : {implementation::traits::vertex_order::degree,
+                          implementation::traits::vertex_order::bfs,
+                          implementation::traits::vertex_order::reverse_cuthill_mckee})
+    {
+        algorithm::bfs<TypeParam> reordered(implementation::reorder(list, strategy));
+        ASSERT_EQ(reordered.get_graph(), nullptr);
+
+        reordered.run(vertex_type(TestFixture::id(3)));
+        const auto& snapshot = reordered.get_snapshot();
+        for (int handle = 0; handle < snapshot.Size(); ++handle)
+        {
+            int original = list.GetHandle(snapshot.GetVertex(handle));
+            ASSERT_EQ(reordered.get_distances()[handle], reference.get_distances()[original]);
+        }
+
+        // no graph edges to read
+        ASSERT_THROW(reordered.run(vertex_type(TestFixture::id(3)), algorithm::policy::residual_capacity()),
+                     std::logic_error);
+    }
+}
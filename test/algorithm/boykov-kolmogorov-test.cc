@@ -0,0 +1,182 @@
+// Testing of Boykov-Kolmogorov algorithm
+
+#include "gtest/gtest.h"                                        //gtest
+#include "graph-lib/graph.hpp"                                  // helper component
+#include "graph-lib/algorithm/flow/push-relabel.hpp"            // maximum flow reference
+#include "graph-lib/algorithm/flow/grid-network.hpp"            // grid construction
+#include "graph-lib/algorithm/flow/boykov-kolmogorov.hpp"       // component to test
+#include "graph-test.hpp"                                       // shared fixture
+//
+#include <random>                                               // std::mt19937
+#include <stdexcept>                                            // std::invalid_argument
+#include <vector>
+
+
+
+
+
+template<   class id_type>
+class BoykovKolmogorovTest : public GraphTest<id_type>
+{
+protected:
+    using vertex_type   = component::Vertex<id_type>;
+};
+
+
+
+
+
+using testing::Types;
+
+typedef Types<int, char> Implementations;
+
+TYPED_TEST_SUITE(BoykovKolmogorovTest, Implementations);
+
+
+
+
+
+TYPED_TEST(BoykovKolmogorovTest, SmallNetwork)
+{
+    using vertex_type = typename TestFixture::vertex_type;
+
+    auto graph = TestFixture::small_network();
+
+    algorithm::boykov_kolmogorov<TypeParam> solver(&graph);
+    solver.run(vertex_type(TestFixture::id(1)), vertex_type(TestFixture::id(4)));
+    ASSERT_EQ(solver.get(), 5);
+    ASSERT_EQ(solver.get_min_cut().capacity, 5);
+    ASSERT_EQ(solver.get_flow(vertex_type(TestFixture::id(1)), vertex_type(TestFixture::id(2))), 3);
+
+    solver.run(vertex_type(TestFixture::id(4)), vertex_type(TestFixture::id(1)));
+    ASSERT_EQ(solver.get(), 0);
+    solver.run(vertex_type(TestFixture::id(2)), vertex_type(TestFixture::id(2)));
+    ASSERT_EQ(solver.get(), 0);
+    ASSERT_TRUE(solver.get_min_cut().source_side.empty());
+}
+
+
+
+// Many orphans per augmentation; value and cut agree with push-relabel
+TYPED_TEST(BoykovKolmogorovTest, MatchesPushRelabel)
+{
+    using vertex_type = typename TestFixture::vertex_type;
+
+    const int size = 50;
+    std::mt19937 generator(17);
+    std::uniform_int_distribution<int> pick(0, size - 1);
+
+    for (int round = 0; round < 10; ++round)
+    {
+        auto graph = TestFixture::random_network(size, 6 * size, 17 + round);
+
+        algorithm::push_relabel<TypeParam> reference(&graph);
+        algorithm::boykov_kolmogorov<TypeParam> solver(&graph);
+        for (int pair = 0; pair < 5; ++pair)
+        {
+            vertex_type source(TestFixture::id(pick(generator)));
+            vertex_type sink(TestFixture::id(pick(generator)));
+
+            reference.run(source, sink);
+            solver.run(source, sink);
+            ASSERT_EQ(solver.get(), reference.get());
+            if (source.Id() != sink.Id())
+            {
+                ASSERT_EQ(solver.get_min_cut().capacity, reference.get());
+            }
+        }
+    }
+}
+
+
+
+// Grid snapshot built directly equals the one taken from an AddEdge graph
+TEST(BoykovKolmogorovGridTest, GridNetworkMatchesGraph)
+{
+    const int rows = 23;
+    const int columns = 17;
+    const int pixels = rows * columns;
+
+    std::mt19937 generator(19);
+    std::uniform_int_distribution<int> terminal(0, 30);
+    std::vector<int> sourceCapacities(pixels);
+    std::vector<int> sinkCapacities(pixels);
+    for (int pixel = 0; pixel < pixels; ++pixel)
+    {
+        sourceCapacities[pixel] = (terminal(generator) > 20) ? terminal(generator) : 0;
+        sinkCapacities[pixel] = (terminal(generator) > 20) ? terminal(generator) : 0;
+    }
+    auto neighbourCapacity = [](int from, int to)
+    {
+        return (from * 7 + to * 13) % 9;
+    };
+
+    for (auto connectivity : {algorithm::traits::grid_connectivity::four,
+                              algorithm::traits::grid_connectivity::eight})
+    {
+        auto list = algorithm::make_grid_network(rows, columns, connectivity,
+                                                 sourceCapacities, sinkCapacities, neighbourCapacity);
+
+        // same network through AddEdge, in the same arc order
+        graph::Graph<int> graph;
+        for (int id = 0; id < pixels + 2; ++id)
+        {
+            graph.AddVertex(id);
+        }
+        for (int vertex = 0; vertex < list.Size(); ++vertex)
+        {
+            for (int arc = list.Begin(vertex); arc < list.End(vertex); ++arc)
+            {
+                graph.AddEdge(list.GetVertex(vertex).Id(), list.GetVertex(list.Target(arc)).Id(),
+                              component::traits::edge_direction::one_two, 1, list.Capacity(arc));
+            }
+        }
+
+        int expectedArcs = 0;
+        for (int row = 0; row < rows; ++row)
+        {
+            for (int column = 0; column < columns; ++column)
+            {
+                for (int nextRow = row - 1; nextRow <= row + 1; ++nextRow)
+                {
+                    for (int nextColumn = column - 1; nextColumn <= column + 1; ++nextColumn)
+                    {
+                        bool diagonal = (nextRow != row) && (nextColumn != column);
+                        if ((nextRow < 0) || (nextRow >= rows) || (nextColumn < 0) || (nextColumn >= columns) ||
+                            ((nextRow == row) && (nextColumn == column)) ||
+                            (diagonal && (connectivity == algorithm::traits::grid_connectivity::four)))
+                        {
+                            continue;
+                        }
+                        expectedArcs += (neighbourCapacity(row * columns + column, nextRow * columns + nextColumn) > 0);
+                    }
+                }
+            }
+        }
+        for (int pixel = 0; pixel < pixels; ++pixel)
+        {
+            expectedArcs += (sourceCapacities[pixel] > 0) + (sinkCapacities[pixel] > 0);
+        }
+        ASSERT_EQ(list.EdgeCount(), expectedArcs);
+
+        const component::Vertex<int> source(pixels);
+        const component::Vertex<int> sink(pixels + 1);
+
+        algorithm::push_relabel<int> reference(&graph);
+        reference.run(source, sink);
+
+        algorithm::boykov_kolmogorov<int> fromGrid(std::move(list));
+        fromGrid.run(source, sink);
+        ASSERT_EQ(fromGrid.get(), reference.get());
+        ASSERT_EQ(fromGrid.get_min_cut().capacity, reference.get());
+        ASSERT_EQ(fromGrid.get_graph(), nullptr);
+
+        algorithm::boykov_kolmogorov<int> fromGraph(&graph);
+        fromGraph.run(source, sink);
+        ASSERT_EQ(fromGraph.get(), reference.get());
+    }
+
+    ASSERT_THROW(algorithm::make_grid_network(2, 2, algorithm::traits::grid_connectivity::four,
+                                              sourceCapacities, sinkCapacities, neighbourCapacity),
+                 std::invalid_argument);
+}
@@ -0,0 +1,323 @@
+// Testing of DFS algorithm
+
+#include "gtest/gtest.h"                                        //gtest
+#include "graph-lib/graph.hpp"                                  // helper component
+#include "graph-lib/algorithm/traversal/dfs.hpp"                // component to test
+#include "graph-test.hpp"                                       // shared fixture
+//
+#include <vector>                                               //
+
+
+
+
+
+template<   class id_type>
+class DfsTest : public GraphTest<id_type>
+{
+protected:
+    using vertex_type   = component::Vertex<id_type>;
+    using list_type     = implementation::CompressedList<id_type>;
+    using GraphTest<id_type>::id;
+
+    //required functions
+    void    SetUp()     override
+    {
+        // ring plus chords in both directions, and a separate directed pair
+        count_ = 100;
+
+        for (int i = 0; i < count_ + 2; ++i)
+        {
+            graph_.AddVertex(id(i));
+        }
+        for (int i = 0; i < count_; ++i)
+        {
+            graph_.AddEdge(id(i), id((i + 1) % count_),
+                           component::traits::edge_direction::one_two);
+            graph_.AddEdge(id(i), id((i * 7 + 3) % count_),
+                           component::traits::edge_direction::one_two);
+            graph_.AddEdge(id(i), id((i * 13 + 5) % count_));
+        }
+        graph_.AddEdge(id(count_), id(count_ + 1),
+                       component::traits::edge_direction::one_two);
+    }
+
+    void    TearDown()  override
+    {   }
+
+    // recursive reference: parents, pre-order and post-order indices
+    struct reference
+    {
+        explicit reference(const list_type& list) : list_(list),
+                                                    parents(list.Size(), -1),
+                                                    order(list.Size(), -1),
+                                                    finish(list.Size(), -1)
+        {   }
+
+        void visit(int parent, int current)
+        {
+            parents[current] = parent;
+            order[current] = discovered_++;
+            for (int arc = list_.Begin(current); arc < list_.End(current); ++arc)
+            {
+                if (parents[list_.Target(arc)] == -1)
+                {
+                    visit(current, list_.Target(arc));
+                }
+            }
+            finish[current] = finished_++;
+        }
+
+        const list_type& list_;
+        std::vector<int> parents;
+        std::vector<int> order;
+        std::vector<int> finish;
+        int discovered_ = 0;
+        int finished_ = 0;
+    };
+
+    int count_;
+    graph::Graph<id_type> graph_;
+};
+
+
+
+
+
+using testing::Types;
+
+typedef Types<int, char> Implementations;
+
+TYPED_TEST_SUITE(DfsTest, Implementations);
+
+
+
+
+
+TYPED_TEST(DfsTest, MatchesRecursiveOrder)
+{
+    using vertex_type = typename TestFixture::vertex_type;
+
+    algorithm::dfs<TypeParam> dfsObj(&this->graph_);
+    dfsObj.run(vertex_type(TestFixture::id(0)));
+
+    const auto& list = dfsObj.get_snapshot();
+    typename TestFixture::reference expected(list);
+    int root = list.GetHandle(vertex_type(TestFixture::id(0)));
+    expected.visit(root, root);
+
+    ASSERT_EQ(dfsObj.get_parents(), expected.parents);
+    ASSERT_EQ(dfsObj.get_order(), expected.order);
+    ASSERT_EQ(dfsObj.get_finish(), expected.finish);
+
+    // directed pair is not reachable
+    ASSERT_EQ(dfsObj.get().at(vertex_type(TestFixture::id(this->count_))),
+              vertex_type::invalidInstance_);
+
+    // forest covers every vertex, pair forms its own tree
+    dfsObj.run();
+    int pair = list.GetHandle(vertex_type(TestFixture::id(this->count_)));
+    ASSERT_EQ(dfsObj.get_parents()[pair], pair);
+    ASSERT_EQ(dfsObj.get_parents()[pair + 1], pair);
+    ASSERT_EQ(dfsObj.get_finish()[pair], this->count_ + 1);
+}
+
+
+
+TYPED_TEST(DfsTest, ClassifiesEdges)
+{
+    using vertex_type = typename TestFixture::vertex_type;
+    using traits_type = algorithm::traits::edge_class;
+
+    // 1 -> 2 -> 3 -> 1, 1 -> 3, 1 -> 4 -> 3
+    graph::Graph<TypeParam> graph;
+    for (int i = 1; i <= 4; ++i)
+    {
+        graph.AddVertex(TestFixture::id(i));
+    }
+    const auto one_two = component::traits::edge_direction::one_two;
+    graph.AddEdge(TestFixture::id(1), TestFixture::id(2), one_two);
+    graph.AddEdge(TestFixture::id(1), TestFixture::id(3), one_two);
+    graph.AddEdge(TestFixture::id(1), TestFixture::id(4), one_two);
+    graph.AddEdge(TestFixture::id(2), TestFixture::id(3), one_two);
+    graph.AddEdge(TestFixture::id(3), TestFixture::id(1), one_two);
+    graph.AddEdge(TestFixture::id(4), TestFixture::id(3), one_two);
+
+    algorithm::dfs<TypeParam> dfsObj(&graph);
+    dfsObj.run(vertex_type(TestFixture::id(1)));
+
+    const auto& list = dfsObj.get_snapshot();
+    auto arcClass = [&](int from, int to)
+    {
+        int source = list.GetHandle(vertex_type(TestFixture::id(from)));
+        int target = list.GetHandle(vertex_type(TestFixture::id(to)));
+        for (int arc = list.Begin(source); arc < list.End(source); ++arc)
+        {
+            if (list.Target(arc) == target)
+            {
+                return dfsObj.get_edge_classes()[arc];
+            }
+        }
+        return traits_type::unexplored;
+    };
+
+    ASSERT_EQ(arcClass(1, 2), traits_type::tree);
+    ASSERT_EQ(arcClass(2, 3), traits_type::tree);
+    ASSERT_EQ(arcClass(3, 1), traits_type::back);
+    ASSERT_EQ(arcClass(1, 3), traits_type::forward);
+    ASSERT_EQ(arcClass(1, 4), traits_type::tree);
+    ASSERT_EQ(arcClass(4, 3), traits_type::cross);
+}
+
+
+
+TEST(DfsChainTest, DeepChainDoesNotRecurse)
+{
+    // far deeper than a recursive implementation survives
+    const int length = 300000;
+
+    graph::Graph<int> graph;
+    for (int i = 0; i < length; ++i)
+    {
+        graph.AddVertex(i);
+    }
+    for (int i = 0; i + 1 < length; ++i)
+    {
+        graph.AddEdge(i, i + 1, component::traits::edge_direction::one_two);
+    }
+
+    algorithm::dfs<int> dfsObj(&graph);
+    dfsObj.run(component::Vertex<int>(0));
+
+    const auto& list = dfsObj.get_snapshot();
+    int last = list.GetHandle(component::Vertex<int>(length - 1));
+    ASSERT_EQ(dfsObj.get_distances()[last], length - 1);
+    ASSERT_EQ(dfsObj.get_finish()[last], 0);
+}
+
+
+
+TYPED_TEST(DfsTest, StopsAtTarget)
+{
+    using vertex_type = typename TestFixture::vertex_type;
+
+    algorithm::dfs<TypeParam> dfsObj(&this->graph_);
+    const auto& list = dfsObj.get_snapshot();
+    int target = list.GetHandle(vertex_type(TestFixture::id(50)));
+
+    dfsObj.run(vertex_type(TestFixture::id(0)), algorithm::policy::all_arcs(),
+               algorithm::policy::null_visitor(), algorithm::policy::stop_at{target});
+
+    // path to target stays on the stack, unfinished
+    ASSERT_NE(dfsObj.get_parents()[target], -1);
+    for (int current = target; dfsObj.get_parents()[current] != current; current = dfsObj.get_parents()[current])
+    {
+        ASSERT_EQ(dfsObj.get_finish()[current], -1);
+    }
+
+    // full run discovers more
+    int reached = 0;
+    for (int parent : dfsObj.get_parents())
+    {
+        reached += (parent != -1);
+    }
+    dfsObj.run(vertex_type(TestFixture::id(0)));
+    int all = 0;
+    for (int parent : dfsObj.get_parents())
+    {
+        all += (parent != -1);
+    }
+    ASSERT_LE(reached, all);
+    ASSERT_EQ(all, this->count_);
+}
+
+
+
+// Rerun on the same instance forgets marks, classes and finish indices
+TYPED_TEST(DfsTest, ReusedWorkspaceMatchesFreshObject)
+{
+    using vertex_type = typename TestFixture::vertex_type;
+
+    algorithm::dfs<TypeParam> reused(&this->graph_);
+
+    for (int root : {0, 17, 100, 42, 100, 0})
+    {
+        algorithm::dfs<TypeParam> fresh(&this->graph_);
+        reused.run(vertex_type(TestFixture::id(root)));
+        fresh.run(vertex_type(TestFixture::id(root)));
+
+        ASSERT_EQ(reused.get_parents(), fresh.get_parents());
+        ASSERT_EQ(reused.get_distances(), fresh.get_distances());
+        ASSERT_EQ(reused.get_order(), fresh.get_order());
+        ASSERT_EQ(reused.get_finish(), fresh.get_finish());
+        ASSERT_EQ(reused.get_edge_classes(), fresh.get_edge_classes());
+    }
+
+    // forest run after a single root run
+    algorithm::dfs<TypeParam> fresh(&this->graph_);
+    reused.run();
+    fresh.run();
+    ASSERT_EQ(reused.get_finish(), fresh.get_finish());
+    ASSERT_EQ(reused.get_edge_classes(), fresh.get_edge_classes());
+}
+
+
+
+// Lazy range yields pre-order; breaking early leaves the rest unexplored
+TYPED_TEST(DfsTest, RangeYieldsPreOrderLazily)
+{
+    using vertex_type = typename TestFixture::vertex_type;
+
+    algorithm::dfs<TypeParam> full(&this->graph_);
+    full.run(vertex_type(TestFixture::id(0)));
+
+    algorithm::dfs<TypeParam> lazy(&this->graph_);
+    int index = 0;
+    for (const auto& step : lazy.range(vertex_type(TestFixture::id(0))))
+    {
+        ASSERT_EQ(full.get_order()[step.vertex], index++);
+        ASSERT_EQ(step.parent, full.get_parents()[step.vertex]);
+        ASSERT_EQ(step.depth, full.get_distances()[step.vertex]);
+    }
+    ASSERT_EQ(lazy.get_finish(), full.get_finish());
+    ASSERT_EQ(lazy.get_edge_classes(), full.get_edge_classes());
+
+    // stop at depth 10: only yielded vertices were discovered
+    int discovered = 0;
+    for (const auto& step : lazy.range(vertex_type(TestFixture::id(0))))
+    {
+        ++discovered;
+        if (step.depth == 10)
+        {
+            break;
+        }
+    }
+    int labeled = 0;
+    for (int parent : lazy.get_parents())
+    {
+        labeled += (parent != -1);
+    }
+    ASSERT_EQ(labeled, discovered);
+}
+
+
+
+// Prefetch lookahead is a hint only, results do not depend on it
+TYPED_TEST(DfsTest, PrefetchDistanceDoesNotChangeResults)
+{
+    using vertex_type = typename TestFixture::vertex_type;
+
+    algorithm::dfs<TypeParam> reference(&this->graph_);
+    algorithm::dfs<TypeParam> tuned(&this->graph_);
+    reference.set_prefetch_distance(0);
+    reference.run(vertex_type(TestFixture::id(0)));
+
+    for (int distance : {1, 2, 64})
+    {
+        tuned.set_prefetch_distance(distance);
+        tuned.run(vertex_type(TestFixture::id(0)));
+
+        ASSERT_EQ(tuned.get_order(), reference.get_order());
+        ASSERT_EQ(tuned.get_finish(), reference.get_finish());
+        ASSERT_EQ(tuned.get_edge_classes(), reference.get_edge_classes());
+    }
+}
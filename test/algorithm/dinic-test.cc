@@ -0,0 +1,318 @@
+// Testing of Dinic algorithm
+
+#include "gtest/gtest.h"                                        //gtest
+#include "graph-lib/graph.hpp"                                  // helper component
+#include "graph-lib/algorithm/flow/push-relabel.hpp"            // maximum flow reference
+#include "graph-lib/implementation/reordering.hpp"              // implementation::reorder
+#include "graph-lib/algorithm/flow/dinic.hpp"                   // component to test
+#include "graph-test.hpp"                                       // shared fixture
+//
+#include <algorithm>                                            // std::min, std::find
+#include <random>                                               // std::mt19937
+
+
+
+
+
+template<   class id_type>
+class DinicTest : public GraphTest<id_type>
+{
+protected:
+    using vertex_type   = component::Vertex<id_type>;
+    using GraphTest<id_type>::id;
+
+    int     max_flow(graph::Graph<id_type>& graph, int source, int sink)
+    {
+        algorithm::dinic<id_type> dinicObj(&graph);
+        dinicObj.run(vertex_type(id(source)), vertex_type(id(sink)));
+        return dinicObj.get();
+    }
+};
+
+
+
+
+
+using testing::Types;
+
+typedef Types<int, char> Implementations;
+
+TYPED_TEST_SUITE(DinicTest, Implementations);
+
+
+
+
+
+TYPED_TEST(DinicTest, SmallNetwork)
+{
+    auto graph = TestFixture::small_network();
+
+    ASSERT_EQ(this->max_flow(graph, 1, 4), 5);
+    ASSERT_EQ(this->max_flow(graph, 4, 1), 0);
+    ASSERT_EQ(this->max_flow(graph, 2, 2), 0);
+}
+
+
+
+// Both middle arcs saturate; last level BFS stops in front of them
+TYPED_TEST(DinicTest, MinCutFromLastPhase)
+{
+    using vertex_type = typename TestFixture::vertex_type;
+
+    graph::Graph<TypeParam> graph;
+    for (int i = 0; i <= 4; ++i)
+    {
+        graph.AddVertex(TestFixture::id(i));
+    }
+    this->arc(graph, 0, 1, 4);
+    this->arc(graph, 0, 2, 4);
+    this->arc(graph, 1, 3, 1);
+    this->arc(graph, 2, 3, 2);
+    this->arc(graph, 3, 4, 10);
+
+    algorithm::dinic<TypeParam> dinicObj(&graph);
+    dinicObj.run(vertex_type(TestFixture::id(0)), vertex_type(TestFixture::id(4)));
+    ASSERT_EQ(dinicObj.get(), 3);
+
+    auto cut = dinicObj.get_min_cut();
+    ASSERT_EQ(cut.capacity, 3);
+    ASSERT_EQ(cut.source_side.size(), 3u);
+    ASSERT_EQ(cut.source_side[0], vertex_type(TestFixture::id(0)));
+    ASSERT_EQ(cut.edges.size(), 2u);
+    for (const auto& edge : cut.edges)
+    {
+        ASSERT_EQ(edge.second, vertex_type(TestFixture::id(3)));
+    }
+
+    dinicObj.run(vertex_type(TestFixture::id(2)), vertex_type(TestFixture::id(2)));
+    cut = dinicObj.get_min_cut();
+    ASSERT_TRUE(cut.source_side.empty());
+    ASSERT_TRUE(cut.edges.empty());
+    ASSERT_EQ(cut.capacity, 0);
+}
+
+
+
+// First path 0 -> 1 -> 2 -> 5 must be partly undone over reverse arc 2 -> 1
+TYPED_TEST(DinicTest, CancelsFlowOverReverseArcs)
+{
+    using vertex_type = typename TestFixture::vertex_type;
+
+    graph::Graph<TypeParam> graph;
+    for (int i = 0; i <= 5; ++i)
+    {
+        graph.AddVertex(TestFixture::id(i));
+    }
+    this->arc(graph, 0, 1, 1);
+    this->arc(graph, 1, 4, 3);
+    this->arc(graph, 3, 4, 1);
+    this->arc(graph, 0, 3, 2);
+    this->arc(graph, 2, 5, 3);
+    this->arc(graph, 4, 5, 1);
+    this->arc(graph, 1, 2, 1);
+
+    algorithm::dinic<TypeParam> dinicObj(&graph);
+    dinicObj.run(vertex_type(TestFixture::id(0)), vertex_type(TestFixture::id(5)));
+    ASSERT_EQ(dinicObj.get(), 2);
+    ASSERT_EQ(dinicObj.get_min_cut().capacity, 2);
+    TestFixture::check_feasible(dinicObj, 0, 5);
+}
+
+
+
+// Random networks: flow and cut capacity match push-relabel, cut separates terminals
+TYPED_TEST(DinicTest, MinCutMatchesMaximumFlow)
+{
+    using vertex_type = typename TestFixture::vertex_type;
+
+    const int size = 40;
+    std::mt19937 generator(23);
+    std::uniform_int_distribution<int> pick(0, size - 1);
+
+    for (int round = 0; round < 10; ++round)
+    {
+        auto graph = TestFixture::random_network(size, 5 * size, 23 + round);
+
+        algorithm::push_relabel<TypeParam> reference(&graph);
+        algorithm::dinic<TypeParam> solver(&graph);
+        for (int pair = 0; pair < 5; ++pair)
+        {
+            int source = pick(generator);
+            int sink = pick(generator);
+            if (source == sink)
+            {
+                continue;
+            }
+
+            reference.run(vertex_type(TestFixture::id(source)), vertex_type(TestFixture::id(sink)));
+            solver.run(vertex_type(TestFixture::id(source)), vertex_type(TestFixture::id(sink)));
+            ASSERT_EQ(solver.get(), reference.get());
+            TestFixture::check_feasible(solver, source, sink);
+
+            auto cut = solver.get_min_cut();
+            ASSERT_EQ(cut.capacity, reference.get());
+
+            const auto& side = cut.source_side;
+            ASSERT_NE(std::find(side.begin(), side.end(), vertex_type(TestFixture::id(source))), side.end());
+            ASSERT_EQ(std::find(side.begin(), side.end(), vertex_type(TestFixture::id(sink))), side.end());
+            for (const auto& edge : cut.edges)
+            {
+                ASSERT_NE(std::find(side.begin(), side.end(), edge.first), side.end());
+                ASSERT_EQ(std::find(side.begin(), side.end(), edge.second), side.end());
+            }
+        }
+    }
+}
+
+
+
+// Flow lives in solver overlays: graph stays untouched, solvers do not interfere
+TYPED_TEST(DinicTest, SolversShareConstGraph)
+{
+    using vertex_type = typename TestFixture::vertex_type;
+
+    auto graph = TestFixture::small_network();
+
+    const graph::Graph<TypeParam>& shared = graph;
+    algorithm::dinic<TypeParam> first(&shared);
+    algorithm::dinic<TypeParam> second(&shared);
+    first.run(vertex_type(TestFixture::id(1)), vertex_type(TestFixture::id(4)));
+    second.run(vertex_type(TestFixture::id(2)), vertex_type(TestFixture::id(3)));
+
+    ASSERT_EQ(first.get(), 5);
+    ASSERT_EQ(second.get(), 1);
+    ASSERT_EQ(first.get_flow(vertex_type(TestFixture::id(1)), vertex_type(TestFixture::id(2))), 3);
+    ASSERT_EQ(second.get_flow(vertex_type(TestFixture::id(1)), vertex_type(TestFixture::id(2))), 0);
+    ASSERT_EQ(second.get_flow(vertex_type(TestFixture::id(2)), vertex_type(TestFixture::id(3))), 1);
+
+    for (auto tuple = shared.cbegin(); tuple != shared.cend(); ++tuple)
+    {
+        for (const auto& edge : tuple->second)
+        {
+            ASSERT_EQ(edge.GetFlow(), 0);
+        }
+    }
+}
+
+
+
+// Many augmenting paths per phase: current arcs must move past saturated arcs
+TYPED_TEST(DinicTest, CompleteBipartiteUnitNetwork)
+{
+    // source 0, left 1..left, right left+1..left+right, sink left+right+1
+    const int left = 12;
+    const int right = 9;
+    const int sink = left + right + 1;
+
+    graph::Graph<TypeParam> graph;
+    for (int i = 0; i <= sink; ++i)
+    {
+        graph.AddVertex(TestFixture::id(i));
+    }
+    for (int l = 1; l <= left; ++l)
+    {
+        this->arc(graph, 0, l, 1);
+        for (int r = left + 1; r <= left + right; ++r)
+        {
+            this->arc(graph, l, r, 1);
+        }
+    }
+    for (int r = left + 1; r <= left + right; ++r)
+    {
+        this->arc(graph, r, sink, 1);
+    }
+
+    ASSERT_EQ(this->max_flow(graph, 0, sink), std::min(left, right));
+}
+
+
+
+// Dead-end branches hang off every path vertex; they must be pruned, not rescanned
+TYPED_TEST(DinicTest, DeadEndsArePruned)
+{
+    // paths 0 -> p -> p + 1 -> ... -> sink, each path vertex feeds a dead end
+    const int paths = 4;
+    const int length = 8;
+    const int sink = 1;
+
+    graph::Graph<TypeParam> graph;
+    int next = 2;
+    graph.AddVertex(TestFixture::id(0));
+    graph.AddVertex(TestFixture::id(sink));
+
+    int expected = 0;
+    for (int p = 0; p < paths; ++p)
+    {
+        int previous = 0;
+        for (int step = 0; step < length; ++step)
+        {
+            int vertex = next++;
+            int deadEnd = next++;
+            graph.AddVertex(TestFixture::id(vertex));
+            graph.AddVertex(TestFixture::id(deadEnd));
+
+            // dead end listed first, so it is tried before the path
+            this->arc(graph, previous, deadEnd, 5);
+            this->arc(graph, previous, vertex, p + 1);
+            previous = vertex;
+        }
+        this->arc(graph, previous, sink, 10);
+        expected += p + 1;
+    }
+
+    ASSERT_EQ(this->max_flow(graph, 0, sink), expected);
+}
+
+
+
+// Solver built on a reordered snapshot finds the same flow and cut
+TYPED_TEST(DinicTest, ReorderedSnapshot)
+{
+    using vertex_type = typename TestFixture::vertex_type;
+
+    graph::Graph<TypeParam> graph;
+    for (int i = 0; i <= 5; ++i)
+    {
+        graph.AddVertex(TestFixture::id(i));
+    }
+    this->arc(graph, 0, 1, 4);
+    this->arc(graph, 0, 2, 3);
+    this->arc(graph, 1, 3, 2);
+    this->arc(graph, 2, 3, 5);
+    this->arc(graph, 1, 4, 2);
+    this->arc(graph, 3, 5, 4);
+    this->arc(graph, 4, 5, 3);
+
+    implementation::CompressedList<TypeParam> list(graph);
+    algorithm::dinic<TypeParam> dinicObj(
+        implementation::reorder(list, implementation::traits::vertex_order::reverse_cuthill_mckee));
+    ASSERT_EQ(dinicObj.get_graph(), nullptr);
+
+    dinicObj.run(vertex_type(TestFixture::id(0)), vertex_type(TestFixture::id(5)));
+    ASSERT_EQ(dinicObj.get(), 6);
+    ASSERT_EQ(dinicObj.get_min_cut().capacity, 6);
+    ASSERT_EQ(dinicObj.get_flow(vertex_type(TestFixture::id(3)), vertex_type(TestFixture::id(5))), 4);
+    TestFixture::check_feasible(dinicObj, 0, 5);
+}
+
+
+
+TEST(DinicChainTest, DeepPathDoesNotRecurse)
+{
+    // far deeper than a recursive blocking flow survives
+    const int length = 200000;
+
+    graph::Graph<int> graph;
+    for (int i = 0; i < length; ++i)
+    {
+        graph.AddVertex(i);
+    }
+    for (int i = 0; i + 1 < length; ++i)
+    {
+        graph.AddEdge(i, i + 1, component::traits::edge_direction::one_two, 1, 3 + (i * 7919) % 11);
+    }
+
+    algorithm::dinic<int> dinicObj(&graph);
+    dinicObj.run(component::Vertex<int>(0), component::Vertex<int>(length - 1));
+    ASSERT_EQ(dinicObj.get(), 3);
+}
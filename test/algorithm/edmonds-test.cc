@@ -0,0 +1,145 @@
+// Testing of Edmonds-Karp algorithm
+
+#include "gtest/gtest.h"                                        //gtest
+#include "graph-lib/graph.hpp"                                  // helper component
+#include "graph-lib/algorithm/flow/push-relabel.hpp"            // maximum flow reference
+#include "graph-lib/algorithm/flow/edmonds.hpp"                 // component to test
+#include "graph-test.hpp"                                       // shared fixture
+//
+#include <random>                                               // std::mt19937
+#include <vector>
+
+
+
+
+
+template<   class id_type>
+class EdmondsTest : public GraphTest<id_type>
+{
+protected:
+    using vertex_type   = component::Vertex<id_type>;
+};
+
+
+
+
+
+using testing::Types;
+
+typedef Types<int, char> Implementations;
+
+TYPED_TEST_SUITE(EdmondsTest, Implementations);
+
+const algorithm::traits::augment_mode modes[] = {algorithm::traits::augment_mode::shortest_path,
+                                                 algorithm::traits::augment_mode::capacity_scaling};
+
+
+
+
+
+TYPED_TEST(EdmondsTest, SmallNetwork)
+{
+    using vertex_type = typename TestFixture::vertex_type;
+
+    auto graph = TestFixture::small_network();
+
+    algorithm::edmonds_karp<TypeParam> solver(&graph);
+    for (auto mode : modes)
+    {
+        solver.run(vertex_type(TestFixture::id(1)), vertex_type(TestFixture::id(4)), mode);
+        ASSERT_EQ(solver.get(), 5);
+        TestFixture::check_feasible(solver, 1, 4);
+
+        solver.run(vertex_type(TestFixture::id(4)), vertex_type(TestFixture::id(1)), mode);
+        ASSERT_EQ(solver.get(), 0);
+        solver.run(vertex_type(TestFixture::id(2)), vertex_type(TestFixture::id(2)), mode);
+        ASSERT_EQ(solver.get(), 0);
+    }
+}
+
+
+
+// Parallel edges are separate arcs, each carrying its own flow
+TYPED_TEST(EdmondsTest, ParallelEdges)
+{
+    using vertex_type = typename TestFixture::vertex_type;
+
+    graph::Graph<TypeParam> graph;
+    for (int i = 0; i < 3; ++i)
+    {
+        graph.AddVertex(TestFixture::id(i));
+    }
+    this->arc(graph, 0, 1, 2);
+    this->arc(graph, 0, 1, 3);
+    this->arc(graph, 1, 2, 10);
+
+    algorithm::edmonds_karp<TypeParam> solver(&graph);
+    for (auto mode : modes)
+    {
+        solver.run(vertex_type(TestFixture::id(0)), vertex_type(TestFixture::id(2)), mode);
+        ASSERT_EQ(solver.get(), 5);
+        ASSERT_EQ(solver.get_flow(vertex_type(TestFixture::id(0)), vertex_type(TestFixture::id(1))), 5);
+    }
+}
+
+
+
+// First path 0 -> 1 -> 2 -> 5 must be partly undone over reverse arc 2 -> 1
+TYPED_TEST(EdmondsTest, CancelsFlowOverReverseArcs)
+{
+    using vertex_type = typename TestFixture::vertex_type;
+
+    graph::Graph<TypeParam> graph;
+    for (int i = 0; i <= 5; ++i)
+    {
+        graph.AddVertex(TestFixture::id(i));
+    }
+    this->arc(graph, 0, 1, 1);
+    this->arc(graph, 1, 4, 3);
+    this->arc(graph, 3, 4, 1);
+    this->arc(graph, 0, 3, 2);
+    this->arc(graph, 2, 5, 3);
+    this->arc(graph, 4, 5, 1);
+    this->arc(graph, 1, 2, 1);
+
+    algorithm::edmonds_karp<TypeParam> solver(&graph);
+    for (auto mode : modes)
+    {
+        solver.run(vertex_type(TestFixture::id(0)), vertex_type(TestFixture::id(5)), mode);
+        ASSERT_EQ(solver.get(), 2);
+        TestFixture::check_feasible(solver, 0, 5);
+    }
+}
+
+
+
+// Capacities up to a million, many scaling phases; both modes reach maximum flow
+TYPED_TEST(EdmondsTest, ScalingMatchesMaximumFlow)
+{
+    using vertex_type = typename TestFixture::vertex_type;
+
+    const int size = 40;
+    std::mt19937 generator(13);
+    std::uniform_int_distribution<int> pick(0, size - 1);
+
+    for (int round = 0; round < 10; ++round)
+    {
+        auto graph = TestFixture::random_network(size, 5 * size, 13 + round, 1000000);
+
+        algorithm::push_relabel<TypeParam> reference(&graph);
+        algorithm::edmonds_karp<TypeParam> solver(&graph);
+        for (int pair = 0; pair < 5; ++pair)
+        {
+            int source = pick(generator);
+            int sink = pick(generator);
+
+            reference.run(vertex_type(TestFixture::id(source)), vertex_type(TestFixture::id(sink)));
+            for (auto mode : modes)
+            {
+                solver.run(vertex_type(TestFixture::id(source)), vertex_type(TestFixture::id(sink)), mode);
+                ASSERT_EQ(solver.get(), reference.get());
+                TestFixture::check_feasible(solver, source, sink);
+            }
+        }
+    }
+}
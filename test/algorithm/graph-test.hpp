@@ -0,0 +1,138 @@
+// Shared fixture of algorithm tests
+
+#ifndef GRAPH_LIB_TEST_ALGORITHM_GRAPH_TEST_HPP
+#define GRAPH_LIB_TEST_ALGORITHM_GRAPH_TEST_HPP
+
+#include "gtest/gtest.h"                                        //gtest
+#include "graph-lib/graph.hpp"                                  // helper component
+//
+#include <random>                                               // std::mt19937
+#include <set>
+#include <utility>                                              // std::pair
+#include <vector>
+
+
+
+
+
+template<   class id_type>
+class GraphTest : public testing::Test
+{
+protected:
+    using vertex_type   = component::Vertex<id_type>;
+
+    // vertex id of i-th vertex; skips 32, the invalid id of char vertices
+    static id_type id(int i)
+    {
+        return static_cast<id_type>(i < 32 ? i : i + 1);
+    }
+
+    static void    arc(graph::Graph<id_type>& graph, int from, int to, int capacity, int weight = 1)
+    {
+        graph.AddEdge(id(from), id(to), component::traits::edge_direction::one_two, weight, capacity);
+    }
+
+    // 1 -> 2 (3), 1 -> 3 (2), 2 -> 4 (2), 3 -> 4 (3), 2 -> 3 (1); maximum flow 1 -> 4 is 5
+    static graph::Graph<id_type> small_network()
+    {
+        graph::Graph<id_type> graph;
+        for (int i = 1; i <= 4; ++i)
+        {
+            graph.AddVertex(id(i));
+        }
+        arc(graph, 1, 2, 3);
+        arc(graph, 1, 3, 2);
+        arc(graph, 2, 4, 2);
+        arc(graph, 3, 4, 3);
+        arc(graph, 2, 3, 1);
+        return graph;
+    }
+
+    // vertices 0 .. size - 1 and given number of random arc draws, capacities 1 .. maxCapacity,
+    // weights 1 .. maxWeight; loops and repeated arcs are skipped, so every pair has one arc at most
+    static graph::Graph<id_type> random_network(int size, int arcs, unsigned seed,
+                                                int maxCapacity = 20, int maxWeight = 1)
+    {
+        std::mt19937 generator(seed);
+        std::uniform_int_distribution<int> pick(0, size - 1);
+        std::uniform_int_distribution<int> capacity(1, maxCapacity);
+        std::uniform_int_distribution<int> weight(1, maxWeight);
+
+        graph::Graph<id_type> graph;
+        for (int i = 0; i < size; ++i)
+        {
+            graph.AddVertex(id(i));
+        }
+        std::set<std::pair<int, int>> present;
+        for (int e = 0; e < arcs; ++e)
+        {
+            int from = pick(generator);
+            int to = pick(generator);
+            if (from != to && present.emplace(from, to).second)
+            {
+                arc(graph, from, to, capacity(generator), weight(generator));
+            }
+        }
+        return graph;
+    }
+
+    // capacity matrix of a network built by random_network, 0 entries are no arc
+    static std::vector<std::vector<int>> capacities(const graph::Graph<id_type>& graph, int size)
+    {
+        std::vector<std::vector<int>> result(size, std::vector<int>(size, 0));
+        for (int from = 0; from < size; ++from)
+        {
+            for (const auto& edge : graph.GetNeighbours(vertex_type(id(from))))
+            {
+                result[from][index(edge.GetVertex(1).Id())] = edge.GetCapacity();
+            }
+        }
+        return result;
+    }
+
+    // inverse of id()
+    static int index(id_type value)
+    {
+        int i = static_cast<int>(value);
+        return i < 32 ? i : i - 1;
+    }
+
+    // flow conservation at every vertex but terminals, capacity bounds on every arc
+    template<   class solver_type>
+    static void check_feasible(const solver_type& solver, int source, int sink)
+    {
+        const auto& snapshot = solver.get_snapshot();
+        const auto& flows = solver.get_edge_flows();
+
+        std::vector<long long> balance(snapshot.Size(), 0);
+        for (int vertex = 0; vertex < snapshot.Size(); ++vertex)
+        {
+            for (int arc = snapshot.Begin(vertex); arc < snapshot.End(vertex); ++arc)
+            {
+                ASSERT_GE(flows[arc], 0);
+                ASSERT_LE(flows[arc], snapshot.Capacity(arc));
+                balance[vertex] -= flows[arc];
+                balance[snapshot.Target(arc)] += flows[arc];
+            }
+        }
+        for (int vertex = 0; vertex < snapshot.Size(); ++vertex)
+        {
+            if (vertex == snapshot.GetHandle(vertex_type(id(source))))
+            {
+                ASSERT_EQ(balance[vertex], -solver.get());
+            }
+            else if (vertex == snapshot.GetHandle(vertex_type(id(sink))))
+            {
+                ASSERT_EQ(balance[vertex], solver.get());
+            }
+            else
+            {
+                ASSERT_EQ(balance[vertex], 0);
+            }
+        }
+    }
+};
+
+
+
+#endif // GRAPH_LIB_TEST_ALGORITHM_GRAPH_TEST_HPP
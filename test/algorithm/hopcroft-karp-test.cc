@@ -0,0 +1,174 @@
+// Testing of Hopcroft-Karp algorithm
+
+#include "gtest/gtest.h"                                        //gtest
+#include "graph-lib/graph.hpp"                                  // helper component
+#include "graph-lib/algorithm/flow/push-relabel.hpp"            // maximum flow reference
+#include "graph-lib/algorithm/flow/hopcroft-karp.hpp"           // component to test
+#include "graph-test.hpp"                                       // shared fixture
+//
+#include <random>                                               // std::mt19937
+#include <set>
+#include <stdexcept>                                            // std::invalid_argument
+#include <utility>                                              // std::pair
+#include <vector>
+
+
+
+
+
+template<   class id_type>
+class HopcroftKarpTest : public GraphTest<id_type>
+{
+protected:
+    using vertex_type   = component::Vertex<id_type>;
+    using pair_type     = typename algorithm::hopcroft_karp<id_type>::pair_type;
+    using GraphTest<id_type>::id;
+
+    void    edge(graph::Graph<id_type>& graph, int from, int to)
+    {
+        graph.AddEdge(id(from), id(to), component::traits::edge_direction::none, 1, 1);
+        edges_.insert(std::make_pair(id(from), id(to)));
+        edges_.insert(std::make_pair(id(to), id(from)));
+    }
+
+    std::vector<vertex_type>    side(int first, int last)
+    {
+        std::vector<vertex_type> vertices;
+        for (int i = first; i <= last; ++i)
+        {
+            vertices.emplace_back(id(i));
+        }
+        return vertices;
+    }
+
+    // every pair is an edge from left side, no vertex is matched twice
+    void    check_matching(const std::vector<vertex_type>& left,
+                           const std::vector<pair_type>& matching)
+    {
+        std::set<id_type> leftIds;
+        for (const auto& vertex : left)
+        {
+            leftIds.insert(vertex.Id());
+        }
+
+        std::set<id_type> used;
+        for (const auto& pair : matching)
+        {
+            ASSERT_EQ(leftIds.count(pair.first.Id()), 1u);
+            ASSERT_EQ(leftIds.count(pair.second.Id()), 0u);
+            ASSERT_EQ(edges_.count(std::make_pair(pair.first.Id(), pair.second.Id())), 1u);
+            ASSERT_TRUE(used.insert(pair.first.Id()).second);
+            ASSERT_TRUE(used.insert(pair.second.Id()).second);
+        }
+    }
+
+    // undirected edges added so far, both orientations
+    std::set<std::pair<id_type, id_type>> edges_;
+};
+
+
+
+
+
+using testing::Types;
+
+typedef Types<int, char> Implementations;
+
+TYPED_TEST_SUITE(HopcroftKarpTest, Implementations);
+
+
+
+
+
+TYPED_TEST(HopcroftKarpTest, SmallGraph)
+{
+    using vertex_type = typename TestFixture::vertex_type;
+
+    // left 1-3, right 4-6; greedy takes 1-4, 2 has to move over
+    graph::Graph<TypeParam> graph;
+    for (int i = 1; i <= 7; ++i)
+    {
+        graph.AddVertex(TestFixture::id(i));
+    }
+    this->edge(graph, 1, 4);
+    this->edge(graph, 1, 5);
+    this->edge(graph, 2, 4);
+    this->edge(graph, 3, 5);
+    this->edge(graph, 3, 6);
+
+    const auto left = this->side(1, 3);
+    algorithm::hopcroft_karp<TypeParam> matcher(&graph);
+    matcher.run(left);
+    ASSERT_EQ(matcher.get(), 3);
+    ASSERT_EQ(matcher.get_matching().size(), 3u);
+    this->check_matching(left, matcher.get_matching());
+
+    // right side as left: same size, pairs reversed
+    matcher.run(this->side(4, 6));
+    ASSERT_EQ(matcher.get(), 3);
+    ASSERT_EQ(matcher.get_matching().front().second, vertex_type(TestFixture::id(2)));
+
+    ASSERT_THROW(matcher.run(this->side(1, 4)), std::invalid_argument);
+    ASSERT_THROW(matcher.run({vertex_type(TestFixture::id(1)), vertex_type(TestFixture::id(1))}),
+                 std::invalid_argument);
+    ASSERT_THROW(matcher.run({vertex_type(TestFixture::id(9))}), std::out_of_range);
+
+    // isolated vertex 7 stays free
+    matcher.run({vertex_type(TestFixture::id(7))});
+    ASSERT_EQ(matcher.get(), 0);
+    ASSERT_TRUE(matcher.get_matching().empty());
+}
+
+
+
+// Matching size equals unit capacity maximum flow through the bipartite graph
+TYPED_TEST(HopcroftKarpTest, MatchesUnitFlow)
+{
+    const int leftSize = 40;
+    const int rightSize = 35;
+    const int source = leftSize + rightSize;
+    const int sink = source + 1;
+    std::mt19937 generator(7);
+    std::uniform_int_distribution<int> pickLeft(0, leftSize - 1);
+    std::uniform_int_distribution<int> pickRight(leftSize, leftSize + rightSize - 1);
+
+    for (int density : {1, 2, 4})
+    {
+        graph::Graph<TypeParam> graph;
+        graph::Graph<TypeParam> network;
+        for (int i = 0; i < leftSize + rightSize; ++i)
+        {
+            graph.AddVertex(TestFixture::id(i));
+            network.AddVertex(TestFixture::id(i));
+        }
+        network.AddVertex(TestFixture::id(source));
+        network.AddVertex(TestFixture::id(sink));
+
+        for (int e = 0; e < density * leftSize; ++e)
+        {
+            int from = pickLeft(generator);
+            int to = pickRight(generator);
+            this->edge(graph, from, to);
+            network.AddEdge(TestFixture::id(from), TestFixture::id(to), component::traits::edge_direction::one_two, 1, 1);
+        }
+        for (int i = 0; i < leftSize; ++i)
+        {
+            network.AddEdge(TestFixture::id(source), TestFixture::id(i), component::traits::edge_direction::one_two, 1, 1);
+        }
+        for (int i = leftSize; i < leftSize + rightSize; ++i)
+        {
+            network.AddEdge(TestFixture::id(i), TestFixture::id(sink), component::traits::edge_direction::one_two, 1, 1);
+        }
+
+        algorithm::push_relabel<TypeParam> reference(&network);
+        reference.run(component::Vertex<TypeParam>(TestFixture::id(source)),
+                      component::Vertex<TypeParam>(TestFixture::id(sink)));
+
+        const auto left = this->side(0, leftSize - 1);
+        algorithm::hopcroft_karp<TypeParam> matcher(&graph);
+        matcher.run(left);
+        ASSERT_EQ(matcher.get(), reference.get());
+        ASSERT_EQ(static_cast<int>(matcher.get_matching().size()), matcher.get());
+        this->check_matching(left, matcher.get_matching());
+    }
+}
@@ -0,0 +1,195 @@
+// Testing of incremental flow algorithm
+
+#include "gtest/gtest.h"                                        //gtest
+#include "graph-lib/graph.hpp"                                  // helper component
+#include "graph-lib/algorithm/flow/push-relabel.hpp"            // from scratch reference
+#include "graph-lib/algorithm/flow/incremental-flow.hpp"        // component to test
+#include "graph-test.hpp"                                       // shared fixture
+//
+#include <random>                                               // std::mt19937
+#include <stdexcept>                                            // std::out_of_range
+#include <vector>
+
+
+
+
+
+template<   class id_type>
+class IncrementalFlowTest : public GraphTest<id_type>
+{
+protected:
+    using vertex_type   = component::Vertex<id_type>;
+    using GraphTest<id_type>::id;
+    using GraphTest<id_type>::arc;
+
+    // max flow of capacity matrix solved from scratch, 0 entries are no edge
+    int     solve(const std::vector<std::vector<int>>& capacities, int source, int sink)
+    {
+        const int size = static_cast<int>(capacities.size());
+
+        graph::Graph<id_type> graph;
+        for (int i = 0; i < size; ++i)
+        {
+            graph.AddVertex(id(i));
+        }
+        for (int from = 0; from < size; ++from)
+        {
+            for (int to = 0; to < size; ++to)
+            {
+                if (capacities[from][to] > 0)
+                {
+                    arc(graph, from, to, capacities[from][to]);
+                }
+            }
+        }
+
+        algorithm::push_relabel<id_type> pushRelabelObj(&graph);
+        pushRelabelObj.run(vertex_type(id(source)), vertex_type(id(sink)));
+        return pushRelabelObj.get();
+    }
+};
+
+
+
+
+
+using testing::Types;
+
+typedef Types<int, char> Implementations;
+
+TYPED_TEST_SUITE(IncrementalFlowTest, Implementations);
+
+
+
+
+
+TYPED_TEST(IncrementalFlowTest, SmallNetwork)
+{
+    using vertex_type = typename TestFixture::vertex_type;
+
+    auto graph = TestFixture::small_network();
+
+    const vertex_type v1(TestFixture::id(1));
+    const vertex_type v2(TestFixture::id(2));
+    const vertex_type v3(TestFixture::id(3));
+    const vertex_type v4(TestFixture::id(4));
+
+    algorithm::incremental_flow<TypeParam> flowObj(&graph);
+    flowObj.run(v1, v4);
+    ASSERT_EQ(flowObj.get(), 5);
+
+    // increase: 1-2-4 carries one more
+    flowObj.set_capacity(v2, v4, 3);
+    ASSERT_EQ(flowObj.get(), 5);
+    flowObj.set_capacity(v1, v3, 3);
+    ASSERT_EQ(flowObj.get(), 6);
+
+    // decrease below flow: 2-4 loses one, 2-3-4 cannot take it over
+    flowObj.set_capacity(v2, v4, 1);
+    ASSERT_EQ(flowObj.get(), 4);
+    ASSERT_EQ(flowObj.get_flow(v2, v4), 1);
+
+    // insertion
+    flowObj.add_edge(v2, v4, 5);
+    ASSERT_EQ(flowObj.get(), 6);
+    ASSERT_EQ(flowObj.get_flow(v2, v4), 3);
+
+    ASSERT_THROW(flowObj.set_capacity(v4, v1, 1), std::out_of_range);
+    ASSERT_THROW(flowObj.add_edge(v4, v1, -1), std::invalid_argument);
+}
+
+
+
+// Insertions keep landing on one vertex, whose arcs move as its range fills up
+TYPED_TEST(IncrementalFlowTest, RepeatedInsertionsAtOneVertex)
+{
+    using vertex_type = typename TestFixture::vertex_type;
+
+    graph::Graph<TypeParam> graph;
+    for (int i = 0; i < 3; ++i)
+    {
+        graph.AddVertex(TestFixture::id(i));
+    }
+    this->arc(graph, 0, 2, 1);
+
+    vertex_type source(TestFixture::id(0));
+    vertex_type sink(TestFixture::id(1));
+    vertex_type hub(TestFixture::id(2));
+
+    algorithm::incremental_flow<TypeParam> flowObj(&graph);
+    flowObj.run(source, sink);
+    ASSERT_EQ(flowObj.get(), 0);
+
+    for (int pair = 1; pair <= 40; ++pair)
+    {
+        flowObj.add_edge(hub, sink, 1);
+        flowObj.add_edge(hub, hub, 3);
+        ASSERT_EQ(flowObj.get(), pair);
+
+        flowObj.add_edge(source, hub, 1);
+        ASSERT_EQ(flowObj.get(), pair);
+    }
+    ASSERT_EQ(flowObj.get_flow(source, hub), 40);
+    ASSERT_EQ(flowObj.get_flow(hub, sink), 40);
+
+    flowObj.run(hub, sink);
+    ASSERT_EQ(flowObj.get(), 40);
+}
+
+
+
+// Random edit sequences against solving every edited network from scratch
+TYPED_TEST(IncrementalFlowTest, MatchesSolvingFromScratch)
+{
+    using vertex_type = typename TestFixture::vertex_type;
+
+    const int size = 16;
+    std::mt19937 generator(5);
+    std::uniform_int_distribution<int> pick(0, size - 1);
+    std::uniform_int_distribution<int> capacity(0, 12);
+
+    for (int round = 0; round < 5; ++round)
+    {
+        auto graph = TestFixture::random_network(size, 3 * size, 5 + round, 13);
+        auto capacities = TestFixture::capacities(graph, size);
+        std::vector<std::vector<bool>> present(size, std::vector<bool>(size, false));
+        for (int from = 0; from < size; ++from)
+        {
+            for (int to = 0; to < size; ++to)
+            {
+                present[from][to] = capacities[from][to] > 0;
+            }
+        }
+
+        int source = pick(generator);
+        int sink = (source + 1 + pick(generator) % (size - 1)) % size;
+
+        algorithm::incremental_flow<TypeParam> flowObj(&graph);
+        flowObj.run(vertex_type(TestFixture::id(source)), vertex_type(TestFixture::id(sink)));
+        ASSERT_EQ(flowObj.get(), this->solve(capacities, source, sink));
+
+        for (int edit = 0; edit < 30; ++edit)
+        {
+            int from = pick(generator);
+            int to = pick(generator);
+            if (from == to)
+            {
+                continue;
+            }
+
+            int value = capacity(generator);
+            if (!present[from][to])
+            {
+                flowObj.add_edge(vertex_type(TestFixture::id(from)), vertex_type(TestFixture::id(to)), value);
+                present[from][to] = true;
+            }
+            else
+            {
+                flowObj.set_capacity(vertex_type(TestFixture::id(from)), vertex_type(TestFixture::id(to)), value);
+            }
+            capacities[from][to] = value;
+
+            ASSERT_EQ(flowObj.get(), this->solve(capacities, source, sink));
+        }
+    }
+}
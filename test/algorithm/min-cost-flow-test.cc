@@ -0,0 +1,164 @@
+// Testing of minimum cost flow algorithm
+
+#include "gtest/gtest.h"                                        //gtest
+#include "graph-lib/graph.hpp"                                  // helper component
+#include "graph-lib/algorithm/flow/push-relabel.hpp"            // flow value reference
+#include "graph-lib/algorithm/flow/min-cost-flow.hpp"           // component to test
+#include "graph-test.hpp"                                       // shared fixture
+//
+#include <stdexcept>                                            // std::invalid_argument
+#include <vector>
+
+
+
+
+
+template<   class id_type>
+class MinCostFlowTest : public GraphTest<id_type>
+{
+protected:
+    using vertex_type   = component::Vertex<id_type>;
+};
+
+
+
+
+
+using testing::Types;
+
+typedef Types<int, char> Implementations;
+
+TYPED_TEST_SUITE(MinCostFlowTest, Implementations);
+
+const algorithm::traits::cost_mode modes[] = {algorithm::traits::cost_mode::successive_shortest_paths,
+                                              algorithm::traits::cost_mode::cost_scaling};
+
+
+
+
+
+TYPED_TEST(MinCostFlowTest, SmallNetwork)
+{
+    using vertex_type = typename TestFixture::vertex_type;
+
+    graph::Graph<TypeParam> graph;
+    for (int i = 0; i < 4; ++i)
+    {
+        graph.AddVertex(TestFixture::id(i));
+    }
+    // paths 0-1-3 (cost 2), 0-1-2-3 (cost 3), 0-2-3 (cost 6)
+    this->arc(graph, 0, 1, 2, 1);
+    this->arc(graph, 0, 2, 2, 5);
+    this->arc(graph, 1, 3, 1, 1);
+    this->arc(graph, 1, 2, 1, 1);
+    this->arc(graph, 2, 3, 2, 1);
+
+    algorithm::min_cost_flow<TypeParam> solver(&graph);
+    for (auto mode : modes)
+    {
+        solver.run(vertex_type(TestFixture::id(0)), vertex_type(TestFixture::id(3)), mode);
+        ASSERT_EQ(solver.get(), 3);
+        ASSERT_EQ(solver.get_cost(), 11);
+        ASSERT_EQ(solver.get_flow(vertex_type(TestFixture::id(0)), vertex_type(TestFixture::id(1))), 2);
+        ASSERT_EQ(solver.get_flow(vertex_type(TestFixture::id(0)), vertex_type(TestFixture::id(2))), 1);
+        ASSERT_EQ(solver.get_flow(vertex_type(TestFixture::id(1)), vertex_type(TestFixture::id(2))), 1);
+        TestFixture::check_feasible(solver, 0, 3);
+
+        solver.run(vertex_type(TestFixture::id(3)), vertex_type(TestFixture::id(0)), mode);
+        ASSERT_EQ(solver.get(), 0);
+        ASSERT_EQ(solver.get_cost(), 0);
+    }
+}
+
+
+
+// Cheapest first path 0-1-2-3 must be partly undone over the reverse of 1-2
+TYPED_TEST(MinCostFlowTest, CheapPathIsRerouted)
+{
+    using vertex_type = typename TestFixture::vertex_type;
+
+    graph::Graph<TypeParam> graph;
+    for (int i = 0; i < 4; ++i)
+    {
+        graph.AddVertex(TestFixture::id(i));
+    }
+    this->arc(graph, 0, 1, 1, 1);
+    this->arc(graph, 1, 2, 1, 1);
+    this->arc(graph, 2, 3, 1, 1);
+    this->arc(graph, 0, 2, 1, 4);
+    this->arc(graph, 1, 3, 1, 4);
+
+    algorithm::min_cost_flow<TypeParam> solver(&graph);
+    for (auto mode : modes)
+    {
+        solver.run(vertex_type(TestFixture::id(0)), vertex_type(TestFixture::id(3)), mode);
+        ASSERT_EQ(solver.get(), 2);
+        ASSERT_EQ(solver.get_cost(), 10);
+        ASSERT_EQ(solver.get_flow(vertex_type(TestFixture::id(1)), vertex_type(TestFixture::id(2))), 0);
+    }
+}
+
+
+
+// Both strategies reach maximum flow value and agree on cost
+TYPED_TEST(MinCostFlowTest, StrategiesAgreeOnRandomNetworks)
+{
+    using vertex_type = typename TestFixture::vertex_type;
+
+    const int size = 30;
+
+    for (int round = 0; round < 10; ++round)
+    {
+        auto graph = TestFixture::random_network(size, 5 * size, 11 + round, 15, 40);
+
+        vertex_type source(TestFixture::id(0));
+        vertex_type sink(TestFixture::id(size - 1));
+
+        algorithm::push_relabel<TypeParam> maxFlow(&graph);
+        maxFlow.run(source, sink);
+
+        algorithm::min_cost_flow<TypeParam> solver(&graph);
+        solver.run(source, sink, modes[0]);
+        long long cost = solver.get_cost();
+        ASSERT_EQ(solver.get(), maxFlow.get());
+        TestFixture::check_feasible(solver, 0, size - 1);
+
+        solver.run(source, sink, modes[1]);
+        ASSERT_EQ(solver.get(), maxFlow.get());
+        ASSERT_EQ(solver.get_cost(), cost);
+        TestFixture::check_feasible(solver, 0, size - 1);
+    }
+}
+
+
+
+TYPED_TEST(MinCostFlowTest, NegativeCosts)
+{
+    using vertex_type = typename TestFixture::vertex_type;
+
+    graph::Graph<TypeParam> graph;
+    for (int i = 0; i < 4; ++i)
+    {
+        graph.AddVertex(TestFixture::id(i));
+    }
+    this->arc(graph, 0, 1, 2, 3);
+    this->arc(graph, 0, 2, 2, 1);
+    this->arc(graph, 1, 3, 2, -2);
+    this->arc(graph, 2, 3, 1, 2);
+    this->arc(graph, 2, 1, 1, -1);
+
+    algorithm::min_cost_flow<TypeParam> solver(&graph);
+    for (auto mode : modes)
+    {
+        // 0-2-1-3 (cost -2), 0-1-3 (cost 1), 0-2-3 (cost 3)
+        solver.run(vertex_type(TestFixture::id(0)), vertex_type(TestFixture::id(3)), mode);
+        ASSERT_EQ(solver.get(), 3);
+        ASSERT_EQ(solver.get_cost(), 2);
+    }
+
+    // negative cycle 1-3-1
+    this->arc(graph, 3, 1, 1, 1);
+    algorithm::min_cost_flow<TypeParam> cyclic(&graph);
+    ASSERT_THROW(cyclic.run(vertex_type(TestFixture::id(0)), vertex_type(TestFixture::id(3))),
+                 std::invalid_argument);
+}
@@ -0,0 +1,144 @@
+// Testing of multi-source BFS algorithm
+
+#include "gtest/gtest.h"                                        //gtest
+#include "graph-lib/graph.hpp"                                  // helper component
+#include "graph-lib/algorithm/traversal/bfs.hpp"                // reference
+#include "graph-lib/algorithm/traversal/multi-source-bfs.hpp"   // component to test
+#include "graph-lib/implementation/reordering.hpp"              // reordered snapshot
+#include "graph-test.hpp"                                       // shared fixture
+//
+#include <vector>                                               //
+
+
+
+
+
+template<   class id_type>
+class MultiSourceBfsTest : public GraphTest<id_type>
+{
+protected:
+    using vertex_type   = component::Vertex<id_type>;
+    using GraphTest<id_type>::id;
+
+    //required functions
+    void    SetUp()     override
+    {
+        // ring plus chords, one directed chord family and one isolated vertex
+        count_ = 100;
+
+        for (int i = 0; i <= count_; ++i)
+        {
+            graph_.AddVertex(id(i));
+        }
+        for (int i = 0; i < count_; ++i)
+        {
+            graph_.AddEdge(id(i), id((i + 1) % count_));
+            graph_.AddEdge(id(i), id((i * 7 + 3) % count_),
+                           component::traits::edge_direction::one_two);
+        }
+    }
+
+    void    TearDown()  override
+    {   }
+
+    // every vertex as source, some twice
+    std::vector<vertex_type> sources() const
+    {
+        std::vector<vertex_type> result;
+        for (int i = 0; i <= count_; ++i)
+        {
+            result.emplace_back(id(i));
+        }
+        for (int i = 0; i < 40; ++i)
+        {
+            result.emplace_back(id((i * 11) % count_));
+        }
+        return result;
+    }
+
+    // compare every row with sequential bfs distances
+    template<class search_type>
+    void check(const search_type& search) const
+    {
+        auto roots = sources();
+        const auto& list = search.get_snapshot();
+        ASSERT_EQ(search.get_sources(), static_cast<int>(roots.size()));
+
+        for (std::size_t source = 0; source < roots.size(); ++source)
+        {
+            algorithm::bfs<id_type> reference(&graph_);
+            reference.run(roots[source]);
+
+            std::vector<int> row(search.get().begin() + source * list.Size(),
+                                 search.get().begin() + (source + 1) * list.Size());
+            ASSERT_EQ(row, reference.get_distances());
+        }
+    }
+
+    int count_;
+    graph::Graph<id_type> graph_;
+};
+
+
+
+
+
+using testing::Types;
+
+typedef Types<int, char> Implementations;
+
+TYPED_TEST_SUITE(MultiSourceBfsTest, Implementations);
+
+
+
+
+
+TYPED_TEST(MultiSourceBfsTest, MatchesSequentialDistances)
+{
+    // 141 sources: one batch of 256 lanes
+    algorithm::multi_source_bfs<TypeParam> search(&this->graph_);
+    search.run(this->sources());
+    this->check(search);
+
+    ASSERT_EQ(search.get_distance(0, typename TestFixture::vertex_type(TestFixture::id(0))), 0);
+    ASSERT_EQ(search.get_distance(0, typename TestFixture::vertex_type(TestFixture::id(this->count_))), -1);
+}
+
+
+
+TYPED_TEST(MultiSourceBfsTest, SplitsSourcesIntoBatches)
+{
+    // 141 sources: three batches of 64 lanes
+    algorithm::multi_source_bfs<TypeParam, graph::Graph<TypeParam>, 64> search(&this->graph_);
+    search.run(this->sources());
+    this->check(search);
+
+    ASSERT_THROW(search.run({typename TestFixture::vertex_type(TestFixture::id(this->count_ + 1))}),
+                 std::out_of_range);
+}
+
+
+
+TYPED_TEST(MultiSourceBfsTest, ReorderedSnapshot)
+{
+    using vertex_type = typename TestFixture::vertex_type;
+
+    algorithm::multi_source_bfs<TypeParam> search(&this->graph_);
+    search.run(this->sources());
+
+    // distances are the same per vertex, handles follow the reordered snapshot
+    auto reordered = implementation::reorder(implementation::CompressedList<TypeParam>(this->graph_),
+                                             implementation::traits::vertex_order::degree);
+    algorithm::multi_source_bfs<TypeParam> reorderedSearch(std::move(reordered));
+    reorderedSearch.run(this->sources());
+    ASSERT_EQ(reorderedSearch.get_graph(), nullptr);
+
+    for (int source = 0; source < search.get_sources(); ++source)
+    {
+        for (int i = 0; i <= this->count_; ++i)
+        {
+            vertex_type vertex(TestFixture::id(i));
+            ASSERT_EQ(reorderedSearch.get_distance(source, vertex), search.get_distance(source, vertex));
+        }
+    }
+}
@@ -0,0 +1,148 @@
+#include "gtest/gtest.h"                                        //gtest
+#include "graph-lib/graph.hpp"                                  // helper component
+#include "graph-lib/algorithm/traversal/bfs.hpp"                // reference
+#include "graph-lib/algorithm/traversal/parallel-bfs.hpp"       // component to test
+#include "graph-test.hpp"                                       // shared fixture
+//
+#include <vector>                                               //
+
+
+
+
+
+template<   class id_type>
+class ParallelBfsTest : public GraphTest<id_type>
+{
+protected:
+    using vertex_type   = component::Vertex<id_type>;
+    using bfs_type      = algorithm::parallel_bfs<id_type>;
+    using GraphTest<id_type>::id;
+
+    //required functions
+    void    SetUp()     override
+    {
+        // ring plus chords, and one isolated vertex
+        count_ = 100;
+
+        for (int i = 0; i <= count_; ++i)
+        {
+            graph_.AddVertex(id(i));
+        }
+        for (int i = 0; i < count_; ++i)
+        {
+            graph_.AddEdge(id(i), id((i + 1) % count_));
+            graph_.AddEdge(id(i), id((i * 7 + 3) % count_));
+            graph_.AddEdge(id(i), id((i * 13 + 5) % count_),
+                           component::traits::edge_direction::one_two);
+        }
+    }
+
+    void    TearDown()  override
+    {   }
+
+    // depth of every handle following dense parents, -1 if not discovered
+    static std::vector<int> depths(const std::vector<int>& parents)
+    {
+        std::vector<int> result(parents.size(), -1);
+        for (std::size_t v = 0; v < parents.size(); ++v)
+        {
+            if (parents[v] == -1)
+            {
+                continue;
+            }
+            int depth = 0;
+            for (int current = static_cast<int>(v); parents[current] != current; current = parents[current])
+            {
+                ++depth;
+            }
+            result[v] = depth;
+        }
+        return result;
+    }
+
+    int count_;
+    graph::Graph<id_type> graph_;
+};
+
+
+
+
+
+using testing::Types;
+
+typedef Types<int, char> Implementations;
+
+TYPED_TEST_SUITE(ParallelBfsTest, Implementations);
+
+
+
+
+
+TYPED_TEST(ParallelBfsTest, MatchesSequentialDepths)
+{
+    using vertex_type = typename TestFixture::vertex_type;
+
+    // sequential reference over the same snapshot handles
+    algorithm::bfs<TypeParam> reference(&this->graph_);
+    reference.run(vertex_type(TestFixture::id(0)), algorithm::traits::bfs_mode::direction_optimizing);
+
+    typename TestFixture::bfs_type parallel(&this->graph_, 4);
+    parallel.run(vertex_type(TestFixture::id(0)));
+
+    const auto& list = parallel.get_snapshot();
+    std::vector<int> expected(list.Size(), -1);
+    for (int v = 0; v < list.Size(); ++v)
+    {
+        const auto& parent = reference.get().at(list.GetVertex(v));
+        if (parent != vertex_type::invalidInstance_)
+        {
+            expected[v] = list.GetHandle(parent);
+        }
+    }
+
+    const auto& parents = parallel.get_parents();
+    ASSERT_EQ(TestFixture::depths(parents), TestFixture::depths(expected));
+
+    // every parent link is an arc
+    for (int v = 0; v < list.Size(); ++v)
+    {
+        if (parents[v] == -1 || parents[v] == v)
+        {
+            continue;
+        }
+        bool isArc = false;
+        for (int arc = list.Begin(parents[v]); arc < list.End(parents[v]); ++arc)
+        {
+            isArc = isArc || (list.Target(arc) == v);
+        }
+        ASSERT_TRUE(isArc);
+    }
+
+    // isolated vertex stays undiscovered in both results
+    ASSERT_EQ(parallel.get().at(vertex_type(TestFixture::id(this->count_))),
+              vertex_type::invalidInstance_);
+}
+
+
+
+TYPED_TEST(ParallelBfsTest, DeterministicAcrossThreadCounts)
+{
+    using vertex_type = typename TestFixture::vertex_type;
+
+    typename TestFixture::bfs_type parallel(&this->graph_, 1);
+    parallel.set_deterministic(true);
+    parallel.run(vertex_type(TestFixture::id(3)));
+    auto expected = parallel.get_parents();
+
+    for (int threads : {2, 3, 8})
+    {
+        for (int repeat = 0; repeat < 5; ++repeat)
+        {
+            parallel.set_threads(threads);
+            parallel.run(vertex_type(TestFixture::id(3)));
+            ASSERT_EQ(parallel.get_parents(), expected);
+        }
+    }
+
+    ASSERT_THROW(parallel.set_threads(-1), std::invalid_argument);
+}
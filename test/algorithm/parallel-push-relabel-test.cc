@@ -0,0 +1,82 @@
+// Testing of parallel push-relabel algorithm
+
+#include "gtest/gtest.h"                                        //gtest
+#include "graph-lib/graph.hpp"                                  // helper component
+#include "graph-lib/algorithm/flow/push-relabel.hpp"            // sequential reference
+#include "graph-lib/algorithm/flow/parallel-push-relabel.hpp"   // component to test
+#include "graph-test.hpp"                                       // shared fixture
+//
+#include <random>                                               // std::mt19937
+#include <stdexcept>                                            // std::invalid_argument
+
+
+
+
+
+template<   class id_type>
+class ParallelPushRelabelTest : public GraphTest<id_type>
+{
+protected:
+    using vertex_type   = component::Vertex<id_type>;
+};
+
+
+
+
+
+using testing::Types;
+
+typedef Types<int, char> Implementations;
+
+TYPED_TEST_SUITE(ParallelPushRelabelTest, Implementations);
+
+
+
+
+
+TYPED_TEST(ParallelPushRelabelTest, SmallNetwork)
+{
+    using vertex_type = typename TestFixture::vertex_type;
+
+    auto graph = TestFixture::small_network();
+
+    algorithm::parallel_push_relabel<TypeParam> parallel(&graph, 2);
+    parallel.run(vertex_type(TestFixture::id(1)), vertex_type(TestFixture::id(4)));
+    ASSERT_EQ(parallel.get(), 5);
+    parallel.run(vertex_type(TestFixture::id(4)), vertex_type(TestFixture::id(1)));
+    ASSERT_EQ(parallel.get(), 0);
+    parallel.run(vertex_type(TestFixture::id(2)), vertex_type(TestFixture::id(2)));
+    ASSERT_EQ(parallel.get(), 0);
+
+    ASSERT_THROW(parallel.set_threads(-1), std::invalid_argument);
+}
+
+
+
+// Flow value does not depend on thread count or on thread timing
+TYPED_TEST(ParallelPushRelabelTest, MatchesSequentialAcrossThreadCounts)
+{
+    using vertex_type = typename TestFixture::vertex_type;
+
+    const int size = 80;
+    auto graph = TestFixture::random_network(size, 6 * size, 7);
+
+    std::mt19937 generator(7);
+    std::uniform_int_distribution<int> pick(0, size - 1);
+
+    algorithm::push_relabel<TypeParam> sequential(&graph);
+    algorithm::parallel_push_relabel<TypeParam> parallel(&graph);
+    for (int round = 0; round < 10; ++round)
+    {
+        vertex_type source(TestFixture::id(pick(generator)));
+        vertex_type sink(TestFixture::id(pick(generator)));
+        sequential.run(source, sink);
+
+        for (int threads : {1, 2, 3, 8})
+        {
+            parallel.set_threads(threads);
+            parallel.run(source, sink);
+            ASSERT_EQ(parallel.get(), sequential.get());
+        }
+    }
+}
@@ -0,0 +1,179 @@
+#include "gtest/gtest.h"                                        //gtest
+#include "graph-lib/graph.hpp"                                  // helper component
+#include "graph-lib/algorithm/partition/partitioner.hpp"        // component to test
+//
+#include <vector>                                               //
+#include <set>                                                  //
+#include <utility>                                              // std::pair
+
+
+
+
+
+template<   class id_type>
+class PartitionerTest : public testing::Test
+{
+protected:
+    using partitioner_type  = algorithm::partitioner<id_type>;
+    using scheme            = algorithm::traits::partition_scheme;
+
+    //required functions
+    void    SetUp()     override
+    {
+        // 10 x 10 undirected grid
+        side_ = 10;
+
+        for (int i = 0; i < side_ * side_; ++i)
+        {
+            graph_.AddVertex(static_cast<id_type>(i));
+        }
+        for (int row = 0; row < side_; ++row)
+        {
+            for (int column = 0; column < side_; ++column)
+            {
+                int v = row * side_ + column;
+                if (column + 1 < side_)
+                {
+                    graph_.AddEdge(static_cast<id_type>(v), static_cast<id_type>(v + 1));
+                }
+                if (row + 1 < side_)
+                {
+                    graph_.AddEdge(static_cast<id_type>(v), static_cast<id_type>(v + side_));
+                }
+            }
+        }
+    }
+
+    void    TearDown()  override
+    {   }
+
+    // every arc of the graph must be present exactly once in its owner shard
+    void    check(const partitioner_type& partitioner) const
+    {
+        const auto& global = partitioner.get_global();
+        const auto& shards = partitioner.get();
+        std::multiset<std::pair<int, int>> arcs;
+        int owned = 0;
+        int cut = 0;
+
+        for (std::size_t p = 0; p < shards.size(); ++p)
+        {
+            const auto& part = shards[p];
+            owned += part.owned;
+            ASSERT_EQ(part.list.Size(), static_cast<int>(part.global.size()));
+            ASSERT_EQ(part.list.Size() - part.owned, static_cast<int>(part.ghost_owner.size()));
+
+            for (int local = 0; local < part.list.Size(); ++local)
+            {
+                ASSERT_EQ(part.list.GetVertex(local).Id(),
+                          global.GetVertex(part.global[local]).Id());
+                for (int arc = part.list.Begin(local); arc < part.list.End(local); ++arc)
+                {
+                    arcs.emplace(part.global[local], part.global[part.list.Target(arc)]);
+                    cut += (part.list.Target(arc) >= part.owned);
+                }
+            }
+
+            // locate() and ghost tables agree
+            for (int local = 0; local < part.owned; ++local)
+            {
+                auto location = partitioner.locate(part.list.GetVertex(local));
+                ASSERT_EQ(location.first, static_cast<int>(p));
+                ASSERT_EQ(location.second, local);
+            }
+            for (std::size_t ghost = 0; ghost < part.ghost_owner.size(); ++ghost)
+            {
+                const auto& owner = shards[part.ghost_owner[ghost]];
+                ASSERT_NE(part.ghost_owner[ghost], static_cast<int>(p));
+                ASSERT_EQ(owner.global[part.ghost_remote[ghost]],
+                          part.global[part.owned + ghost]);
+            }
+        }
+
+        std::multiset<std::pair<int, int>> expected;
+        for (int v = 0; v < global.Size(); ++v)
+        {
+            for (int arc = global.Begin(v); arc < global.End(v); ++arc)
+            {
+                expected.emplace(v, global.Target(arc));
+            }
+        }
+
+        ASSERT_EQ(owned, global.Size());
+        ASSERT_EQ(arcs, expected);
+        ASSERT_EQ(cut, partitioner.get_statistics().edge_cut);
+    }
+
+    int side_;
+    graph::Graph<id_type> graph_;
+};
+
+
+
+
+
+using testing::Types;
+
+typedef Types<int, char> Implementations;
+
+TYPED_TEST_SUITE(PartitionerTest, Implementations);
+
+
+
+
+
+TYPED_TEST(PartitionerTest, Hash)
+{
+    typename TestFixture::partitioner_type partitioner(&this->graph_);
+    partitioner.run(4, TestFixture::scheme::hash);
+
+    ASSERT_EQ(partitioner.get().size(), 4u);
+    this->check(partitioner);
+}
+
+
+
+TYPED_TEST(PartitionerTest, Range)
+{
+    typename TestFixture::partitioner_type partitioner(&this->graph_);
+    partitioner.run(4, TestFixture::scheme::range);
+
+    this->check(partitioner);
+
+    // 100 vertices into 4 ranges of 25
+    for (auto size : partitioner.get_statistics().sizes)
+    {
+        ASSERT_EQ(size, 25);
+    }
+    ASSERT_DOUBLE_EQ(partitioner.get_statistics().balance, 1.0);
+}
+
+
+
+TYPED_TEST(PartitionerTest, Multilevel)
+{
+    typename TestFixture::partitioner_type hashed(&this->graph_);
+    hashed.run(4, TestFixture::scheme::hash);
+
+    typename TestFixture::partitioner_type partitioner(&this->graph_);
+    partitioner.run(4, TestFixture::scheme::multilevel, 0.1);
+
+    this->check(partitioner);
+
+    // much better than hash, balanced within limit
+    ASSERT_LT(partitioner.get_statistics().edge_cut, hashed.get_statistics().edge_cut / 2);
+    ASSERT_LE(partitioner.get_statistics().balance, 1.1 + 1e-9);
+}
+
+
+
+TYPED_TEST(PartitionerTest, SinglePart)
+{
+    typename TestFixture::partitioner_type partitioner(&this->graph_);
+    partitioner.run(1);
+
+    this->check(partitioner);
+    ASSERT_EQ(partitioner.get_statistics().edge_cut, 0);
+    ASSERT_TRUE(partitioner.get().front().boundary.empty());
+    ASSERT_THROW(partitioner.run(0), std::invalid_argument);
+}
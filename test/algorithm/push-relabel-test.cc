@@ -0,0 +1,165 @@
+// Testing of push-relabel algorithm
+
+#include "gtest/gtest.h"                                        //gtest
+#include "graph-lib/graph.hpp"                                  // helper component
+#include "graph-lib/algorithm/flow/push-relabel.hpp"            // component to test
+#include "graph-test.hpp"                                       // shared fixture
+//
+#include <algorithm>                                            // std::min
+#include <vector>
+
+
+
+
+
+template<   class id_type>
+class PushRelabelTest : public GraphTest<id_type>
+{
+protected:
+    using vertex_type   = component::Vertex<id_type>;
+    using GraphTest<id_type>::id;
+
+    int     max_flow(graph::Graph<id_type>& graph, int source, int sink)
+    {
+        algorithm::push_relabel<id_type> pushRelabelObj(&graph);
+        pushRelabelObj.run(vertex_type(id(source)), vertex_type(id(sink)));
+        return pushRelabelObj.get();
+    }
+};
+
+
+
+
+
+using testing::Types;
+
+typedef Types<int, char> Implementations;
+
+TYPED_TEST_SUITE(PushRelabelTest, Implementations);
+
+
+
+
+
+TYPED_TEST(PushRelabelTest, SmallNetwork)
+{
+    auto graph = TestFixture::small_network();
+
+    ASSERT_EQ(this->max_flow(graph, 1, 4), 5);
+    ASSERT_EQ(this->max_flow(graph, 4, 1), 0);
+    ASSERT_EQ(this->max_flow(graph, 2, 2), 0);
+}
+
+
+
+// Greedy path 0 -> 1 -> 2 -> 3 blocks both other paths; reverse arcs undo it
+TYPED_TEST(PushRelabelTest, FlowIsCancelledOverReverseArcs)
+{
+    graph::Graph<TypeParam> graph;
+    for (int i = 0; i < 4; ++i)
+    {
+        graph.AddVertex(TestFixture::id(i));
+    }
+    this->arc(graph, 0, 1, 1);
+    this->arc(graph, 1, 2, 1);
+    this->arc(graph, 2, 3, 1);
+    this->arc(graph, 0, 2, 1);
+    this->arc(graph, 1, 3, 1);
+
+    ASSERT_EQ(this->max_flow(graph, 0, 3), 2);
+}
+
+
+
+TYPED_TEST(PushRelabelTest, CompleteBipartiteUnitNetwork)
+{
+    // source 0, left 1..left, right left+1..left+right, sink left+right+1
+    const int left = 12;
+    const int right = 9;
+    const int sink = left + right + 1;
+
+    graph::Graph<TypeParam> graph;
+    for (int i = 0; i <= sink; ++i)
+    {
+        graph.AddVertex(TestFixture::id(i));
+    }
+    for (int l = 1; l <= left; ++l)
+    {
+        this->arc(graph, 0, l, 1);
+        for (int r = left + 1; r <= left + right; ++r)
+        {
+            this->arc(graph, l, r, 1);
+        }
+    }
+    for (int r = left + 1; r <= left + right; ++r)
+    {
+        this->arc(graph, r, sink, 1);
+    }
+
+    ASSERT_EQ(this->max_flow(graph, 0, sink), std::min(left, right));
+}
+
+
+
+// Random networks against minimum cut found by enumerating all cuts
+TYPED_TEST(PushRelabelTest, MatchesMinimumCut)
+{
+    const int size = 9;
+
+    for (int round = 0; round < 20; ++round)
+    {
+        auto graph = TestFixture::random_network(size, 3 * size, 42 + round, 9);
+        auto capacities = TestFixture::capacities(graph, size);
+
+        // source 0 in every cut, sink size - 1 outside
+        int cut = -1;
+        for (int mask = 0; mask < (1 << size); ++mask)
+        {
+            if (!(mask & 1) || (mask & (1 << (size - 1))))
+            {
+                continue;
+            }
+            int value = 0;
+            for (int from = 0; from < size; ++from)
+            {
+                for (int to = 0; to < size; ++to)
+                {
+                    if ((mask & (1 << from)) && !(mask & (1 << to)))
+                    {
+                        value += capacities[from][to];
+                    }
+                }
+            }
+            cut = (cut == -1) ? value : std::min(cut, value);
+        }
+
+        ASSERT_EQ(this->max_flow(graph, 0, size - 1), cut);
+    }
+}
+
+
+
+TEST(PushRelabelChainTest, ObjectIsReusable)
+{
+    const int length = 50000;
+
+    graph::Graph<int> graph;
+    for (int i = 0; i < length; ++i)
+    {
+        graph.AddVertex(i);
+    }
+    for (int i = 0; i + 1 < length; ++i)
+    {
+        graph.AddEdge(i, i + 1, component::traits::edge_direction::one_two, 1, 3 + (i * 7919) % 11);
+    }
+
+    algorithm::push_relabel<int> pushRelabelObj(&graph);
+    pushRelabelObj.run(component::Vertex<int>(0), component::Vertex<int>(length - 1));
+    ASSERT_EQ(pushRelabelObj.get(), 3);
+
+    pushRelabelObj.run(component::Vertex<int>(length - 1), component::Vertex<int>(0));
+    ASSERT_EQ(pushRelabelObj.get(), 0);
+
+    pushRelabelObj.run(component::Vertex<int>(1), component::Vertex<int>(3));
+    ASSERT_EQ(pushRelabelObj.get(), std::min(3 + 7919 % 11, 3 + (2 * 7919) % 11));
+}
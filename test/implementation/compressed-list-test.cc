@@ -0,0 +1,224 @@
+#include "gtest/gtest.h"                                        //gtest
+#include "graph-lib/graph.hpp"                                  // helper component
+#include "graph-lib/implementation/compressed-list.hpp"         // component to test
+#include "graph-lib/implementation/reordering.hpp"              // component to test
+//
+#include <vector>                                               //
+#include <set>                                                  //
+#include <utility>                                              // std::pair
+#include <algorithm>                                            // std::sort, std::max
+#include <cstdlib>                                              // std::abs
+
+
+
+
+
+template<   class id_type>
+class CompressedListTest : public testing::Test
+{
+protected:
+    using list_type     = implementation::CompressedList<id_type>;
+    using arc_set       = std::set<std::pair<id_type, id_type>>;
+
+    //required functions
+    void    SetUp()     override
+    {
+        // # of elements
+        count_ = 20;
+
+        // ladder: i -- i+1 and i -- i+10
+        for (int i = 0; i < count_; ++i)
+        {
+            graph_.AddVertex(static_cast<id_type>(i));
+        }
+        for (int i = 0; i + 1 < count_; ++i)
+        {
+            graph_.AddEdge(static_cast<id_type>(i), static_cast<id_type>(i + 1));
+        }
+        for (int i = 0; i + 10 < count_; ++i)
+        {
+            graph_.AddEdge(static_cast<id_type>(i), static_cast<id_type>(i + 10));
+        }
+    }
+
+    void    TearDown()  override
+    {   }
+
+    // collect arcs as id pairs
+    arc_set arcs(const list_type& list) const
+    {
+        arc_set result;
+        for (int v = 0; v < list.Size(); ++v)
+        {
+            for (int arc = list.Begin(v); arc < list.End(v); ++arc)
+            {
+                result.emplace(list.GetVertex(v).Id(),
+                               list.GetVertex(list.Target(arc)).Id());
+            }
+        }
+        return result;
+    }
+
+public:
+    graph::Graph<id_type>   graph_;
+    int                     count_;
+};
+
+
+
+
+
+//  Using parametrized tests for implementation::CompressedList
+#if GTEST_HAS_TYPED_TEST
+
+using testing::Types;
+
+
+
+// Declare which types are going to be used
+typedef Types<int, char> IndeciesTypes;
+
+
+
+// declare what test fixture uses which types
+TYPED_TEST_SUITE(CompressedListTest, IndeciesTypes);
+
+
+
+
+
+//
+// Tests
+//
+
+// Snapshot constructor test
+TYPED_TEST(CompressedListTest, SnapshotConstructor)
+{
+    implementation::CompressedList<TypeParam> list(this->graph_);
+
+    ASSERT_EQ(list.Size(), this->count_);
+    // undirected edges are stored twice
+    ASSERT_EQ(list.EdgeCount(), 2 * (this->count_ - 1 + this->count_ - 10));
+
+    for (int v = 0; v < list.Size(); ++v)
+    {
+        ASSERT_EQ(list.GetHandle(list.GetVertex(v)), v);
+        ASSERT_EQ(list.Degree(v),
+                  static_cast<int>(this->graph_.GetNeighbours(list.GetVertex(v)).size()));
+    }
+}
+
+
+
+// Every strategy produces a permutation preserving graph structure
+TYPED_TEST(CompressedListTest, ReorderPreservesStructure)
+{
+    implementation::CompressedList<TypeParam> list(this->graph_);
+
+    for (auto strategy : {implementation::traits::vertex_order::natural,
+                          implementation::traits::vertex_order::degree,
+                          implementation::traits::vertex_order::bfs,
+                          implementation::traits::vertex_order::reverse_cuthill_mckee})
+    {
+        auto order = implementation::compute_order(list, strategy);
+        auto sorted = order;
+        std::sort(sorted.begin(), sorted.end());
+        for (int i = 0; i < list.Size(); ++i)
+        {
+            ASSERT_EQ(sorted[i], i);
+        }
+
+        auto reordered = implementation::reorder(list, strategy);
+        ASSERT_EQ(reordered.Size(), list.Size());
+        ASSERT_EQ(reordered.EdgeCount(), list.EdgeCount());
+        ASSERT_EQ(this->arcs(reordered), this->arcs(list));
+    }
+}
+
+
+
+// Handle lookup works on unsorted handle orders too
+TYPED_TEST(CompressedListTest, ReorderedHandleLookup)
+{
+    implementation::CompressedList<TypeParam> list(this->graph_);
+    auto reordered = implementation::reorder(list, implementation::traits::vertex_order::degree);
+
+    for (int v = 0; v < reordered.Size(); ++v)
+    {
+        ASSERT_EQ(reordered.GetHandle(reordered.GetVertex(v)), v);
+    }
+    ASSERT_FALSE(reordered.ContainsVertex(component::Vertex<TypeParam>(static_cast<TypeParam>(this->count_))));
+    ASSERT_THROW(reordered.GetHandle(component::Vertex<TypeParam>(static_cast<TypeParam>(this->count_))),
+                 std::out_of_range);
+}
+
+
+
+// Degree order places hubs first
+TYPED_TEST(CompressedListTest, DegreeOrder)
+{
+    implementation::CompressedList<TypeParam> list(this->graph_);
+    auto reordered = implementation::reorder(list, implementation::traits::vertex_order::degree);
+
+    for (int v = 0; v + 1 < reordered.Size(); ++v)
+    {
+        ASSERT_GE(reordered.Degree(v), reordered.Degree(v + 1));
+    }
+}
+
+
+
+// Reverse Cuthill-McKee recovers a narrow band hidden by scrambled ids
+TYPED_TEST(CompressedListTest, ReverseCuthillMcKeeReducesBandwidth)
+{
+    // band of width 2 over positions 0..29; position p gets id 1 + (7p mod 31)
+    const int size = 30;
+    const int band = 2;
+    auto id = [](int position) { return static_cast<TypeParam>(1 + (7 * position) % 31); };
+
+    graph::Graph<TypeParam> graph;
+    for (int p = 0; p < size; ++p)
+    {
+        graph.AddVertex(id(p));
+    }
+    for (int p = 0; p < size; ++p)
+    {
+        for (int q = p + 1; (q <= p + band) && (q < size); ++q)
+        {
+            graph.AddEdge(id(p), id(q));
+        }
+    }
+
+    // largest handle distance spanned by an arc
+    auto bandwidth = [](const implementation::CompressedList<TypeParam>& list)
+    {
+        int result = 0;
+        for (int v = 0; v < list.Size(); ++v)
+        {
+            for (int arc = list.Begin(v); arc < list.End(v); ++arc)
+            {
+                result = std::max(result, std::abs(list.Target(arc) - v));
+            }
+        }
+        return result;
+    };
+
+    implementation::CompressedList<TypeParam> list(graph);
+    auto reordered = implementation::reorder(list, implementation::traits::vertex_order::reverse_cuthill_mckee);
+
+    ASSERT_GT(bandwidth(list), 4 * band);
+    ASSERT_LE(bandwidth(reordered), 2 * band);
+}
+
+
+
+// Invalid permutation is rejected
+TYPED_TEST(CompressedListTest, InvalidOrder)
+{
+    implementation::CompressedList<TypeParam> list(this->graph_);
+    std::vector<int> order(list.Size(), 0);
+
+    ASSERT_THROW(implementation::CompressedList<TypeParam>(list, order), std::invalid_argument);
+}
+
+#endif // GTEST_HAS_TYPED_TEST
@@ -0,0 +1,257 @@
+#include "gtest/gtest.h"                                        //gtest
+#include "graph-lib/graph.hpp"                                  // helper component
+#include "graph-lib/implementation/dynamic-list.hpp"            // component to test
+//
+#include <vector>                                               //
+#include <algorithm>                                            // std::sort
+#include <thread>                                               // std::thread
+
+
+
+
+
+template<   class id_type>
+class DynamicListTest : public testing::Test
+{
+protected:
+    using vertex_type   = component::Vertex<id_type>;
+    using list_type     = implementation::DynamicList<id_type>;
+
+    //required functions
+    void    SetUp()     override
+    {
+        // # of elements
+        count_ = 20;
+    }
+
+    void    TearDown()  override
+    {   }
+
+    // sorted neighbour ids of a vertex
+    std::vector<int> neighbours(const list_type& list, int id) const
+    {
+        std::vector<int> result;
+        list.ForEachNeighbour(list.GetHandle(vertex_type(static_cast<id_type>(id))),
+            [&list, &result](int target, int, int)
+            {
+                result.push_back(static_cast<int>(list.GetVertex(target).Id()));
+            });
+        std::sort(result.begin(), result.end());
+        return result;
+    }
+
+public:
+    int                     count_;
+};
+
+
+
+
+
+//  Using parametrized tests for implementation::DynamicList
+#if GTEST_HAS_TYPED_TEST
+
+using testing::Types;
+
+
+
+// Declare which types are going to be used
+typedef Types<int, char> IndeciesTypes;
+
+
+
+// declare what test fixture uses which types
+TYPED_TEST_SUITE(DynamicListTest, IndeciesTypes);
+
+
+
+
+
+//
+// Tests
+//
+
+// Mutations are visible before and after compaction
+TYPED_TEST(DynamicListTest, AddRemoveEdge)
+{
+    using vertex_type = component::Vertex<TypeParam>;
+    implementation::DynamicList<TypeParam> list;
+    list.SetCompactionThreshold(0);
+
+    for (int i = 0; i < this->count_; ++i)
+    {
+        list.AddVertex(vertex_type(static_cast<TypeParam>(i)));
+    }
+    for (int i = 1; i < this->count_; ++i)
+    {
+        list.AddEdge(vertex_type(0), vertex_type(static_cast<TypeParam>(i)));
+    }
+
+    ASSERT_EQ(this->neighbours(list, 0).size(), static_cast<std::size_t>(this->count_ - 1));
+    ASSERT_EQ(this->neighbours(list, 5), std::vector<int>({0}));
+
+    // remove from delta
+    list.RemoveEdge(vertex_type(0), vertex_type(1));
+    ASSERT_EQ(this->neighbours(list, 1), std::vector<int>());
+
+    list.Compact();
+    ASSERT_EQ(list.DeltaSize(), 0u);
+    ASSERT_EQ(this->neighbours(list, 0).size(), static_cast<std::size_t>(this->count_ - 2));
+
+    // remove from base, then re-insert
+    list.RemoveEdge(vertex_type(0), vertex_type(2));
+    ASSERT_EQ(this->neighbours(list, 2), std::vector<int>());
+    list.AddEdge(vertex_type(0), vertex_type(2), component::traits::edge_direction::one_two);
+    ASSERT_EQ(this->neighbours(list, 2), std::vector<int>());
+    ASSERT_EQ(list.Degree(list.GetHandle(vertex_type(0))), this->count_ - 2);
+
+    // removing missing edge is a no-op
+    list.RemoveEdge(vertex_type(3), vertex_type(4));
+    ASSERT_EQ(this->neighbours(list, 3), std::vector<int>({0}));
+
+    auto snapshot = list.Snapshot();
+    ASSERT_EQ(list.DeltaSize(), 0u);
+    ASSERT_EQ(snapshot->Size(), this->count_);
+    ASSERT_EQ(snapshot->EdgeCount(), 2 * (this->count_ - 3) + 1);
+}
+
+
+
+// Graph initialized base
+TYPED_TEST(DynamicListTest, SnapshotConstructor)
+{
+    graph::Graph<TypeParam> graph;
+    for (int i = 0; i < this->count_; ++i)
+    {
+        graph.AddVertex(static_cast<TypeParam>(i));
+    }
+    for (int i = 0; i + 1 < this->count_; ++i)
+    {
+        graph.AddEdge(static_cast<TypeParam>(i), static_cast<TypeParam>(i + 1));
+    }
+
+    implementation::DynamicList<TypeParam> list(graph);
+
+    ASSERT_EQ(list.Size(), this->count_);
+    ASSERT_EQ(this->neighbours(list, 3), std::vector<int>({2, 4}));
+}
+
+
+
+// Many tombstones and cancellations at one vertex, in base and delta
+TYPED_TEST(DynamicListTest, ManyRemovalsAtOneVertex)
+{
+    using vertex_type = component::Vertex<TypeParam>;
+    implementation::DynamicList<TypeParam> list;
+    list.SetCompactionThreshold(0);
+
+    const int arcs = 4000;
+    for (int i = 0; i < this->count_; ++i)
+    {
+        list.AddVertex(vertex_type(static_cast<TypeParam>(i)));
+    }
+
+    // parallel arcs 0 -> i with weight arc % 100, half of them in base
+    auto add = [&list, this](int arc)
+        {
+            list.AddEdge(vertex_type(0),
+                         vertex_type(static_cast<TypeParam>(1 + arc % (this->count_ - 1))),
+                         component::traits::edge_direction::one_two,
+                         arc % 100);
+        };
+    for (int arc = 0; arc < arcs / 2; ++arc)
+    {
+        add(arc);
+    }
+    list.Compact();
+    for (int arc = arcs / 2; arc < arcs; ++arc)
+    {
+        add(arc);
+    }
+
+    // remove every other arc: tombstones for base, cancellations for delta
+    for (int arc = 0; arc < arcs; arc += 2)
+    {
+        list.RemoveEdge(vertex_type(0),
+                        vertex_type(static_cast<TypeParam>(1 + arc % (this->count_ - 1))),
+                        component::traits::edge_direction::one_two,
+                        arc % 100);
+    }
+
+    std::vector<int> expected(this->count_, 0);
+    for (int arc = 1; arc < arcs; arc += 2)
+    {
+        ++expected[1 + arc % (this->count_ - 1)];
+    }
+    std::vector<int> actual(this->count_, 0);
+    list.ForEachNeighbour(0,
+        [&actual, &list](int target, int, int)
+        {
+            ++actual[static_cast<int>(list.GetVertex(target).Id())];
+        });
+    ASSERT_EQ(actual, expected);
+
+    // remove the rest, then once more: nothing is left to hide
+    for (int arc = 1; arc < arcs; arc += 2)
+    {
+        list.RemoveEdge(vertex_type(0),
+                        vertex_type(static_cast<TypeParam>(1 + arc % (this->count_ - 1))),
+                        component::traits::edge_direction::one_two,
+                        arc % 100);
+    }
+    ASSERT_EQ(list.Degree(0), 0);
+    std::size_t delta = list.DeltaSize();
+    list.RemoveEdge(vertex_type(0), vertex_type(1), component::traits::edge_direction::one_two, 0);
+    ASSERT_EQ(list.DeltaSize(), delta);
+
+    list.Compact();
+    ASSERT_EQ(list.Degree(0), 0);
+    ASSERT_EQ(list.Snapshot()->EdgeCount(), 0);
+}
+
+
+
+// Background compaction under concurrent readers
+TYPED_TEST(DynamicListTest, BackgroundCompaction)
+{
+    using vertex_type = component::Vertex<TypeParam>;
+    implementation::DynamicList<TypeParam> list;
+    list.SetCompactionThreshold(16);
+
+    for (int i = 0; i < this->count_; ++i)
+    {
+        list.AddVertex(vertex_type(static_cast<TypeParam>(i)));
+    }
+
+    std::thread reader([&list, this]()
+        {
+            for (int round = 0; round < 200; ++round)
+            {
+                for (int v = 0; v < this->count_; ++v)
+                {
+                    list.Degree(v);
+                }
+            }
+        });
+
+    for (int round = 0; round < 10; ++round)
+    {
+        for (int i = 0; i + 1 < this->count_; ++i)
+        {
+            list.AddEdge(vertex_type(static_cast<TypeParam>(i)),
+                         vertex_type(static_cast<TypeParam>(i + 1)),
+                         component::traits::edge_direction::one_two,
+                         round);
+        }
+    }
+    reader.join();
+
+    list.Compact();
+    for (int i = 0; i + 1 < this->count_; ++i)
+    {
+        ASSERT_EQ(list.Degree(i), 10);
+    }
+    ASSERT_EQ(list.Degree(this->count_ - 1), 0);
+}
+
+#endif // GTEST_HAS_TYPED_TEST
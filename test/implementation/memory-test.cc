@@ -0,0 +1,148 @@
+#include "gtest/gtest.h"                                        //gtest
+#include "graph-lib/graph.hpp"                                  // component to test
+#include "graph-lib/utility/memory.hpp"                         // component to test
+//
+#include <list>                                                 //
+#include <utility>                                              // std::move
+
+
+
+
+
+template<   class id_type>
+class MemoryTest : public testing::Test
+{
+protected:
+    //required functions
+    void    SetUp()     override
+    {
+        // # of elements
+        count_ = 20;
+
+        // ring
+        for (int i = 0; i < count_; ++i)
+        {
+            graph_.AddVertex(static_cast<id_type>(i));
+        }
+        for (int i = 0; i < count_; ++i)
+        {
+            graph_.AddEdge(static_cast<id_type>(i), static_cast<id_type>((i + 1) % count_));
+        }
+    }
+
+    void    TearDown()  override
+    {   }
+
+    //state
+    int                         count_;
+    graph::Graph<id_type>       graph_;
+};
+
+
+
+
+
+using testing::Types;
+
+// Declare which types are going to be used
+typedef Types<int, char> IndeciesTypes;
+
+
+
+// declare what test fixture uses which types
+TYPED_TEST_SUITE(MemoryTest, IndeciesTypes);
+
+
+
+
+
+//
+// Tests
+//
+
+// Copies count into their own counters, original usage is unchanged
+TYPED_TEST(MemoryTest, GraphCopyKeepsOwnCounters)
+{
+    const auto usage = this->graph_.MemoryUsage();
+    ASSERT_GT(usage.edges, 0u);
+
+    graph::Graph<TypeParam> copy = this->graph_;
+    ASSERT_EQ(this->graph_.MemoryUsage().total(), usage.total());
+    ASSERT_EQ(copy.MemoryUsage().edges, usage.edges);
+    ASSERT_EQ(copy.MemoryUsage().vertices, usage.vertices);
+
+    // growing the copy leaves the original alone
+    copy.AddEdge(static_cast<TypeParam>(0), static_cast<TypeParam>(2));
+    ASSERT_EQ(this->graph_.MemoryUsage().total(), usage.total());
+    ASSERT_GT(copy.MemoryUsage().edges, usage.edges);
+
+    // copy assignment replaces the copy's usage, not adds to the original's
+    copy = this->graph_;
+    ASSERT_EQ(copy.MemoryUsage().total(), usage.total());
+    ASSERT_EQ(this->graph_.MemoryUsage().total(), usage.total());
+}
+
+
+
+// Moved-from graphs stay usable and count into their own counters
+TYPED_TEST(MemoryTest, MovedFromGraphIsReusable)
+{
+    const auto usage = this->graph_.MemoryUsage();
+
+    graph::Graph<TypeParam> moved(std::move(this->graph_));
+    ASSERT_EQ(moved.MemoryUsage().total(), usage.total());
+
+    this->graph_.AddVertex(static_cast<TypeParam>(this->count_));
+    this->graph_.AddVertex(static_cast<TypeParam>(this->count_ + 1));
+    this->graph_.AddEdge(static_cast<TypeParam>(this->count_), static_cast<TypeParam>(this->count_ + 1));
+    ASSERT_GT(this->graph_.MemoryUsage().edges, 0u);
+    ASSERT_EQ(moved.MemoryUsage().total(), usage.total());
+
+    graph::Graph<TypeParam> assigned;
+    assigned = std::move(moved);
+    ASSERT_EQ(assigned.MemoryUsage().total(), usage.total());
+
+    moved.AddVertex(static_cast<TypeParam>(0));
+    moved.AddVertex(static_cast<TypeParam>(1));
+    moved.AddEdge(static_cast<TypeParam>(0), static_cast<TypeParam>(1));
+    ASSERT_GT(moved.MemoryUsage().edges, 0u);
+    ASSERT_EQ(assigned.MemoryUsage().total(), usage.total());
+}
+
+
+
+// Container copies start from a fresh counter
+TEST(CountingAllocatorTest, CopyConstructionSelectsFreshCounter)
+{
+    using list_type = std::list<int, utility::counting_allocator<int>>;
+
+    list_type original(10, 1);
+    const std::size_t bytes = original.get_allocator().allocated();
+    ASSERT_GT(bytes, 0u);
+
+    list_type copy(original);
+    ASSERT_NE(copy.get_allocator(), original.get_allocator());
+    ASSERT_EQ(original.get_allocator().allocated(), bytes);
+    ASSERT_EQ(copy.get_allocator().allocated(), bytes);
+}
+
+
+
+// Moved allocator keeps a counter, moved-from container can allocate again
+TEST(CountingAllocatorTest, MovedFromContainerAllocates)
+{
+    using list_type = std::list<int, utility::counting_allocator<int>>;
+
+    list_type original(10, 1);
+    list_type moved(std::move(original));
+    ASSERT_GT(moved.get_allocator().allocated(), 0u);
+
+    original.push_back(2);
+    ASSERT_EQ(original.size(), 1u);
+
+    list_type assigned;
+    assigned = std::move(moved);
+    moved.push_back(3);
+    ASSERT_EQ(moved.size(), 1u);
+    ASSERT_EQ(assigned.size(), 10u);
+}
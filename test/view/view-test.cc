@@ -0,0 +1,226 @@
+#include "gtest/gtest.h"                                        //gtest
+#include "graph-lib/graph.hpp"                                  // helper component
+#include "graph-lib/view/induced-view.hpp"                      // component to test
+#include "graph-lib/view/filtered-view.hpp"                     // component to test
+#include "graph-lib/view/transposed-view.hpp"                   // component to test
+#include "graph-lib/algorithm/traversal/bfs.hpp"                // view consumer
+#include "graph-lib/algorithm/traversal/dfs.hpp"                // view consumer
+#include "graph-lib/implementation/compressed-list.hpp"         // view consumer
+//
+#include <set>                                                  //
+#include <utility>                                              // std::pair
+
+
+
+
+
+template<   class id_type>
+class ViewTest : public testing::Test
+{
+protected:
+    using graph_type    = graph::Graph<id_type>;
+    using vertex_type   = component::Vertex<id_type>;
+    using arc_set       = std::set<std::pair<id_type, id_type>>;
+
+    //required functions
+    void    SetUp()     override
+    {
+        // directed chain 0 -> 1 -> ... -> 9, capacity of i -> i+1 is i % 2
+        count_ = 10;
+
+        for (int i = 0; i < count_; ++i)
+        {
+            graph_.AddVertex(static_cast<id_type>(i));
+        }
+        for (int i = 0; i + 1 < count_; ++i)
+        {
+            graph_.AddEdge(static_cast<id_type>(i), static_cast<id_type>(i + 1),
+                           component::traits::edge_direction::one_two, 1, i % 2);
+        }
+    }
+
+    void    TearDown()  override
+    {   }
+
+    // collect arcs of any graph-like object as id pairs
+    template<class view_type>
+    arc_set arcs(const view_type& view) const
+    {
+        arc_set result;
+        for (auto it = view.cbegin(); it != view.cend(); ++it)
+        {
+            for (const auto& edge : view.GetNeighbours((*it).first))
+            {
+                result.emplace(edge.GetVertex(0).Id(), edge.GetVertex(1).Id());
+            }
+        }
+        return result;
+    }
+
+    // vertices reached by bfs
+    template<class view_type>
+    std::set<id_type> reached(const view_type& view, id_type root) const
+    {
+        algorithm::bfs<id_type, view_type> bfsObj(&view);
+        bfsObj.run(vertex_type(root));
+
+        std::set<id_type> result;
+        for (const auto& entry : bfsObj.get())
+        {
+            if (entry.second != vertex_type::invalidInstance_)
+            {
+                result.insert(entry.first.Id());
+            }
+        }
+        return result;
+    }
+
+    int count_;
+    graph_type graph_;
+};
+
+
+
+
+
+using testing::Types;
+
+typedef Types<int, char> Implementations;
+
+TYPED_TEST_SUITE(ViewTest, Implementations);
+
+
+
+
+
+TYPED_TEST(ViewTest, Induced)
+{
+    using vertex_type = typename TestFixture::vertex_type;
+
+    // vertices 2..6
+    auto view = view::make_induced_view(this->graph_,
+        [](const vertex_type& vertex) { return vertex.Id() >= 2 && vertex.Id() <= 6; });
+
+    ASSERT_EQ(view.Size(), 5);
+    ASSERT_EQ(this->arcs(view).size(), 4u);
+    ASSERT_EQ(this->arcs(view).count(std::make_pair(TypeParam(1), TypeParam(2))), 0u);
+    ASSERT_THROW(view.GetNeighbours(vertex_type(TypeParam(0))), std::out_of_range);
+    ASSERT_EQ(view.MemoryUsage().total(), 0u);
+
+    // bfs from 3 reaches 3..6 only
+    ASSERT_EQ(this->reached(view, TypeParam(3)),
+              (std::set<TypeParam>{3, 4, 5, 6}));
+
+    // vertex set flavour
+    std::set<vertex_type, component::support::vertex_less<TypeParam>> vertices;
+    vertices.insert(vertex_type(TypeParam(0)));
+    vertices.insert(vertex_type(TypeParam(1)));
+    vertices.insert(vertex_type(TypeParam(5)));
+    auto setView = view::make_induced_view(this->graph_, vertices);
+
+    ASSERT_EQ(setView.Size(), 3);
+    ASSERT_EQ(this->arcs(setView), (typename TestFixture::arc_set{{0, 1}}));
+
+    // snapshot of the view contains view only
+    implementation::CompressedList<TypeParam> list(view);
+    ASSERT_EQ(list.Size(), 5);
+    ASSERT_EQ(list.EdgeCount(), 4);
+}
+
+
+
+TYPED_TEST(ViewTest, Filtered)
+{
+    auto view = view::make_filtered_view(this->graph_,
+        [](const auto& edge) { return edge.GetCapacity() > 0; });
+
+    ASSERT_EQ(view.Size(), this->count_);
+    ASSERT_EQ(this->arcs(view).size(), 4u);
+
+    // 1 -> 2 has capacity, 2 -> 3 has none
+    ASSERT_EQ(this->reached(view, TypeParam(1)), (std::set<TypeParam>{1, 2}));
+}
+
+
+
+TYPED_TEST(ViewTest, Transposed)
+{
+    auto view = view::make_transposed_view(this->graph_);
+
+    auto reversed = this->arcs(view);
+    ASSERT_EQ(reversed.size(), static_cast<std::size_t>(this->count_ - 1));
+    for (int i = 0; i + 1 < this->count_; ++i)
+    {
+        ASSERT_EQ(reversed.count(std::make_pair(TypeParam(i + 1), TypeParam(i))), 1u);
+    }
+    ASSERT_GT(view.MemoryUsage().auxiliary, 0u);
+
+    // chain is walked backwards
+    ASSERT_EQ(this->reached(view, TypeParam(3)), (std::set<TypeParam>{0, 1, 2, 3}));
+}
+
+
+
+TYPED_TEST(ViewTest, Nested)
+{
+    using vertex_type = typename TestFixture::vertex_type;
+
+    auto induced = view::make_induced_view(this->graph_,
+        [](const vertex_type& vertex) { return vertex.Id() < 5; });
+    auto filtered = view::make_filtered_view(induced,
+        [](const auto& edge) { return edge.GetCapacity() == 0; });
+    auto transposed = view::make_transposed_view(filtered);
+
+    // 0 -> 1, 2 -> 3 survive filtering, reversed
+    ASSERT_EQ(this->arcs(transposed), (typename TestFixture::arc_set{{1, 0}, {3, 2}}));
+    ASSERT_EQ(this->reached(transposed, TypeParam(3)), (std::set<TypeParam>{2, 3}));
+}
+
+
+
+TYPED_TEST(ViewTest, InPlaceSearch)
+{
+    using vertex_type = typename TestFixture::vertex_type;
+    using list_type   = implementation::CompressedList<TypeParam>;
+
+    // shortcuts i -> i + 3 give vertices several children
+    for (int i = 0; i + 3 < this->count_; ++i)
+    {
+        this->graph_.AddEdge(static_cast<TypeParam>(i), static_cast<TypeParam>(i + 3),
+                             component::traits::edge_direction::one_two, 1, 1);
+    }
+    auto view = view::make_induced_view(this->graph_,
+        [](const vertex_type& vertex) { return vertex.Id() != 4; });
+    using view_type = decltype(view);
+
+    // searches on the view copy no arcs and match searches on its snapshot
+    algorithm::bfs<TypeParam, view_type> bfsView(&view);
+    algorithm::bfs<TypeParam, view_type> bfsList{list_type(view)};
+    bfsView.run(vertex_type(TypeParam(0)));
+    bfsList.run(vertex_type(TypeParam(0)));
+    ASSERT_EQ(bfsView.get_snapshot().EdgeCount(), 0);
+    ASSERT_EQ(bfsView.get_parents(), bfsList.get_parents());
+    ASSERT_EQ(bfsView.get_distances(), bfsList.get_distances());
+    ASSERT_EQ(bfsView.get_order(), bfsList.get_order());
+
+    bfsView.run(vertex_type(TypeParam(0)), algorithm::policy::positive_capacity());
+    bfsList.run(vertex_type(TypeParam(0)), algorithm::policy::positive_capacity());
+    ASSERT_EQ(bfsView.get_snapshot().EdgeCount(), 0);
+    ASSERT_EQ(bfsView.get_parents(), bfsList.get_parents());
+
+    algorithm::dfs<TypeParam, view_type> dfsView(&view);
+    algorithm::dfs<TypeParam, view_type> dfsList{list_type(view)};
+    dfsView.run(vertex_type(TypeParam(0)));
+    dfsList.run(vertex_type(TypeParam(0)));
+    ASSERT_EQ(dfsView.get_snapshot().EdgeCount(), 0);
+    ASSERT_EQ(dfsView.get_parents(), dfsList.get_parents());
+    ASSERT_EQ(dfsView.get_order(), dfsList.get_order());
+    ASSERT_EQ(dfsView.get_finish(), dfsList.get_finish());
+    ASSERT_TRUE(dfsView.get_edge_classes().empty());
+
+    // direction optimizing search needs arc indices and takes them once
+    bfsView.run(vertex_type(TypeParam(0)), algorithm::traits::bfs_mode::direction_optimizing);
+    bfsList.run(vertex_type(TypeParam(0)), algorithm::traits::bfs_mode::direction_optimizing);
+    ASSERT_EQ(bfsView.get_snapshot().EdgeCount(), list_type(view).EdgeCount());
+    ASSERT_EQ(bfsView.get_distances(), bfsList.get_distances());
+}